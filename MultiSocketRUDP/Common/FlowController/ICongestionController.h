@@ -0,0 +1,69 @@
+﻿#pragma once
+#include "../etc/CoreType.h"
+#include <chrono>
+
+// ----------------------------------------
+// @brief 세션 송신 측 혼잡 윈도우를 결정하는 알고리즘의 인터페이스입니다.
+// RUDPFlowManager가 CONGESTION_CONTROL 옵션에 맞는 구현을 하나 소유합니다.
+// ACK와 RTT 샘플은 수신 로직 스레드에서, 타임아웃은 재전송 스레드에서 들어오므로
+// RUDPFlowManager가 모든 호출을 잠금 안에서 하며, 구현은 스레드 안전할 필요가 없습니다.
+// 송신 스레드는 구현을 직접 읽지 않고 RUDPFlowManager가 게시한 cwnd와 페이싱 간격을 읽습니다.
+// ----------------------------------------
+class ICongestionController
+{
+public:
+	virtual ~ICongestionController() = default;
+
+public:
+	virtual void OnReplyReceived(PacketSequence replySequence) noexcept = 0;
+	// ----------------------------------------
+	// @brief 세션이 계산한 RTT 샘플을 전달합니다. RTT를 쓰지 않는 알고리즘은 무시합니다.
+	// @param sample 재전송되지 않은 패킷의 왕복 시간.
+	// ----------------------------------------
+	virtual void OnRttSample(std::chrono::steady_clock::duration) noexcept {}
+	virtual void OnCongestionEvent() noexcept = 0;
+	virtual void OnTimeout() noexcept = 0;
+
+	virtual void Reset() noexcept = 0;
+
+	// ----------------------------------------
+	// @brief 송신 페이서가 패킷 간격을 정할 때 쓰는 전송률을 반환합니다.
+	// 기본 구현은 한 SRTT 동안 cwnd를 조금 여유 있게 보낼 수 있는 cwnd / SRTT * DEFAULT_PACING_GAIN입니다.
+	// @param smoothedRtt 세션의 평활 RTT. 아직 샘플이 없으면 0입니다.
+	// @return 초당 패킷 수. 0이면 페이싱하지 않습니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	virtual double GetPacingRate(const std::chrono::steady_clock::duration smoothedRtt) const noexcept
+	{
+		if (smoothedRtt <= std::chrono::steady_clock::duration::zero())
+		{
+			return 0;
+		}
+
+		return GetCwnd() * DEFAULT_PACING_GAIN / std::chrono::duration<double>(smoothedRtt).count();
+	}
+
+	[[nodiscard]]
+	virtual CONGESTION_CONTROL_TYPE GetType() const noexcept = 0;
+	[[nodiscard]]
+	virtual uint32_t GetCwnd() const noexcept = 0;
+	[[nodiscard]]
+	virtual PacketSequence GetLastAckedSequence() const noexcept = 0;
+
+protected:
+	static constexpr double DEFAULT_PACING_GAIN = 1.25;
+
+	// ----------------------------------------
+	// @brief 두 패킷 시퀀스 번호의 차이를 계산합니다.
+	// 시퀀스 번호는 순환하므로, 직접적인 뺄셈이 아닌 흐름 제어 로직에 맞는
+	// 상대적인 차이를 반환하여 순서가 뒤바뀌거나 누락된 패킷을 감지하는 데 사용됩니다.
+	// @param a 첫 번째 패킷 시퀀스.
+	// @param b 두 번째 패킷 시퀀스.
+	// @return 두 시퀀스 번호의 차이.양수면 a가 b보다 나중 시퀀스임을 나타냅니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	static int64_t SeqDiff(const PacketSequence a, const PacketSequence b) noexcept
+	{
+		return static_cast<int64_t>(a - b);
+	}
+};
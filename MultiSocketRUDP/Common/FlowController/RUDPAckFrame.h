@@ -0,0 +1,305 @@
+﻿#pragma once
+#include "../etc/CoreType.h"
+#include "NetServerSerializeBuffer.h"
+#include <algorithm>
+#include <array>
+
+// ----------------------------------------
+// @brief SEND_REPLY_TYPE / HEARTBEAT_REPLY_TYPE 패킷에 실리는 ACK 프레임입니다.
+// cumulativeSequence 이하의 모든 시퀀스와 각 SACK 구간 [first, last]에 속한 시퀀스가 수신되었음을 뜻합니다.
+// 구간은 오름차순이며 서로 겹치지 않고, 모두 cumulativeSequence보다 뒤에 있습니다.
+// ----------------------------------------
+struct RUDPAckFrame
+{
+	struct SackRange
+	{
+		PacketSequence first{};
+		PacketSequence last{};
+	};
+
+	// ----------------------------------------
+	// @brief ACK 프레임을 담은 응답 패킷의 헤더 시퀀스에 설정하는 플래그입니다.
+	// 같은 누적 시퀀스를 여러 번 보내더라도 응답 패킷마다 nonce가 달라지도록 별도 시퀀스 공간을 사용합니다.
+	// ----------------------------------------
+	static constexpr PacketSequence REPLY_SEQUENCE_FLAG = 1ull << 62;
+
+	// ----------------------------------------
+	// @brief SEND_TYPE 헤더의 시퀀스 뒤에 오는 피기백 ACK 필드의 첫 바이트입니다.
+	// PRESENT이면 바로 뒤에 ACK 프레임이 이어지며, 필드 전체가 AAD로 인증됩니다.
+	// ----------------------------------------
+	static constexpr BYTE PIGGYBACK_ACK_ABSENT = 0;
+	static constexpr BYTE PIGGYBACK_ACK_PRESENT = 1;
+
+	static constexpr int FIXED_WIRE_SIZE = sizeof(PacketSequence) + sizeof(BYTE) + sizeof(BYTE);
+	static constexpr int SACK_RANGE_WIRE_SIZE = sizeof(WORD) + sizeof(WORD);
+	static constexpr int MAX_PIGGYBACK_FIELD_SIZE = sizeof(BYTE) + FIXED_WIRE_SIZE + MAX_SACK_RANGE_COUNT * SACK_RANGE_WIRE_SIZE;
+
+	PacketSequence cumulativeSequence{};
+	BYTE advertiseWindow{};
+	BYTE sackRangeCount{};
+	std::array<SackRange, MAX_SACK_RANGE_COUNT> sackRanges{};
+
+	// ----------------------------------------
+	// @brief SACK 구간을 뒤에 추가합니다.
+	// 구간 수가 가득 찼거나, 직렬화 시 오프셋을 표현할 수 없는 구간이면 추가하지 않습니다.
+	// @param first 구간의 첫 시퀀스
+	// @param last 구간의 마지막 시퀀스
+	// @return 추가 성공 여부
+	// ----------------------------------------
+	bool AddSackRange(const PacketSequence first, const PacketSequence last) noexcept
+	{
+		if (sackRangeCount >= MAX_SACK_RANGE_COUNT || last - cumulativeSequence > MAX_SACK_OFFSET)
+		{
+			return false;
+		}
+
+		sackRanges[sackRangeCount++] = { first, last };
+		return true;
+	}
+
+	[[nodiscard]]
+	bool IsCovered(const PacketSequence sequence) const noexcept
+	{
+		if (sequence <= cumulativeSequence)
+		{
+			return true;
+		}
+
+		for (BYTE i = 0; i < sackRangeCount; ++i)
+		{
+			if (sackRanges[i].first <= sequence && sequence <= sackRanges[i].last)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	[[nodiscard]]
+	PacketSequence GetHighestCoveredSequence() const noexcept
+	{
+		return sackRangeCount == 0 ? cumulativeSequence : sackRanges[sackRangeCount - 1].last;
+	}
+
+	// ----------------------------------------
+	// @brief SACK 구간에 속한 시퀀스 중 sequence보다 뒤에 있는 시퀀스 수를 셉니다.
+	// @param sequence 기준 시퀀스
+	// @return sequence 뒤에서 수신이 확인된 시퀀스 수
+	// ----------------------------------------
+	[[nodiscard]]
+	PacketSequence CountSackedAfter(const PacketSequence sequence) const noexcept
+	{
+		PacketSequence sackedCount = 0;
+		for (BYTE i = sackRangeCount; i > 0; --i)
+		{
+			const SackRange& range = sackRanges[i - 1];
+			if (range.last <= sequence)
+			{
+				break;
+			}
+
+			sackedCount += range.last - (std::max)(range.first, sequence + 1) + 1;
+		}
+
+		return sackedCount;
+	}
+
+	// ----------------------------------------
+	// @brief 정렬된 맵에 남은 항목 중 손실로 판단되는 항목마다 시퀀스 오름차순으로 func를 호출합니다.
+	// 뒤 시퀀스가 FAST_RETRANSMIT_SACK_THRESHOLD개 이상 SACK으로 수신 확인되었는데 빠져 있는 항목을 손실로 봅니다.
+	// 이 프레임이 덮는 항목은 EraseCovered로 먼저 제거되어 있어야 합니다.
+	// @param sequenceMap std::map<PacketSequence, T> 형태의 맵
+	// @param afterSequence 이 시퀀스 이하의 항목은 건너뜁니다. 이미 빠른 재전송한 구간을 다시 고르지 않는 데 사용합니다.
+	// @param func 손실로 판단된 각 값에 대해 호출할 함수
+	// @param maxCount 이만큼 고르면 멈춥니다. 남은 항목은 afterSequence를 넘겨 다음 ACK에서 이어서 고릅니다.
+	// @return 손실로 판단된 항목 수
+	// ----------------------------------------
+	template <typename SequenceMap, typename Func>
+	size_t ForEachLost(const SequenceMap& sequenceMap, const PacketSequence afterSequence, Func&& func, const size_t maxCount = SIZE_MAX) const
+	{
+		if (sackRangeCount == 0)
+		{
+			return 0;
+		}
+
+		// 뒤 시퀀스일수록 뒤에서 확인된 수가 줄어들므로, 기준에 못 미치는 첫 항목에서 멈춥니다.
+		size_t lostCount = 0;
+		const auto end = sequenceMap.lower_bound(sackRanges[sackRangeCount - 1].first);
+		for (auto itor = sequenceMap.upper_bound((std::max)(afterSequence, cumulativeSequence)); itor != end && lostCount < maxCount; ++itor)
+		{
+			if (CountSackedAfter(itor->first) < FAST_RETRANSMIT_SACK_THRESHOLD)
+			{
+				break;
+			}
+
+			func(itor->second);
+			++lostCount;
+		}
+
+		return lostCount;
+	}
+
+	// ----------------------------------------
+	// @brief 시퀀스를 키로 하는 정렬된 맵에서 이 프레임이 덮는 항목들을 한 번의 순회로 제거합니다.
+	// 누적 구간과 각 SACK 구간을 맵의 순서대로 잘라내므로 덮인 항목 수만큼만 방문합니다.
+	// @param sequenceMap std::map<PacketSequence, T> 형태의 맵
+	// @param func 제거되는 각 값에 대해 시퀀스 오름차순으로 호출할 함수
+	// @return 제거된 항목 수
+	// ----------------------------------------
+	template <typename SequenceMap, typename Func>
+	size_t EraseCovered(SequenceMap& sequenceMap, Func&& func) const
+	{
+		size_t erasedCount = 0;
+		const auto eraseRange = [&](auto begin, const auto end)
+		{
+			while (begin != end)
+			{
+				func(begin->second);
+				begin = sequenceMap.erase(begin);
+				++erasedCount;
+			}
+		};
+
+		eraseRange(sequenceMap.begin(), sequenceMap.upper_bound(cumulativeSequence));
+		for (BYTE i = 0; i < sackRangeCount; ++i)
+		{
+			eraseRange(sequenceMap.lower_bound(sackRanges[i].first), sequenceMap.upper_bound(sackRanges[i].last));
+		}
+
+		return erasedCount;
+	}
+
+	// ----------------------------------------
+	// @brief 프레임을 버퍼에 씁니다. SACK 구간은 누적 시퀀스로부터의 WORD 오프셋으로 기록합니다.
+	// @param buffer 대상 버퍼
+	// ----------------------------------------
+	void WriteTo(OUT NetBuffer& buffer) const
+	{
+		buffer << cumulativeSequence << advertiseWindow << sackRangeCount;
+		for (BYTE i = 0; i < sackRangeCount; ++i)
+		{
+			const WORD firstOffset = static_cast<WORD>(sackRanges[i].first - cumulativeSequence);
+			const WORD lastOffset = static_cast<WORD>(sackRanges[i].last - cumulativeSequence);
+			buffer << firstOffset << lastOffset;
+		}
+	}
+
+	// ----------------------------------------
+	// @brief 버퍼에서 프레임을 읽고 구간 순서를 검증합니다.
+	// @param buffer 읽을 버퍼
+	// @return 형식이 올바르면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool ReadFrom(OUT NetBuffer& buffer)
+	{
+		if (buffer.GetUseSize() < FIXED_WIRE_SIZE)
+		{
+			return false;
+		}
+
+		buffer >> cumulativeSequence >> advertiseWindow >> sackRangeCount;
+		if (sackRangeCount > MAX_SACK_RANGE_COUNT || buffer.GetUseSize() < sackRangeCount * SACK_RANGE_WIRE_SIZE)
+		{
+			return false;
+		}
+
+		WORD previousLastOffset = 0;
+		for (BYTE i = 0; i < sackRangeCount; ++i)
+		{
+			WORD firstOffset;
+			WORD lastOffset;
+			buffer >> firstOffset >> lastOffset;
+			if (firstOffset <= previousLastOffset || lastOffset < firstOffset)
+			{
+				return false;
+			}
+
+			sackRanges[i] = { cumulativeSequence + firstOffset, cumulativeSequence + lastOffset };
+			previousLastOffset = lastOffset;
+		}
+
+		return true;
+	}
+
+	// ----------------------------------------
+	// @brief SEND_TYPE 헤더에 피기백 ACK 필드를 씁니다.
+	// @param buffer 대상 버퍼 (패킷 시퀀스까지 쓰여 있어야 합니다)
+	// @param ackFrame 실을 ACK 프레임. nullptr이면 ACK 없음 표시만 씁니다.
+	// ----------------------------------------
+	static void WritePiggybackField(OUT NetBuffer& buffer, const RUDPAckFrame* ackFrame)
+	{
+		if (ackFrame == nullptr)
+		{
+			buffer << PIGGYBACK_ACK_ABSENT;
+			return;
+		}
+
+		buffer << PIGGYBACK_ACK_PRESENT;
+		ackFrame->WriteTo(buffer);
+	}
+
+	// ----------------------------------------
+	// @brief SEND_TYPE 헤더에서 피기백 ACK 필드를 읽습니다.
+	// @param buffer 읽을 버퍼 (패킷 시퀀스 바로 뒤를 가리켜야 합니다)
+	// @param ackFrame 필드에 ACK 프레임이 있으면 채워집니다.
+	// @param hasAckFrame ACK 프레임이 있었는지 여부
+	// @return 형식이 올바르면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	static bool ReadPiggybackField(OUT NetBuffer& buffer, OUT RUDPAckFrame& ackFrame, OUT bool& hasAckFrame)
+	{
+		hasAckFrame = false;
+		if (buffer.GetUseSize() < static_cast<int>(sizeof(BYTE)))
+		{
+			return false;
+		}
+
+		BYTE piggybackFlag;
+		buffer >> piggybackFlag;
+		if (piggybackFlag == PIGGYBACK_ACK_ABSENT)
+		{
+			return true;
+		}
+
+		hasAckFrame = true;
+		return piggybackFlag == PIGGYBACK_ACK_PRESENT && ackFrame.ReadFrom(buffer);
+	}
+
+	// ----------------------------------------
+	// @brief 직렬화된 피기백 ACK 필드의 크기를 복호화 전에 계산합니다.
+	// @param field 필드의 시작 위치
+	// @param availableSize field부터 읽을 수 있는 바이트 수
+	// @return 필드 크기. 형식이 올바르지 않거나 잘려 있으면 -1
+	// ----------------------------------------
+	[[nodiscard]]
+	static int GetPiggybackFieldSize(const char* field, const int availableSize) noexcept
+	{
+		if (availableSize < static_cast<int>(sizeof(BYTE)))
+		{
+			return -1;
+		}
+
+		if (static_cast<BYTE>(field[0]) == PIGGYBACK_ACK_ABSENT)
+		{
+			return sizeof(BYTE);
+		}
+
+		constexpr int sackRangeCountOffset = sizeof(BYTE) + sizeof(PacketSequence) + sizeof(BYTE);
+		if (static_cast<BYTE>(field[0]) != PIGGYBACK_ACK_PRESENT || availableSize < static_cast<int>(sizeof(BYTE)) + FIXED_WIRE_SIZE)
+		{
+			return -1;
+		}
+
+		const BYTE rangeCount = static_cast<BYTE>(field[sackRangeCountOffset]);
+		const int fieldSize = static_cast<int>(sizeof(BYTE)) + FIXED_WIRE_SIZE + rangeCount * SACK_RANGE_WIRE_SIZE;
+		if (rangeCount > MAX_SACK_RANGE_COUNT || fieldSize > availableSize)
+		{
+			return -1;
+		}
+
+		return fieldSize;
+	}
+
+	static constexpr PacketSequence MAX_SACK_OFFSET = 0xFFFF;
+};
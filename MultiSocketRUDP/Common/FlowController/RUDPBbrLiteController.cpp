@@ -0,0 +1,149 @@
+#include "PreCompile.h"
+#include "RUDPBbrLiteController.h"
+#include <algorithm>
+#include <cmath>
+
+RUDPBbrLiteController::RUDPBbrLiteController()
+{
+	Reset();
+}
+
+void RUDPBbrLiteController::OnReplyReceived(const PacketSequence replySequence) noexcept
+{
+	OnReplyReceived(replySequence, std::chrono::steady_clock::now());
+}
+
+void RUDPBbrLiteController::OnReplyReceived(const PacketSequence replySequence, const std::chrono::steady_clock::time_point now) noexcept
+{
+	const int64_t diff = SeqDiff(replySequence, lastReplySequence);
+	if (diff <= 0)
+	{
+		return;
+	}
+
+	lastReplySequence = replySequence;
+	const auto ackedCount = static_cast<uint32_t>(std::min<int64_t>(diff, MAX_CONGESTION_WINDOW));
+	deliveredCount += ackedCount;
+	UpdateBandwidthModel(now);
+
+	const uint32_t targetCwnd = ComputeTargetCwnd();
+	const uint32_t grownCwnd = std::min<uint32_t>(cwnd + ackedCount, MAX_CONGESTION_WINDOW);
+	if (pipeFilled)
+	{
+		// 파이프가 찼으면 모델이 허용하는 만큼만 유지하고, 그보다 크면 바로 줄입니다.
+		cwnd = targetCwnd == 0 ? grownCwnd : std::min(grownCwnd, targetCwnd);
+	}
+	else if (targetCwnd == 0 || cwnd < targetCwnd)
+	{
+		cwnd = grownCwnd;
+	}
+}
+
+void RUDPBbrLiteController::OnRttSample(const std::chrono::steady_clock::duration sample) noexcept
+{
+	OnRttSample(sample, std::chrono::steady_clock::now());
+}
+
+void RUDPBbrLiteController::OnRttSample(const std::chrono::steady_clock::duration sample, const std::chrono::steady_clock::time_point now) noexcept
+{
+	// 경로가 바뀌어 RTT가 늘어난 경우를 반영하도록 오래된 최소값은 새 샘플로 교체합니다.
+	if (minRtt == std::chrono::steady_clock::duration::zero() || sample <= minRtt || now - minRttTime > MIN_RTT_FILTER_WINDOW)
+	{
+		minRtt = sample;
+		minRttTime = now;
+	}
+}
+
+void RUDPBbrLiteController::OnCongestionEvent() noexcept
+{
+	// 손실로 윈도우를 줄이지는 않지만, STARTUP의 공격적인 이득은 더 쓰지 않습니다.
+	pipeFilled = true;
+	if (const uint32_t targetCwnd = ComputeTargetCwnd(); targetCwnd != 0)
+	{
+		cwnd = std::min(cwnd, targetCwnd);
+	}
+}
+
+void RUDPBbrLiteController::OnTimeout() noexcept
+{
+	cwnd = MIN_CONGESTION_WINDOW;
+}
+
+void RUDPBbrLiteController::Reset() noexcept
+{
+	cwnd = INITIAL_CONGESTION_WINDOW;
+	lastReplySequence = 0;
+	deliveredCount = 0;
+	roundStartDeliveredCount = 0;
+	roundStartTime = {};
+	bandwidthSamples.fill(0);
+	nextBandwidthSampleIndex = 0;
+	maxBandwidth = 0;
+	minRtt = {};
+	minRttTime = {};
+	fullBandwidth = 0;
+	fullBandwidthRoundCount = 0;
+	pipeFilled = false;
+}
+
+double RUDPBbrLiteController::GetPacingRate(const std::chrono::steady_clock::duration smoothedRtt) const noexcept
+{
+	if (maxBandwidth <= 0)
+	{
+		return ICongestionController::GetPacingRate(smoothedRtt);
+	}
+
+	return maxBandwidth * (pipeFilled ? DEFAULT_PACING_GAIN : STARTUP_GAIN);
+}
+
+void RUDPBbrLiteController::UpdateBandwidthModel(const std::chrono::steady_clock::time_point now) noexcept
+{
+	if (roundStartTime == std::chrono::steady_clock::time_point{})
+	{
+		roundStartTime = now;
+		roundStartDeliveredCount = deliveredCount;
+		return;
+	}
+
+	const auto elapsed = now - roundStartTime;
+	if (minRtt == std::chrono::steady_clock::duration::zero() || elapsed < minRtt)
+	{
+		return;
+	}
+
+	const double bandwidthSample = static_cast<double>(deliveredCount - roundStartDeliveredCount) / std::chrono::duration<double>(elapsed).count();
+	bandwidthSamples[nextBandwidthSampleIndex] = bandwidthSample;
+	nextBandwidthSampleIndex = (nextBandwidthSampleIndex + 1) % BANDWIDTH_FILTER_ROUNDS;
+	maxBandwidth = *std::max_element(bandwidthSamples.begin(), bandwidthSamples.end());
+
+	roundStartTime = now;
+	roundStartDeliveredCount = deliveredCount;
+
+	if (pipeFilled)
+	{
+		return;
+	}
+
+	if (maxBandwidth >= fullBandwidth * FULL_BANDWIDTH_GROWTH)
+	{
+		fullBandwidth = maxBandwidth;
+		fullBandwidthRoundCount = 0;
+	}
+	else if (++fullBandwidthRoundCount >= FULL_BANDWIDTH_ROUNDS)
+	{
+		pipeFilled = true;
+	}
+}
+
+uint32_t RUDPBbrLiteController::ComputeTargetCwnd() const noexcept
+{
+	if (maxBandwidth <= 0 || minRtt == std::chrono::steady_clock::duration::zero())
+	{
+		return 0;
+	}
+
+	const double bdp = maxBandwidth * std::chrono::duration<double>(minRtt).count();
+	const double gain = pipeFilled ? CWND_GAIN : STARTUP_GAIN;
+	const double targetCwnd = std::ceil(bdp * gain);
+	return static_cast<uint32_t>(std::clamp<double>(targetCwnd, INITIAL_CONGESTION_WINDOW, MAX_CONGESTION_WINDOW));
+}
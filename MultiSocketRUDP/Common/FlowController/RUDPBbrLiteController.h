@@ -0,0 +1,99 @@
+﻿#pragma once
+#include "ICongestionController.h"
+#include <array>
+
+// ----------------------------------------
+// @brief BBR의 대역폭-지연 모델만 가져온 간이 혼잡 제어입니다.
+// 한 라운드(최소 RTT) 동안 ACK된 패킷 수로 전달률을 재고, 최근 라운드의 최대 전달률과
+// 최소 RTT의 곱(BDP)에 이득을 곱한 값을 cwnd로 씁니다. 손실은 혼잡 신호로 보지 않으며,
+// 페이싱 이득 순환과 PROBE_RTT 단계는 두지 않습니다. cwnd는 패킷 단위입니다.
+// ----------------------------------------
+class RUDPBbrLiteController final : public ICongestionController
+{
+public:
+	explicit RUDPBbrLiteController();
+	~RUDPBbrLiteController() override = default;
+
+public:
+	void OnReplyReceived(PacketSequence replySequence) noexcept override;
+	// ----------------------------------------
+	// @brief ACK 수신 시각을 직접 받아 전달률 모델과 cwnd를 갱신합니다.
+	// @param replySequence ACK된 가장 높은 시퀀스.
+	// @param now ACK를 처리한 시각.
+	// ----------------------------------------
+	void OnReplyReceived(PacketSequence replySequence, std::chrono::steady_clock::time_point now) noexcept;
+	void OnRttSample(std::chrono::steady_clock::duration sample) noexcept override;
+	// ----------------------------------------
+	// @brief 샘플 시각을 직접 받아 최소 RTT 필터를 갱신합니다.
+	// @param sample 재전송되지 않은 패킷의 왕복 시간.
+	// @param now 샘플을 얻은 시각.
+	// ----------------------------------------
+	void OnRttSample(std::chrono::steady_clock::duration sample, std::chrono::steady_clock::time_point now) noexcept;
+	void OnCongestionEvent() noexcept override;
+	void OnTimeout() noexcept override;
+
+	void Reset() noexcept override;
+
+	// ----------------------------------------
+	// @brief 모델이 있으면 최대 전달률에 이득을 곱한 값으로 페이싱합니다. 없으면 cwnd / SRTT 기준을 씁니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	double GetPacingRate(std::chrono::steady_clock::duration smoothedRtt) const noexcept override;
+
+	[[nodiscard]]
+	CONGESTION_CONTROL_TYPE GetType() const noexcept override { return CONGESTION_CONTROL_TYPE::BBR_LITE; }
+	[[nodiscard]]
+	uint32_t GetCwnd() const noexcept override { return cwnd; }
+	[[nodiscard]]
+	PacketSequence GetLastAckedSequence() const noexcept override { return lastReplySequence; }
+	// ----------------------------------------
+	// @brief 최근 라운드에서 관측한 최대 전달률을 초당 패킷 수로 반환합니다. 샘플이 없으면 0입니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	double GetBottleneckBandwidth() const noexcept { return maxBandwidth; }
+	[[nodiscard]]
+	std::chrono::steady_clock::duration GetMinRtt() const noexcept { return minRtt; }
+	// ----------------------------------------
+	// @brief 전달률이 더 늘지 않아 STARTUP을 끝냈는지 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	bool IsPipeFilled() const noexcept { return pipeFilled; }
+
+private:
+	// ----------------------------------------
+	// @brief 한 라운드가 끝났으면 전달률 샘플을 필터에 넣고 STARTUP 종료 여부를 판단합니다.
+	// @param now ACK를 처리한 시각.
+	// ----------------------------------------
+	void UpdateBandwidthModel(std::chrono::steady_clock::time_point now) noexcept;
+	// ----------------------------------------
+	// @brief 현재 모델의 BDP에 이득을 곱한 목표 cwnd를 계산합니다.
+	// @return 모델이 아직 없으면 0.
+	// ----------------------------------------
+	[[nodiscard]]
+	uint32_t ComputeTargetCwnd() const noexcept;
+
+private:
+	static constexpr size_t BANDWIDTH_FILTER_ROUNDS = 10;
+	static constexpr double STARTUP_GAIN = 2.885;
+	static constexpr double CWND_GAIN = 2.0;
+	static constexpr double FULL_BANDWIDTH_GROWTH = 1.25;
+	static constexpr uint8_t FULL_BANDWIDTH_ROUNDS = 3;
+	static constexpr std::chrono::seconds MIN_RTT_FILTER_WINDOW{ 10 };
+
+	uint32_t cwnd{};
+	PacketSequence lastReplySequence{};
+
+	uint64_t deliveredCount{};
+	uint64_t roundStartDeliveredCount{};
+	std::chrono::steady_clock::time_point roundStartTime{};
+	std::array<double, BANDWIDTH_FILTER_ROUNDS> bandwidthSamples{};
+	size_t nextBandwidthSampleIndex{};
+	double maxBandwidth{};
+
+	std::chrono::steady_clock::duration minRtt{};
+	std::chrono::steady_clock::time_point minRttTime{};
+
+	double fullBandwidth{};
+	uint8_t fullBandwidthRoundCount{};
+	bool pipeFilled{};
+};
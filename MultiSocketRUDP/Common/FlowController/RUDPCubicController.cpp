@@ -0,0 +1,124 @@
+#include "PreCompile.h"
+#include "RUDPCubicController.h"
+#include <algorithm>
+#include <cmath>
+
+RUDPCubicController::RUDPCubicController()
+{
+	Reset();
+}
+
+void RUDPCubicController::OnReplyReceived(const PacketSequence replySequence) noexcept
+{
+	OnReplyReceived(replySequence, std::chrono::steady_clock::now());
+}
+
+void RUDPCubicController::OnReplyReceived(const PacketSequence replySequence, const std::chrono::steady_clock::time_point now) noexcept
+{
+	const int64_t diff = SeqDiff(replySequence, lastReplySequence);
+	if (diff <= 0)
+	{
+		return;
+	}
+
+	lastReplySequence = replySequence;
+	// 지연 ACK나 SACK으로 여러 패킷이 한 번에 확인되면 그만큼 윈도우를 키웁니다.
+	const auto ackedCount = static_cast<uint32_t>(std::min<int64_t>(diff, MAX_CONGESTION_WINDOW));
+
+	if (cwnd < slowStartThreshold)
+	{
+		cwnd = std::min<uint32_t>(cwnd + ackedCount, MAX_CONGESTION_WINDOW);
+		return;
+	}
+
+	if (epochStart == std::chrono::steady_clock::time_point{})
+	{
+		epochStart = now;
+		cwndIncreaseCredit = 0;
+		renoFriendlyCwnd = cwnd;
+		if (cwnd < lastMaxCwnd)
+		{
+			cubicK = std::cbrt((lastMaxCwnd - cwnd) / CUBIC_C);
+		}
+		else
+		{
+			cubicK = 0;
+			lastMaxCwnd = cwnd;
+		}
+	}
+
+	renoFriendlyCwnd += 3 * (1 - CUBIC_BETA) / (1 + CUBIC_BETA) * ackedCount / cwnd;
+
+	// RFC 8312 권고대로 한 RTT 동안 cwnd가 1.5배를 넘게 자라지 않도록 목표를 제한합니다.
+	const double targetCwnd = std::min(ComputeTargetWindow(now), cwnd * 1.5);
+	if (targetCwnd <= cwnd)
+	{
+		return;
+	}
+
+	cwndIncreaseCredit += (targetCwnd - cwnd) / cwnd * ackedCount;
+	if (cwndIncreaseCredit >= 1)
+	{
+		const auto increase = static_cast<uint32_t>(cwndIncreaseCredit);
+		cwndIncreaseCredit -= increase;
+		cwnd = std::min<uint32_t>(cwnd + increase, MAX_CONGESTION_WINDOW);
+	}
+}
+
+void RUDPCubicController::OnRttSample(const std::chrono::steady_clock::duration sample) noexcept
+{
+	if (minRtt == std::chrono::steady_clock::duration::zero() || sample < minRtt)
+	{
+		minRtt = sample;
+	}
+}
+
+void RUDPCubicController::OnCongestionEvent() noexcept
+{
+	ReduceWindow();
+	cwnd = slowStartThreshold;
+}
+
+void RUDPCubicController::OnTimeout() noexcept
+{
+	ReduceWindow();
+	cwnd = MIN_CONGESTION_WINDOW;
+}
+
+void RUDPCubicController::Reset() noexcept
+{
+	cwnd = INITIAL_CONGESTION_WINDOW;
+	slowStartThreshold = MAX_CONGESTION_WINDOW;
+	lastReplySequence = 0;
+	lastMaxCwnd = 0;
+	cubicK = 0;
+	renoFriendlyCwnd = 0;
+	cwndIncreaseCredit = 0;
+	epochStart = {};
+	minRtt = {};
+}
+
+void RUDPCubicController::ReduceWindow() noexcept
+{
+	// fast convergence: W_max보다 작은 윈도우에서 또 손실되면 다른 흐름에 대역폭을 양보합니다.
+	if (cwnd < lastMaxCwnd)
+	{
+		lastMaxCwnd = cwnd * (1 + CUBIC_BETA) / 2;
+	}
+	else
+	{
+		lastMaxCwnd = cwnd;
+	}
+
+	slowStartThreshold = std::max<uint32_t>(static_cast<uint32_t>(cwnd * CUBIC_BETA), MIN_CONGESTION_WINDOW);
+	cwndIncreaseCredit = 0;
+	epochStart = {};
+}
+
+double RUDPCubicController::ComputeTargetWindow(const std::chrono::steady_clock::time_point now) const noexcept
+{
+	const double elapsedSeconds = std::chrono::duration<double>(now - epochStart + minRtt).count();
+	const double offset = elapsedSeconds - cubicK;
+	const double cubicCwnd = CUBIC_C * offset * offset * offset + lastMaxCwnd;
+	return std::max(cubicCwnd, renoFriendlyCwnd);
+}
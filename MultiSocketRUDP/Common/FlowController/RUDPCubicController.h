@@ -0,0 +1,66 @@
+﻿#pragma once
+#include "ICongestionController.h"
+
+// ----------------------------------------
+// @brief CUBIC(RFC 8312) 혼잡 제어입니다.
+// 마지막 손실 시점의 윈도우(W_max)를 기준으로 경과 시간의 3차 함수로 cwnd를 키우므로,
+// RTT가 긴 세션도 NewReno보다 빠르게 이전 윈도우를 회복합니다.
+// cwnd는 바이트가 아닌 패킷 단위로 계산합니다.
+// ----------------------------------------
+class RUDPCubicController final : public ICongestionController
+{
+public:
+	explicit RUDPCubicController();
+	~RUDPCubicController() override = default;
+
+public:
+	void OnReplyReceived(PacketSequence replySequence) noexcept override;
+	// ----------------------------------------
+	// @brief ACK 수신 시각을 직접 받아 cwnd를 갱신합니다.
+	// @param replySequence ACK된 가장 높은 시퀀스.
+	// @param now ACK를 처리한 시각.
+	// ----------------------------------------
+	void OnReplyReceived(PacketSequence replySequence, std::chrono::steady_clock::time_point now) noexcept;
+	void OnRttSample(std::chrono::steady_clock::duration sample) noexcept override;
+	void OnCongestionEvent() noexcept override;
+	void OnTimeout() noexcept override;
+
+	void Reset() noexcept override;
+
+	[[nodiscard]]
+	CONGESTION_CONTROL_TYPE GetType() const noexcept override { return CONGESTION_CONTROL_TYPE::CUBIC; }
+	[[nodiscard]]
+	uint32_t GetCwnd() const noexcept override { return cwnd; }
+	[[nodiscard]]
+	PacketSequence GetLastAckedSequence() const noexcept override { return lastReplySequence; }
+	[[nodiscard]]
+	uint32_t GetSlowStartThreshold() const noexcept { return slowStartThreshold; }
+
+private:
+	// ----------------------------------------
+	// @brief 손실이 감지되었을 때 W_max와 ssthresh를 갱신하고 새 혼잡 회피 구간을 준비합니다.
+	// ----------------------------------------
+	void ReduceWindow() noexcept;
+	// ----------------------------------------
+	// @brief 혼잡 회피 구간에서 한 RTT 뒤에 도달해야 할 목표 윈도우를 계산합니다.
+	// @param now ACK를 처리한 시각.
+	// @return 3차 함수 목표와 NewReno 추정치 중 큰 값.
+	// ----------------------------------------
+	[[nodiscard]]
+	double ComputeTargetWindow(std::chrono::steady_clock::time_point now) const noexcept;
+
+private:
+	uint32_t cwnd{};
+	uint32_t slowStartThreshold{};
+	PacketSequence lastReplySequence{};
+
+	double lastMaxCwnd{};
+	double cubicK{};
+	double renoFriendlyCwnd{};
+	double cwndIncreaseCredit{};
+	std::chrono::steady_clock::time_point epochStart{};
+	std::chrono::steady_clock::duration minRtt{};
+
+	static constexpr double CUBIC_C = 0.4;
+	static constexpr double CUBIC_BETA = 0.7;
+};
@@ -2,21 +2,9 @@
 #include "RUDPFlowController.h"
 #include <algorithm>
 
-int64_t RUDPFlowController::SeqDiff(const PacketSequence a, const PacketSequence b) noexcept
-{
-	return static_cast<int64_t>(a - b);
-}
-
 RUDPFlowController::RUDPFlowController()
-	: cwnd(INITIAL_CWND)
-{
-}
-
-bool RUDPFlowController::CanSendPacket(const PacketSequence nextSendSequence, const PacketSequence lastAckedSequence) const noexcept
+	: cwnd(INITIAL_CONGESTION_WINDOW)
 {
-	const int64_t diff = SeqDiff(nextSendSequence, lastAckedSequence);
-	const int64_t outstanding = diff > 1 ? diff - 1 : 0;
-	return outstanding < cwnd;
 }
 
 void RUDPFlowController::OnReplyReceived(const PacketSequence replySequence) noexcept
@@ -41,7 +29,7 @@ void RUDPFlowController::OnReplyReceived(const PacketSequence replySequence) noe
 
 	if (not inRecovery)
 	{
-		cwnd = std::min<uint8_t>(cwnd + 1, MAX_CWND);
+		cwnd = std::min<uint32_t>(cwnd + 1, MAX_CONGESTION_WINDOW);
 	}
 	else
 	{
@@ -51,19 +39,19 @@ void RUDPFlowController::OnReplyReceived(const PacketSequence replySequence) noe
 
 void RUDPFlowController::OnCongestionEvent() noexcept
 {
-	cwnd = std::max<uint8_t>(cwnd / 2, 1);
+	cwnd = std::max<uint32_t>(cwnd / 2, MIN_CONGESTION_WINDOW);
 	inRecovery = true;
 }
 
 void RUDPFlowController::OnTimeout() noexcept
 {
-	cwnd = std::max<uint8_t>(cwnd / 2, 1);
+	cwnd = std::max<uint32_t>(cwnd / 2, MIN_CONGESTION_WINDOW);
 	inRecovery = true;
 }
 
 void RUDPFlowController::Reset() noexcept
 {
-	cwnd = INITIAL_CWND;
+	cwnd = INITIAL_CONGESTION_WINDOW;
 	lastReplySequence = 0;
 	inRecovery = false;
 #ifdef _DEBUG
@@ -1,47 +1,37 @@
 ﻿#pragma once
-#include "../etc/CoreType.h"
-
-class RUDPFlowController
+#include "ICongestionController.h"
+
+// ----------------------------------------
+// @brief NewReno 방식의 기본 혼잡 제어입니다.
+// 새 ACK마다 cwnd를 1씩 늘리고, 손실이나 타임아웃이 감지되면 절반으로 줄인 뒤
+// 다음 ACK 하나는 복구 구간으로 보고 cwnd를 늘리지 않습니다.
+// ----------------------------------------
+class RUDPFlowController final : public ICongestionController
 {
 public:
 	explicit RUDPFlowController();
-	~RUDPFlowController() = default;
+	~RUDPFlowController() override = default;
 
 public:
-	[[nodiscard]]
-	bool CanSendPacket(PacketSequence nextSendSequence, PacketSequence lastAckedSequence) const noexcept;
+	void OnReplyReceived(PacketSequence replySequence) noexcept override;
+	void OnCongestionEvent() noexcept override;
+	void OnTimeout() noexcept override;
 
-	void OnReplyReceived(PacketSequence replySequence) noexcept;
-	void OnCongestionEvent() noexcept;
-	void OnTimeout() noexcept;
-
-	void Reset() noexcept;
+	void Reset() noexcept override;
 
 	[[nodiscard]]
-	uint8_t GetCwnd() const noexcept { return cwnd; }
+	CONGESTION_CONTROL_TYPE GetType() const noexcept override { return CONGESTION_CONTROL_TYPE::NEW_RENO; }
 	[[nodiscard]]
-	PacketSequence GetLastAckedSequence() const noexcept { return lastReplySequence; }
-
-private:
-	// ----------------------------------------
-	// @brief 두 패킷 시퀀스 번호의 차이를 계산합니다.
-	// 시퀀스 번호는 순환하므로, 직접적인 뺄셈이 아닌 흐름 제어 로직에 맞는
-	// 상대적인 차이를 반환하여 순서가 뒤바뀌거나 누락된 패킷을 감지하는 데 사용됩니다.
-	// @param a 첫 번째 패킷 시퀀스.
-	// @param b 두 번째 패킷 시퀀스.
-	// @return 두 시퀀스 번호의 차이.양수면 a가 b보다 나중 시퀀스임을 나타냅니다.
-	// ----------------------------------------
-	static int64_t SeqDiff(PacketSequence a, PacketSequence b) noexcept;
+	uint32_t GetCwnd() const noexcept override { return cwnd; }
+	[[nodiscard]]
+	PacketSequence GetLastAckedSequence() const noexcept override { return lastReplySequence; }
 
 private:
-	uint8_t cwnd{};
+	uint32_t cwnd{};
 	PacketSequence lastReplySequence{};
 	bool inRecovery{};
 
-	static constexpr uint8_t INITIAL_CWND = 4;
-	static constexpr uint8_t MAX_CWND = 250;
-
 #ifdef _DEBUG
-	uint8_t duplicateReplyCount{};
+	uint32_t duplicateReplyCount{};
 #endif
 };
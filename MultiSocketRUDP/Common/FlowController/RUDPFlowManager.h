@@ -1,17 +1,43 @@
 ﻿#pragma once
 #include "RUDPFlowController.h"
+#include "RUDPCubicController.h"
+#include "RUDPBbrLiteController.h"
 #include "RUDPReceiveWindow.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
 
 class RUDPFlowManager
 {
 public:
-	RUDPFlowManager(BYTE recvWindowSize)
-		: flowController()
+	RUDPFlowManager(BYTE recvWindowSize, const CONGESTION_CONTROL_TYPE congestionControlType = CONGESTION_CONTROL_TYPE::NEW_RENO)
+		: flowController(CreateCongestionController(congestionControlType))
 		, receiveWindow(recvWindowSize)
 	{
+		PublishSendState();
 	}
 
 public:
+	// ----------------------------------------
+	// @brief 혼잡 제어 종류에 맞는 구현을 생성합니다. 알 수 없는 값이면 NewReno를 사용합니다.
+	// @param congestionControlType 생성할 혼잡 제어 종류
+	// ----------------------------------------
+	[[nodiscard]]
+	static std::unique_ptr<ICongestionController> CreateCongestionController(const CONGESTION_CONTROL_TYPE congestionControlType)
+	{
+		switch (congestionControlType)
+		{
+		case CONGESTION_CONTROL_TYPE::CUBIC:
+			return std::make_unique<RUDPCubicController>();
+		case CONGESTION_CONTROL_TYPE::BBR_LITE:
+			return std::make_unique<RUDPBbrLiteController>();
+		case CONGESTION_CONTROL_TYPE::NEW_RENO:
+		default:
+			return std::make_unique<RUDPFlowController>();
+		}
+	}
+
+
 	// ----------------------------------------
 	// @brief 수신 윈도우 크기를 동적으로 조절합니다.
 	// @param recvWindowSize 새로운 수신 윈도우 크기
@@ -21,20 +47,84 @@ public:
 		receiveWindow.ResizeRecvWindowSize(recvWindowSize);
 	}
 
+	// ----------------------------------------
+	// @brief 다음 시퀀스를 보내도 게시된 혼잡 윈도우를 넘지 않는지 확인합니다.
+	// 송신 스레드에서 호출되므로 혼잡 제어 구현을 직접 읽지 않고 게시된 값만 사용합니다.
+	// @param nextSend 다음에 보낼 패킷 시퀀스
+	// ----------------------------------------
+	[[nodiscard]]
+	bool CanSend(PacketSequence nextSend) const noexcept
+	{
+		const int64_t diff = static_cast<int64_t>(nextSend - publishedLastAckedSequence.load(std::memory_order_acquire));
+		const int64_t outstanding = diff > 1 ? diff - 1 : 0;
+		return outstanding < static_cast<int64_t>(publishedCwnd.load(std::memory_order_acquire));
+	}
+
+	// ----------------------------------------
+	// @brief ACK 프레임의 누적 시퀀스를 혼잡 제어에 전달합니다.
+	// @param cumulativeSequence 이 시퀀스 이하가 모두 수신되었음을 뜻하는 누적 ACK 시퀀스
+	// ----------------------------------------
+	void OnAckReceived(PacketSequence cumulativeSequence) noexcept
+	{
+		std::scoped_lock lock(congestionLock);
+		flowController->OnReplyReceived(cumulativeSequence);
+		PublishSendState();
+	}
+
 	[[nodiscard]]
-	bool CanSend(PacketSequence nextSend) noexcept
+	PacketSequence GetLastAckedSequence() const noexcept
 	{
-		return flowController.CanSendPacket(nextSend, flowController.GetLastAckedSequence());
+		return publishedLastAckedSequence.load(std::memory_order_acquire);
 	}
 
-	void OnAckReceived(PacketSequence replySeq) noexcept
+	// ----------------------------------------
+	// @brief 세션이 계산한 RTT 샘플을 혼잡 제어에 전달합니다.
+	// @param sample 재전송되지 않은 패킷의 왕복 시간
+	// ----------------------------------------
+	void OnRttSample(const std::chrono::steady_clock::duration sample) noexcept
+	{
+		std::scoped_lock lock(congestionLock);
+		// RFC 6298과 같은 1/8 가중치로 페이싱용 평활 RTT를 따로 유지합니다.
+		if (smoothedRtt == std::chrono::steady_clock::duration::zero())
+		{
+			smoothedRtt = sample;
+		}
+		else
+		{
+			smoothedRtt += (sample - smoothedRtt) / 8;
+		}
+		flowController->OnRttSample(sample);
+		PublishSendState();
+	}
+
+	// ----------------------------------------
+	// @brief 혼잡 제어의 전송률로 계산해 둔 보류 큐 패킷 사이의 송신 간격을 반환합니다.
+	// @return 패킷 사이 간격. 아직 RTT 샘플이 없으면 0이며 페이싱하지 않습니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	std::chrono::steady_clock::duration GetPacingInterval() const noexcept
 	{
-		flowController.OnReplyReceived(replySeq);
+		return std::chrono::steady_clock::duration(publishedPacingInterval.load(std::memory_order_acquire));
 	}
 
+	// ----------------------------------------
+	// @brief 재전송 기한이 지났을 때 혼잡 윈도우를 줄입니다. 재전송 스레드에서 호출됩니다.
+	// ----------------------------------------
 	void OnTimeout() noexcept
 	{
-		flowController.OnTimeout();
+		std::scoped_lock lock(congestionLock);
+		flowController->OnTimeout();
+		PublishSendState();
+	}
+
+	// ----------------------------------------
+	// @brief SACK으로 손실을 감지해 빠른 재전송을 했을 때 혼잡 윈도우를 줄입니다.
+	// ----------------------------------------
+	void OnFastRetransmit() noexcept
+	{
+		std::scoped_lock lock(congestionLock);
+		flowController->OnCongestionEvent();
+		PublishSendState();
 	}
 
 	[[nodiscard]]
@@ -55,21 +145,43 @@ public:
 	}
 
 	[[nodiscard]]
-	uint16_t GetCwnd() const noexcept
+	uint32_t GetCwnd() const noexcept
 	{
-		return flowController.GetCwnd();
+		return publishedCwnd.load(std::memory_order_acquire);
 	}
 
-	void Initialize(const BYTE recvWindowSize) noexcept
+	[[nodiscard]]
+	CONGESTION_CONTROL_TYPE GetCongestionControlType() const noexcept
 	{
+		return flowController->GetType();
+	}
+
+	// ----------------------------------------
+	// @brief 세션 재사용 시 흐름 제어 상태를 초기화합니다.
+	// 혼잡 제어 종류가 바뀐 경우에만 구현을 새로 만듭니다.
+	// @param recvWindowSize 새로운 수신 윈도우 크기
+	// @param congestionControlType 이 세션이 사용할 혼잡 제어 종류
+	// ----------------------------------------
+	void Initialize(const BYTE recvWindowSize, const CONGESTION_CONTROL_TYPE congestionControlType = CONGESTION_CONTROL_TYPE::NEW_RENO)
+	{
+		{
+			std::scoped_lock lock(congestionLock);
+			if (flowController->GetType() != congestionControlType)
+			{
+				flowController = CreateCongestionController(congestionControlType);
+			}
+		}
 		Reset(0);
 		ResizeRecvWindowSize(recvWindowSize);
 	}
 
 	void Reset(const PacketSequence recvStartSequence) noexcept
 	{
-		flowController.Reset();
+		std::scoped_lock lock(congestionLock);
+		flowController->Reset();
 		receiveWindow.Reset(recvStartSequence);
+		smoothedRtt = std::chrono::steady_clock::duration::zero();
+		PublishSendState();
 	}
 
 	[[nodiscard]]
@@ -78,7 +190,37 @@ public:
 		return receiveWindow.GetAdvertiseWindow();
 	}
 
+	void FillAckFrame(OUT RUDPAckFrame& ackFrame) const noexcept
+	{
+		receiveWindow.FillAckFrame(ackFrame);
+	}
+
+private:
+	// ----------------------------------------
+	// @brief 송신 스레드가 읽는 cwnd, 마지막 ACK 시퀀스, 페이싱 간격을 원자 값으로 게시합니다.
+	// congestionLock을 잡은 상태에서 혼잡 제어 상태를 바꾼 직후 호출합니다.
+	// ----------------------------------------
+	void PublishSendState() noexcept
+	{
+		publishedCwnd.store(flowController->GetCwnd(), std::memory_order_release);
+		publishedLastAckedSequence.store(flowController->GetLastAckedSequence(), std::memory_order_release);
+
+		std::chrono::steady_clock::duration pacingInterval = std::chrono::steady_clock::duration::zero();
+		if (const double pacingRate = flowController->GetPacingRate(smoothedRtt); pacingRate > 0)
+		{
+			pacingInterval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / pacingRate));
+		}
+		publishedPacingInterval.store(pacingInterval.count(), std::memory_order_release);
+	}
+
 private:
-	RUDPFlowController flowController;
+	std::unique_ptr<ICongestionController> flowController;
 	RUDPReceiveWindow receiveWindow;
+	std::chrono::steady_clock::duration smoothedRtt{};
+
+	// 혼잡 제어 상태는 수신 로직 스레드(ACK, RTT 샘플)와 재전송 스레드(타임아웃)가 함께 바꿉니다.
+	std::mutex congestionLock;
+	std::atomic<uint32_t> publishedCwnd{};
+	std::atomic<PacketSequence> publishedLastAckedSequence{};
+	std::atomic<std::chrono::steady_clock::rep> publishedPacingInterval{};
 };
@@ -62,6 +62,41 @@ BYTE RUDPReceiveWindow::GetAdvertiseWindow() const noexcept
 	return windowSize - usedCount;
 }
 
+void RUDPReceiveWindow::FillAckFrame(OUT RUDPAckFrame& ackFrame) const noexcept
+{
+	ackFrame.cumulativeSequence = windowStart - 1;
+	ackFrame.advertiseWindow = GetAdvertiseWindow();
+	ackFrame.sackRangeCount = 0;
+
+	if (usedCount == 0)
+	{
+		return;
+	}
+
+	BYTE remainCount = usedCount;
+	BYTE offset = 1;
+	while (remainCount > 0 && offset < windowSize)
+	{
+		if (not receivedFlags[(startIndex + offset) % windowSize])
+		{
+			++offset;
+			continue;
+		}
+
+		const BYTE first = offset;
+		while (offset < windowSize && receivedFlags[(startIndex + offset) % windowSize])
+		{
+			++offset;
+			--remainCount;
+		}
+
+		if (not ackFrame.AddSackRange(windowStart + first, windowStart + offset - 1))
+		{
+			return;
+		}
+	}
+}
+
 int64_t RUDPReceiveWindow::SeqDiff(const PacketSequence a, const PacketSequence b) noexcept
 {
 	return static_cast<int64_t>(a - b);
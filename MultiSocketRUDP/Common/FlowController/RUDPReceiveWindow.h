@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "../etc/CoreType.h"
+#include "RUDPAckFrame.h"
 #include <vector>
 
 class RUDPReceiveWindow
@@ -30,6 +31,14 @@ public:
 	[[nodiscard]]
 	BYTE GetAdvertiseWindow() const noexcept;
 
+	// ----------------------------------------
+	// @brief 현재 수신 상태로 ACK 프레임을 채웁니다.
+	// 누적 시퀀스는 windowStart 직전 시퀀스이며, windowStart 이후 수신된 시퀀스들은 연속 구간으로 묶어 SACK 구간으로 기록합니다.
+	// 구간이 MAX_SACK_RANGE_COUNT를 넘으면 앞쪽 구간만 기록합니다.
+	// @param ackFrame 채울 ACK 프레임
+	// ----------------------------------------
+	void FillAckFrame(OUT RUDPAckFrame& ackFrame) const noexcept;
+
 private:
 	static int64_t SeqDiff(PacketSequence a, PacketSequence b) noexcept;
 
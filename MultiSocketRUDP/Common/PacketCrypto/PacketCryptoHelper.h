@@ -1,6 +1,7 @@
 #pragma once
 #include "NetServerSerializeBuffer.h"
 #include "../Crypto/CryptoHelper.h"
+#include "../FlowController/RUDPAckFrame.h"
 
 class PacketCryptoHelper
 {
@@ -32,13 +33,25 @@ public:
 			return;
 		}
 
+		int piggybackFieldSize = 0;
+		if (not isCorePacket)
+		{
+			piggybackFieldSize = GetPiggybackFieldSize(packet, packet.m_iWrite);
+			if (piggybackFieldSize < 0)
+			{
+				LOG_ERROR("PacketCryptoHelper::EncodePacket() : invalid piggyback ack field");
+				return;
+			}
+		}
+
 		unsigned char authTag[AUTH_TAG_SIZE];
-		const int bodySize = packet.GetUseSize() - (isCorePacket ? bodyOffsetWithNotHeaderForCorePacket : bodyOffsetWithNotHeader);
-		const int bodyOffset = isCorePacket ? bodyOffsetWithHeaderForCorePacket : bodyOffsetWithHeader;
+		const int bodySize = packet.GetUseSize() - (isCorePacket ? bodyOffsetWithNotHeaderForCorePacket : bodyOffsetWithNotHeader) - piggybackFieldSize;
+		const int bodyOffset = (isCorePacket ? bodyOffsetWithHeaderForCorePacket : bodyOffsetWithHeader) + piggybackFieldSize;
 
 		SetHeader(packet, AUTH_TAG_SIZE);
 
-		constexpr size_t aadSize = df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence);
+		// SEND_TYPE의 피기백 ACK 필드는 평문으로 두되 AAD에 포함해 변조를 막습니다.
+		const size_t aadSize = df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence) + piggybackFieldSize;
 		const unsigned char* aad = reinterpret_cast<const unsigned char*>(packet.m_pSerializeBuffer);
 
 		if (not CryptoHelper::EncryptAESGCM(
@@ -78,7 +91,7 @@ public:
 	static bool DecodePacket(OUT NetBuffer& packet, const unsigned char* sessionSalt, const size_t sessionSaltSize, const BCRYPT_KEY_HANDLE& sessionKeyHandle, const bool isCorePacket, const PACKET_DIRECTION direction)
 	{
         // Since the packet type has already been extracted earlier, it is not extracted here
-		constexpr int minimumPacketSize = sizeof(PacketSequence) + sizeof(PacketId) + AUTH_TAG_SIZE;
+		constexpr int minimumPacketSize = sizeof(PacketSequence) + sizeof(BYTE) + sizeof(PacketId) + AUTH_TAG_SIZE;
 		constexpr int minimumCorePacketSize = sizeof(PacketSequence) + AUTH_TAG_SIZE;
 		constexpr int packetSequenceOffset = df_HEADER_SIZE + sizeof(PACKET_TYPE);
 		constexpr int sizeOfHeaderWithPacketType = df_HEADER_SIZE + sizeof(PACKET_TYPE);
@@ -93,13 +106,23 @@ public:
 		PacketSequence packetSequence = 0;
 		memcpy(&packetSequence, &packet.m_pSerializeBuffer[packetSequenceOffset], sizeof(packetSequence));
 
-		const int bodyOffset = isCorePacket ? (df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence)) : (df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence) + sizeof(PacketId));
 		size_t authTagOffset = packet.m_iWrite - AUTH_TAG_SIZE;
+		int piggybackFieldSize = 0;
+		if (not isCorePacket)
+		{
+			piggybackFieldSize = GetPiggybackFieldSize(packet, static_cast<int>(authTagOffset));
+			if (piggybackFieldSize < 0)
+			{
+				return false;
+			}
+		}
+
+		const int bodyOffset = (isCorePacket ? (df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence)) : (df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence) + sizeof(PacketId))) + piggybackFieldSize;
 		size_t bodySize = packetUseSize + sizeOfHeaderWithPacketType - AUTH_TAG_SIZE - bodyOffset;
 
 		const unsigned char* authTag = reinterpret_cast<const unsigned char*>(&packet.m_pSerializeBuffer[authTagOffset]);
 
-		constexpr size_t aadSize = df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence);
+		const size_t aadSize = df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence) + piggybackFieldSize;
 		const unsigned char* aad = reinterpret_cast<const unsigned char*>(packet.m_pSerializeBuffer);
 
 		unsigned char nonce[NONCE_SIZE];
@@ -132,6 +155,20 @@ public:
 	}
 
 private:
+	// ----------------------------------------
+	// @brief SEND_TYPE 패킷의 피기백 ACK 필드 크기를 구합니다.
+	// @param packet 헤더부터 직렬화된 패킷
+	// @param endOffset 필드와 PacketId가 들어 있어야 하는 영역의 끝 위치
+	// @return 필드 크기. PacketId까지 담을 수 없거나 형식이 올바르지 않으면 -1
+	// ----------------------------------------
+	[[nodiscard]]
+	static int GetPiggybackFieldSize(const NetBuffer& packet, const int endOffset)
+	{
+		constexpr int piggybackFieldOffset = df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence);
+		const int availableSize = endOffset - piggybackFieldOffset - static_cast<int>(sizeof(PacketId));
+		return RUDPAckFrame::GetPiggybackFieldSize(&packet.m_pSerializeBuffer[piggybackFieldOffset], availableSize);
+	}
+
 	static PACKET_DIRECTION DetermineDirection(uint8_t packetType)
 	{
 		switch (packetType)
@@ -144,6 +181,13 @@ private:
 		}
 	}
 
+	// ----------------------------------------
+	// @brief 일반 패킷에서 PacketId 뒤 본문에 담을 수 있는 최대 크기입니다.
+	// @details 피기백 ACK 필드가 가장 클 때도 헤더부터 AuthTag까지가 수신 버퍼(RECV_BUFFER_SIZE)를 넘지 않도록 잡습니다.
+	// ----------------------------------------
+	static constexpr size_t MAX_PACKET_BODY_SIZE = static_cast<size_t>(RECV_BUFFER_SIZE)
+		- (df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence) + RUDPAckFrame::MAX_PIGGYBACK_FIELD_SIZE + sizeof(PacketId) + AUTH_TAG_SIZE);
+
 private:
 	static const unsigned int bodyOffsetWithHeader = df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence) + sizeof(PacketId);
 	static const unsigned int bodyOffsetWithHeaderForCorePacket = df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence);
@@ -2,7 +2,18 @@
 #include <cstdint>
 
 constexpr unsigned short MAX_RIO_RESULT = 1024;
+constexpr unsigned int   MAX_DATAGRAM_BATCH_SIZE = 64;
+constexpr unsigned int   MAX_SEND_PACKET_BATCH_SIZE = 64;
 constexpr unsigned int   MAX_SEND_BUFFER_SIZE = 32768;
+constexpr unsigned int   MIN_DATAGRAM_SIZE_BUDGET = 576;
+constexpr unsigned int   DEFAULT_DATAGRAM_SIZE_BUDGET = 1200;
+constexpr unsigned int   MAX_DATAGRAM_SIZE_BUDGET = 9000;
+constexpr unsigned char  MAX_SACK_RANGE_COUNT = 8;
+constexpr unsigned char  FAST_RETRANSMIT_SACK_THRESHOLD = 3;
+constexpr unsigned int   MAX_FAST_RETRANSMIT_PER_ACK = 64;
+constexpr uint32_t       INITIAL_CONGESTION_WINDOW = 4;
+constexpr uint32_t       MIN_CONGESTION_WINDOW = 1;
+constexpr uint32_t       MAX_CONGESTION_WINDOW = 4096;
 constexpr int            RECV_BUFFER_SIZE = 16384;
 constexpr unsigned char  SESSION_KEY_SIZE = 16;
 constexpr unsigned char  SESSION_SALT_SIZE = 16;
@@ -11,3 +22,13 @@ constexpr unsigned int   LOGIC_THREAD_STOP_SLEEP_TIME = 10000;
 constexpr unsigned long  MAX_OUTSTANDING_RECEIVE = 1000;
 constexpr unsigned long  MAX_OUTSTANDING_SEND = 100;
 constexpr unsigned long	 RECV_OUTSTANDING_COUNT = 8;
+constexpr unsigned long	 RECV_MIN_POSTED_SLOT_COUNT = 1;
+constexpr unsigned int   RECV_DEPTH_ADJUST_INTERVAL_MS = 100;
+constexpr unsigned int   RECV_DEPTH_GROW_COMPLETIONS_PER_SLOT = 4;
+constexpr unsigned int   RECV_SLOT_POOL_CHUNK_SIZE = 32;
+constexpr unsigned int   SEND_BUFFER_SLAB_CHUNKS_PER_REGION = 64;
+constexpr unsigned int   CLIENT_ADDRESS_SLOT_SIZE = 32;
+constexpr unsigned int   CLIENT_ADDRESS_SLOTS_PER_REGION = 4096;
+constexpr unsigned int   RECV_IO_COMPLETED_RING_CAPACITY = 65536;
+constexpr unsigned int   RECV_LOGIC_DEQUEUE_BATCH_SIZE = 256;
+constexpr unsigned int   RETRANSMISSION_WHEEL_TICK_MS = 1;
@@ -17,6 +17,8 @@ enum class PACKET_TYPE : unsigned char
 	, SEND_REPLY_TYPE
 	, HEARTBEAT_TYPE
 	, HEARTBEAT_REPLY_TYPE
+	, MTU_PROBE_TYPE
+	, MTU_PROBE_REPLY_TYPE
 };
 
 enum class CONNECT_RESULT_CODE : unsigned char
@@ -65,3 +67,10 @@ enum class DISCONNECT_REASON : uint8_t
 
 	NOT_DISCONNECTED = 255
 };
+
+enum class CONGESTION_CONTROL_TYPE : uint8_t
+{
+	NEW_RENO = 0,
+	CUBIC,
+	BBR_LITE,
+};
@@ -6,5 +6,5 @@ void Player::RegisterAllPacketHandler()
 {
 	RegisterPacketHandler<Player, Ping>(static_cast<PacketId>(PACKET_ID::PING), &Player::OnPing);
 	RegisterPacketHandler<Player, TestPacketReq>(static_cast<PacketId>(PACKET_ID::TEST_PACKET_REQ), &Player::OnTestPacketReq);
-	RegisterPacketHandler<Player, TestStringPacketReq>(static_cast<PacketId>(PACKET_ID::TEST_STRING_PACKET_REQ), &Player::OnTestStringPacketReq);
+	RegisterPacketViewHandler<Player, TestStringPacketReqView>(static_cast<PacketId>(PACKET_ID::TEST_STRING_PACKET_REQ), &Player::OnTestStringPacketReq);
 }
\ No newline at end of file
@@ -30,7 +30,7 @@ private:
 #pragma region Packet Handler
 public:
 	void OnPing(const Ping& packet);
-	void OnTestStringPacketReq(const TestStringPacketReq& packet);
+	void OnTestStringPacketReq(const TestStringPacketReqView& packet);
 	void OnTestPacketReq(const TestPacketReq& packet);
 #pragma endregion Packet Handler
 };
@@ -8,7 +8,7 @@ void Player::OnPing(const Ping& packet)
 	SendPacket(pong);
 }
 
-void Player::OnTestStringPacketReq(const TestStringPacketReq& packet)
+void Player::OnTestStringPacketReq(const TestStringPacketReqView& packet)
 {
 	TestStringPacketRes res;
 	res.echoString = packet.testString;
@@ -7,14 +7,26 @@ PacketId Ping::GetPacketId() const
 {
 	return static_cast<PacketId>(PACKET_ID::PING);
 }
+size_t Ping::GetSerializedSize() const
+{
+	return SERIALIZED_SIZE;
+}
 PacketId Pong::GetPacketId() const
 {
 	return static_cast<PacketId>(PACKET_ID::PONG);
 }
+size_t Pong::GetSerializedSize() const
+{
+	return SERIALIZED_SIZE;
+}
 PacketId TestStringPacketReq::GetPacketId() const
 {
 	return static_cast<PacketId>(PACKET_ID::TEST_STRING_PACKET_REQ);
 }
+size_t TestStringPacketReq::GetSerializedSize() const
+{
+	return sizeof(PacketStringLengthType) + testString.size();
+}
 void TestStringPacketReq::BufferToPacket(NetBuffer& buffer)
 {
 	SetBufferToParameters(buffer, testString);
@@ -23,10 +35,18 @@ void TestStringPacketReq::PacketToBuffer(NetBuffer& buffer)
 {
 	SetParametersToBuffer(buffer, testString);
 }
+bool TestStringPacketReqView::Parse(NetBuffer& buffer)
+{
+	return SetBufferToViewParameters(buffer, testString);
+}
 PacketId TestStringPacketRes::GetPacketId() const
 {
 	return static_cast<PacketId>(PACKET_ID::TEST_STRING_PACKET_RES);
 }
+size_t TestStringPacketRes::GetSerializedSize() const
+{
+	return sizeof(PacketStringLengthType) + echoString.size();
+}
 void TestStringPacketRes::BufferToPacket(NetBuffer& buffer)
 {
 	SetBufferToParameters(buffer, echoString);
@@ -35,10 +55,18 @@ void TestStringPacketRes::PacketToBuffer(NetBuffer& buffer)
 {
 	SetParametersToBuffer(buffer, echoString);
 }
+bool TestStringPacketResView::Parse(NetBuffer& buffer)
+{
+	return SetBufferToViewParameters(buffer, echoString);
+}
 PacketId TestPacketReq::GetPacketId() const
 {
 	return static_cast<PacketId>(PACKET_ID::TEST_PACKET_REQ);
 }
+size_t TestPacketReq::GetSerializedSize() const
+{
+	return SERIALIZED_SIZE;
+}
 void TestPacketReq::BufferToPacket(NetBuffer& buffer)
 {
 	SetBufferToParameters(buffer, order);
@@ -47,10 +75,18 @@ void TestPacketReq::PacketToBuffer(NetBuffer& buffer)
 {
 	SetParametersToBuffer(buffer, order);
 }
+bool TestPacketReqView::Parse(NetBuffer& buffer)
+{
+	return SetBufferToViewParameters(buffer, order);
+}
 PacketId TestPacketRes::GetPacketId() const
 {
 	return static_cast<PacketId>(PACKET_ID::TEST_PACKET_RES);
 }
+size_t TestPacketRes::GetSerializedSize() const
+{
+	return SERIALIZED_SIZE;
+}
 void TestPacketRes::BufferToPacket(NetBuffer& buffer)
 {
 	SetBufferToParameters(buffer, order);
@@ -59,4 +95,8 @@ void TestPacketRes::PacketToBuffer(NetBuffer& buffer)
 {
 	SetParametersToBuffer(buffer, order);
 }
+bool TestPacketResView::Parse(NetBuffer& buffer)
+{
+	return SetBufferToViewParameters(buffer, order);
+}
 #pragma endregion packet function
\ No newline at end of file
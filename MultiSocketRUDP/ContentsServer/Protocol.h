@@ -1,8 +1,10 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "NetServerSerializeBuffer.h"
 #include "../MultiSocketRUDPServer/PacketManager.h"
+#include "../MultiSocketRUDPServer/PacketViewReader.h"
 
 ////////////////////////////////////////////////////////////////////////////////////
 // Packet id type
@@ -59,9 +61,14 @@ public:
 	Ping() = default;
 	~Ping() override = default;
 
+public:
+	static constexpr size_t SERIALIZED_SIZE = 0;
+
 public:
 	[[nodiscard]]
 	PacketId GetPacketId() const override;
+	[[nodiscard]]
+	size_t GetSerializedSize() const override;
 };
 
 class Pong final : public IPacket
@@ -70,9 +77,14 @@ public:
 	Pong() = default;
 	~Pong() override = default;
 
+public:
+	static constexpr size_t SERIALIZED_SIZE = 0;
+
 public:
 	[[nodiscard]]
 	PacketId GetPacketId() const override;
+	[[nodiscard]]
+	size_t GetSerializedSize() const override;
 };
 
 class TestStringPacketReq final : public IPacket
@@ -84,6 +96,8 @@ public:
 public:
 	[[nodiscard]]
 	PacketId GetPacketId() const override;
+	[[nodiscard]]
+	size_t GetSerializedSize() const override;
 	void BufferToPacket(NetBuffer& buffer) override;
 	void PacketToBuffer(NetBuffer& buffer) override;
 
@@ -91,6 +105,16 @@ public:
 	std::string testString;
 };
 
+class TestStringPacketReqView final
+{
+public:
+	[[nodiscard]]
+	bool Parse(NetBuffer& buffer);
+
+public:
+	std::string_view testString{};
+};
+
 class TestStringPacketRes final : public IPacket
 {
 public:
@@ -100,6 +124,8 @@ public:
 public:
 	[[nodiscard]]
 	PacketId GetPacketId() const override;
+	[[nodiscard]]
+	size_t GetSerializedSize() const override;
 	void BufferToPacket(NetBuffer& buffer) override;
 	void PacketToBuffer(NetBuffer& buffer) override;
 
@@ -107,15 +133,30 @@ public:
 	std::string echoString;
 };
 
+class TestStringPacketResView final
+{
+public:
+	[[nodiscard]]
+	bool Parse(NetBuffer& buffer);
+
+public:
+	std::string_view echoString{};
+};
+
 class TestPacketReq final : public IPacket
 {
 public:
 	TestPacketReq() = default;
 	~TestPacketReq() override = default;
 
+public:
+	static constexpr size_t SERIALIZED_SIZE = sizeof(int);
+
 public:
 	[[nodiscard]]
 	PacketId GetPacketId() const override;
+	[[nodiscard]]
+	size_t GetSerializedSize() const override;
 	void BufferToPacket(NetBuffer& buffer) override;
 	void PacketToBuffer(NetBuffer& buffer) override;
 
@@ -123,15 +164,30 @@ public:
 	int order;
 };
 
+class TestPacketReqView final
+{
+public:
+	[[nodiscard]]
+	bool Parse(NetBuffer& buffer);
+
+public:
+	int order{};
+};
+
 class TestPacketRes final : public IPacket
 {
 public:
 	TestPacketRes() = default;
 	~TestPacketRes() override = default;
 
+public:
+	static constexpr size_t SERIALIZED_SIZE = sizeof(int);
+
 public:
 	[[nodiscard]]
 	PacketId GetPacketId() const override;
+	[[nodiscard]]
+	size_t GetSerializedSize() const override;
 	void BufferToPacket(NetBuffer& buffer) override;
 	void PacketToBuffer(NetBuffer& buffer) override;
 
@@ -139,6 +195,16 @@ public:
 	int order;
 };
 
+class TestPacketResView final
+{
+public:
+	[[nodiscard]]
+	bool Parse(NetBuffer& buffer);
+
+public:
+	int order{};
+};
+
 #pragma pack(pop)
 
 ////////////////////////////////////////////////////////////////////////////////////
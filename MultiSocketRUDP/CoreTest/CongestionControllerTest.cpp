@@ -0,0 +1,209 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "../Common/FlowController/RUDPFlowManager.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	const std::chrono::steady_clock::time_point baseTime = std::chrono::steady_clock::time_point{} + 1h;
+}
+
+class RUDPCubicControllerTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		cubic.Reset();
+	}
+
+	// 1ms마다 패킷 하나씩 ACK하며 duration 만큼 시간을 흘려 보냅니다.
+	void AckEveryMillisecond(const std::chrono::milliseconds duration)
+	{
+		for (auto elapsed = 0ms; elapsed < duration; elapsed += 1ms)
+		{
+			now += 1ms;
+			cubic.OnReplyReceived(cubic.GetLastAckedSequence() + 1, now);
+		}
+	}
+
+	RUDPCubicController cubic;
+	std::chrono::steady_clock::time_point now = baseTime;
+};
+
+TEST_F(RUDPCubicControllerTest, SlowStartGrowsByAckedPacketCount)
+{
+	cubic.OnReplyReceived(3, now);
+
+	EXPECT_EQ(cubic.GetCwnd(), INITIAL_CONGESTION_WINDOW + 3);
+	EXPECT_EQ(cubic.GetLastAckedSequence(), 3);
+}
+
+TEST_F(RUDPCubicControllerTest, CongestionEventAppliesBetaAndEndsSlowStart)
+{
+	cubic.OnReplyReceived(96, now);
+	ASSERT_EQ(cubic.GetCwnd(), 100u);
+
+	cubic.OnCongestionEvent();
+
+	EXPECT_EQ(cubic.GetCwnd(), 70u);
+	EXPECT_EQ(cubic.GetSlowStartThreshold(), 70u);
+}
+
+TEST_F(RUDPCubicControllerTest, WindowPlateausNearPreviousMaximumThenProbesBeyondIt)
+{
+	cubic.OnReplyReceived(96, now);
+	cubic.OnCongestionEvent();
+
+	// K = cbrt((100 - 70) / 0.4) ≒ 4.2초 부근에서 이전 최대 윈도우로 돌아옵니다.
+	AckEveryMillisecond(4000ms);
+	EXPECT_GT(cubic.GetCwnd(), 90u);
+	EXPECT_LE(cubic.GetCwnd(), 100u);
+
+	AckEveryMillisecond(4000ms);
+	EXPECT_GT(cubic.GetCwnd(), 110u);
+}
+
+TEST_F(RUDPCubicControllerTest, TimeoutCollapsesWindowAndSlowStartsUpToThreshold)
+{
+	cubic.OnReplyReceived(96, now);
+	cubic.OnTimeout();
+
+	EXPECT_EQ(cubic.GetCwnd(), MIN_CONGESTION_WINDOW);
+	EXPECT_EQ(cubic.GetSlowStartThreshold(), 70u);
+
+	cubic.OnReplyReceived(cubic.GetLastAckedSequence() + 10, now);
+	EXPECT_EQ(cubic.GetCwnd(), MIN_CONGESTION_WINDOW + 10);
+}
+
+TEST_F(RUDPCubicControllerTest, DuplicateReplyDoesNotChangeWindow)
+{
+	cubic.OnReplyReceived(5, now);
+	const uint32_t cwndAfterFirst = cubic.GetCwnd();
+
+	cubic.OnReplyReceived(5, now);
+	cubic.OnReplyReceived(2, now);
+
+	EXPECT_EQ(cubic.GetCwnd(), cwndAfterFirst);
+}
+
+class RUDPBbrLiteControllerTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		bbr.Reset();
+	}
+
+	// 1ms마다 packetsPerMs개씩 ACK해 일정한 전달률을 흉내 냅니다.
+	void DeliverAtConstantRate(const uint32_t packetsPerMs, const std::chrono::milliseconds duration)
+	{
+		for (auto elapsed = 0ms; elapsed < duration; elapsed += 1ms)
+		{
+			now += 1ms;
+			bbr.OnReplyReceived(bbr.GetLastAckedSequence() + packetsPerMs, now);
+		}
+	}
+
+	RUDPBbrLiteController bbr;
+	std::chrono::steady_clock::time_point now = baseTime;
+};
+
+TEST_F(RUDPBbrLiteControllerTest, GrowsLikeSlowStartUntilModelExists)
+{
+	bbr.OnReplyReceived(4, now);
+
+	EXPECT_EQ(bbr.GetCwnd(), INITIAL_CONGESTION_WINDOW + 4);
+	EXPECT_EQ(bbr.GetBottleneckBandwidth(), 0.0);
+}
+
+TEST_F(RUDPBbrLiteControllerTest, WindowConvergesToTwiceBandwidthDelayProduct)
+{
+	bbr.OnRttSample(10ms, now);
+	DeliverAtConstantRate(10, 200ms);
+
+	// 10 packet/ms * 10ms = BDP 100 packet, 파이프가 찬 뒤 이득은 2입니다.
+	EXPECT_TRUE(bbr.IsPipeFilled());
+	EXPECT_NEAR(bbr.GetBottleneckBandwidth(), 10000.0, 1.0);
+	EXPECT_EQ(bbr.GetCwnd(), 200u);
+}
+
+TEST_F(RUDPBbrLiteControllerTest, LossDoesNotShrinkWindowBelowModel)
+{
+	bbr.OnRttSample(10ms, now);
+	DeliverAtConstantRate(10, 200ms);
+	const uint32_t cwndBeforeLoss = bbr.GetCwnd();
+
+	bbr.OnCongestionEvent();
+
+	EXPECT_EQ(bbr.GetCwnd(), cwndBeforeLoss);
+}
+
+TEST_F(RUDPBbrLiteControllerTest, TimeoutCollapsesWindowAndRegrowsToModel)
+{
+	bbr.OnRttSample(10ms, now);
+	DeliverAtConstantRate(10, 200ms);
+
+	bbr.OnTimeout();
+	EXPECT_EQ(bbr.GetCwnd(), MIN_CONGESTION_WINDOW);
+
+	DeliverAtConstantRate(10, 50ms);
+	EXPECT_EQ(bbr.GetCwnd(), 200u);
+}
+
+TEST_F(RUDPBbrLiteControllerTest, StaleMinRttIsReplacedByNewerSample)
+{
+	bbr.OnRttSample(10ms, now);
+	bbr.OnRttSample(20ms, now + 1s);
+	EXPECT_EQ(bbr.GetMinRtt(), std::chrono::steady_clock::duration{ 10ms });
+
+	bbr.OnRttSample(20ms, now + 11s);
+	EXPECT_EQ(bbr.GetMinRtt(), std::chrono::steady_clock::duration{ 20ms });
+}
+
+TEST(CongestionControllerPacingTest, FlowManagerSpreadsWindowAcrossSmoothedRtt)
+{
+	RUDPFlowManager flowManager{ 16 };
+	EXPECT_EQ(flowManager.GetPacingInterval(), std::chrono::steady_clock::duration::zero());
+
+	flowManager.OnRttSample(10ms);
+
+	// cwnd 4개를 10ms의 1/1.25 안에 나누어 보내므로 간격은 2ms입니다.
+	const auto pacingInterval = std::chrono::duration_cast<std::chrono::microseconds>(flowManager.GetPacingInterval());
+	EXPECT_NEAR(static_cast<double>(pacingInterval.count()), 2000.0, 1.0);
+
+	flowManager.Reset(0);
+	EXPECT_EQ(flowManager.GetPacingInterval(), std::chrono::steady_clock::duration::zero());
+}
+
+TEST(CongestionControllerPacingTest, BbrLitePacesAtMeasuredBandwidth)
+{
+	RUDPBbrLiteController bbr;
+	std::chrono::steady_clock::time_point now = baseTime;
+	bbr.OnRttSample(10ms, now);
+	for (int i = 0; i < 200; ++i)
+	{
+		now += 1ms;
+		bbr.OnReplyReceived(bbr.GetLastAckedSequence() + 10, now);
+	}
+	ASSERT_TRUE(bbr.IsPipeFilled());
+
+	// 측정 전달률 10000 packet/s에 1.25배 이득을 줍니다. 평활 RTT와는 무관합니다.
+	EXPECT_NEAR(bbr.GetPacingRate(50ms), 12500.0, 1.0);
+}
+
+TEST(CongestionControllerSelectionTest, FlowManagerCreatesRequestedController)
+{
+	RUDPFlowManager flowManager{ 16 };
+	EXPECT_EQ(flowManager.GetCongestionControlType(), CONGESTION_CONTROL_TYPE::NEW_RENO);
+
+	flowManager.Initialize(16, CONGESTION_CONTROL_TYPE::CUBIC);
+	EXPECT_EQ(flowManager.GetCongestionControlType(), CONGESTION_CONTROL_TYPE::CUBIC);
+	EXPECT_EQ(flowManager.GetCwnd(), INITIAL_CONGESTION_WINDOW);
+
+	flowManager.Initialize(16, CONGESTION_CONTROL_TYPE::BBR_LITE);
+	EXPECT_EQ(flowManager.GetCongestionControlType(), CONGESTION_CONTROL_TYPE::BBR_LITE);
+
+	flowManager.Initialize(16, CONGESTION_CONTROL_TYPE::NEW_RENO);
+	EXPECT_EQ(flowManager.GetCongestionControlType(), CONGESTION_CONTROL_TYPE::NEW_RENO);
+}
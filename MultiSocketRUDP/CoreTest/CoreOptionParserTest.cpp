@@ -79,6 +79,25 @@ namespace
 		text.erase(eraseStart, eraseEnd - eraseStart);
 	}
 
+	std::wstring InsertDatagramSizeOptions(
+		std::wstring options,
+		const unsigned int datagramSizeBudget,
+		const unsigned int maxProbeDatagramSize)
+	{
+		const std::wstring anchor = L"\tMAX_HOLDING_PACKET_QUEUE_SIZE = 16\n";
+		const size_t anchorPosition = options.find(anchor);
+		if (anchorPosition == std::wstring::npos)
+		{
+			return options;
+		}
+
+		options.insert(
+			anchorPosition + anchor.size(),
+			L"\tDATAGRAM_SIZE_BUDGET = " + std::to_wstring(datagramSizeBudget) + L"\n"
+			L"\tMAX_PROBE_DATAGRAM_SIZE = " + std::to_wstring(maxProbeDatagramSize) + L"\n");
+		return options;
+	}
+
 	bool WriteUtf16File(const std::filesystem::path& path, const std::wstring& contents)
 	{
 		std::ofstream stream(path, std::ios::binary | std::ios::trunc);
@@ -179,6 +198,132 @@ TEST_F(CoreOptionParserTest, MissingOptionalRtoBoundsUseInitialRtoAndLossOptions
 	EXPECT_EQ(core.GetMaxRetransmissionMs(), 30u);
 	EXPECT_EQ(MultiSocketRUDPCoreTestAccess::GetSimulatedPacketLossPercent(core), 0u);
 	EXPECT_EQ(MultiSocketRUDPCoreTestAccess::GetSimulatedPacketLossSeed(core), 0);
+	EXPECT_EQ(core.GetDatagramSizeBudget(), DEFAULT_DATAGRAM_SIZE_BUDGET);
+	EXPECT_EQ(core.GetMaxProbeDatagramSize(), DEFAULT_DATAGRAM_SIZE_BUDGET);
+	EXPECT_EQ(core.GetDelayedAckPacketCount(), 1);
+	EXPECT_EQ(core.GetDelayedAckTimeoutMs(), 0u);
+	EXPECT_EQ(core.GetCongestionControlType(), CONGESTION_CONTROL_TYPE::NEW_RENO);
+	EXPECT_FALSE(core.IsSendPacingEnabled());
+	EXPECT_FALSE(core.IsZeroCopyRecvEnabled());
+}
+
+TEST_F(CoreOptionParserTest, DatagramSizeOptionsArePopulated)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+
+	ASSERT_TRUE(Parse(core, InsertDatagramSizeOptions(MakeCoreOptions(), 1200, 1472), MakeBrokerOptions()));
+	EXPECT_EQ(core.GetDatagramSizeBudget(), 1200u);
+	EXPECT_EQ(core.GetMaxProbeDatagramSize(), 1472u);
+}
+
+TEST_F(CoreOptionParserTest, SendPacingOptionIsPopulated)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	std::wstring options = MakeCoreOptions();
+	const std::wstring anchor = L"\tMAX_HOLDING_PACKET_QUEUE_SIZE = 16\n";
+	const size_t anchorPosition = options.find(anchor);
+	ASSERT_NE(anchorPosition, std::wstring::npos);
+	options.insert(anchorPosition + anchor.size(), L"\tUSE_SEND_PACING = 1\n");
+
+	ASSERT_TRUE(Parse(core, options, MakeBrokerOptions()));
+	EXPECT_TRUE(core.IsSendPacingEnabled());
+}
+
+TEST_F(CoreOptionParserTest, ZeroCopyRecvOptionIsPopulated)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	std::wstring options = MakeCoreOptions();
+	const std::wstring anchor = L"\tMAX_HOLDING_PACKET_QUEUE_SIZE = 16\n";
+	const size_t anchorPosition = options.find(anchor);
+	ASSERT_NE(anchorPosition, std::wstring::npos);
+	options.insert(anchorPosition + anchor.size(), L"\tUSE_ZERO_COPY_RECV = 1\n");
+
+	ASSERT_TRUE(Parse(core, options, MakeBrokerOptions()));
+	EXPECT_TRUE(core.IsZeroCopyRecvEnabled());
+}
+
+TEST_F(CoreOptionParserTest, DelayedAckOptionsArePopulated)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	std::wstring options = MakeCoreOptions();
+	const std::wstring anchor = L"\tMAX_HOLDING_PACKET_QUEUE_SIZE = 16\n";
+	const size_t anchorPosition = options.find(anchor);
+	ASSERT_NE(anchorPosition, std::wstring::npos);
+	options.insert(anchorPosition + anchor.size(), L"\tDELAYED_ACK_PACKET_COUNT = 4\n\tDELAYED_ACK_TIMEOUT_MS = 10\n");
+
+	ASSERT_TRUE(Parse(core, options, MakeBrokerOptions()));
+	EXPECT_EQ(core.GetDelayedAckPacketCount(), 4);
+	EXPECT_EQ(core.GetDelayedAckTimeoutMs(), 10u);
+}
+
+TEST_F(CoreOptionParserTest, DelayedAckTimeoutNotBelowMinimumRtoIsRejected)
+{
+	const std::array invalidOptions{
+		std::wstring{ L"\tDELAYED_ACK_PACKET_COUNT = 0\n\tDELAYED_ACK_TIMEOUT_MS = 10\n" },
+		std::wstring{ L"\tDELAYED_ACK_PACKET_COUNT = 2\n\tDELAYED_ACK_TIMEOUT_MS = 16\n" }
+	};
+
+	for (const auto& delayedAckOptions : invalidOptions)
+	{
+		MultiSocketRUDPCore core{ L"", L"" };
+		std::wstring options = MakeCoreOptions();
+		const std::wstring anchor = L"\tMAX_HOLDING_PACKET_QUEUE_SIZE = 16\n";
+		const size_t anchorPosition = options.find(anchor);
+		ASSERT_NE(anchorPosition, std::wstring::npos);
+		options.insert(anchorPosition + anchor.size(), delayedAckOptions);
+
+		EXPECT_FALSE(Parse(core, options, MakeBrokerOptions()));
+	}
+}
+
+TEST_F(CoreOptionParserTest, CongestionControlOptionSelectsController)
+{
+	const std::array congestionControlOptions{
+		std::tuple{ std::wstring{ L"NEW_RENO" }, CONGESTION_CONTROL_TYPE::NEW_RENO },
+		std::tuple{ std::wstring{ L"CUBIC" }, CONGESTION_CONTROL_TYPE::CUBIC },
+		std::tuple{ std::wstring{ L"BBR_LITE" }, CONGESTION_CONTROL_TYPE::BBR_LITE }
+	};
+
+	for (const auto& [name, expectedType] : congestionControlOptions)
+	{
+		MultiSocketRUDPCore core{ L"", L"" };
+		std::wstring options = MakeCoreOptions();
+		const std::wstring anchor = L"\tMAX_HOLDING_PACKET_QUEUE_SIZE = 16\n";
+		const size_t anchorPosition = options.find(anchor);
+		ASSERT_NE(anchorPosition, std::wstring::npos);
+		options.insert(anchorPosition + anchor.size(), L"\tCONGESTION_CONTROL = \"" + name + L"\"\n");
+
+		ASSERT_TRUE(Parse(core, options, MakeBrokerOptions()));
+		EXPECT_EQ(core.GetCongestionControlType(), expectedType);
+	}
+}
+
+TEST_F(CoreOptionParserTest, UnknownCongestionControlIsRejected)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	std::wstring options = MakeCoreOptions();
+	const std::wstring anchor = L"\tMAX_HOLDING_PACKET_QUEUE_SIZE = 16\n";
+	const size_t anchorPosition = options.find(anchor);
+	ASSERT_NE(anchorPosition, std::wstring::npos);
+	options.insert(anchorPosition + anchor.size(), L"\tCONGESTION_CONTROL = \"VEGAS\"\n");
+
+	EXPECT_FALSE(Parse(core, options, MakeBrokerOptions()));
+}
+
+TEST_F(CoreOptionParserTest, InvalidDatagramSizeRangeIsRejected)
+{
+	const std::array invalidSizes{
+		std::tuple{ MIN_DATAGRAM_SIZE_BUDGET - 1, 1472u },
+		std::tuple{ 1400u, 1200u },
+		std::tuple{ 1200u, MAX_DATAGRAM_SIZE_BUDGET + 1 }
+	};
+
+	for (const auto& [budget, maxProbe] : invalidSizes)
+	{
+		MultiSocketRUDPCore core{ L"", L"" };
+		EXPECT_FALSE(Parse(core, InsertDatagramSizeOptions(MakeCoreOptions(), budget, maxProbe), MakeBrokerOptions()))
+			<< "budget=" << budget << ", maxProbe=" << maxProbe;
+	}
 }
 
 TEST_F(CoreOptionParserTest, OnlyOneOptionalRtoBoundIsRejected)
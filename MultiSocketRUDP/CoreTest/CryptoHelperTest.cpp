@@ -151,13 +151,15 @@ namespace
 		packet >> packetType;
 	}
 
-	NetBuffer MakeDataPacket(const PacketSequence sequence, const std::string& payload)
+	NetBuffer MakeDataPacket(const PacketSequence sequence, const std::string& payload, const RUDPAckFrame* ackFrame = nullptr)
 	{
 		NetBuffer packet;
 		packet.Init();
 		PACKET_TYPE type = PACKET_TYPE::SEND_TYPE;
 		PacketId packetId = 77;
-		packet << type << sequence << packetId << payload;
+		packet << type << sequence;
+		RUDPAckFrame::WritePiggybackField(packet, ackFrame);
+		packet << packetId << payload;
 		return packet;
 	}
 
@@ -191,12 +193,60 @@ TEST_F(PacketCryptoTest, DataPacket_RoundTripPreservesPayload)
 	PacketSequence decodedSequence{};
 	PacketId decodedId{};
 	std::string decodedPayload;
-	packet >> decodedSequence >> decodedId >> decodedPayload;
+	RUDPAckFrame decodedAckFrame;
+	bool hasAckFrame = true;
+	packet >> decodedSequence;
+	ASSERT_TRUE(RUDPAckFrame::ReadPiggybackField(packet, decodedAckFrame, hasAckFrame));
+	packet >> decodedId >> decodedPayload;
 	EXPECT_EQ(decodedSequence, sequence);
+	EXPECT_FALSE(hasAckFrame);
 	EXPECT_EQ(decodedId, 77u);
 	EXPECT_EQ(decodedPayload, "encrypted-payload");
 }
 
+TEST_F(PacketCryptoTest, DataPacket_PiggybackAckRoundTripsAndIsAuthenticated)
+{
+	constexpr PacketSequence sequence = 43;
+	RUDPAckFrame ackFrame;
+	ackFrame.cumulativeSequence = 100;
+	ackFrame.advertiseWindow = 16;
+	ASSERT_TRUE(ackFrame.AddSackRange(103, 105));
+
+	auto packet = MakeDataPacket(sequence, "with-ack", &ackFrame);
+	PacketCryptoHelper::EncodePacket(packet, sequence, PACKET_DIRECTION::SERVER_TO_CLIENT,
+		salt.data(), salt.size(), key.Get(), false);
+	AdvanceToPacketBody(packet);
+	ASSERT_TRUE(PacketCryptoHelper::DecodePacket(packet, salt.data(), salt.size(), key.Get(), false,
+		PACKET_DIRECTION::SERVER_TO_CLIENT));
+
+	PacketSequence decodedSequence{};
+	PacketId decodedId{};
+	std::string decodedPayload;
+	RUDPAckFrame decodedAckFrame;
+	bool hasAckFrame = false;
+	packet >> decodedSequence;
+	ASSERT_TRUE(RUDPAckFrame::ReadPiggybackField(packet, decodedAckFrame, hasAckFrame));
+	packet >> decodedId >> decodedPayload;
+	ASSERT_TRUE(hasAckFrame);
+	EXPECT_EQ(decodedAckFrame.cumulativeSequence, 100u);
+	EXPECT_EQ(decodedAckFrame.advertiseWindow, 16);
+	ASSERT_EQ(decodedAckFrame.sackRangeCount, 1);
+	EXPECT_EQ(decodedAckFrame.sackRanges[0].first, 103u);
+	EXPECT_EQ(decodedAckFrame.sackRanges[0].last, 105u);
+	EXPECT_EQ(decodedId, 77u);
+	EXPECT_EQ(decodedPayload, "with-ack");
+
+	// 피기백 ACK 필드는 평문이지만 AAD로 인증되므로 누적 시퀀스를 바꾸면 복호화에 실패해야 합니다.
+	auto tampered = MakeDataPacket(sequence, "with-ack", &ackFrame);
+	PacketCryptoHelper::EncodePacket(tampered, sequence, PACKET_DIRECTION::SERVER_TO_CLIENT,
+		salt.data(), salt.size(), key.Get(), false);
+	constexpr int cumulativeSequenceOffset = df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence) + sizeof(BYTE);
+	tampered.GetReadBufferPtr()[cumulativeSequenceOffset] ^= 0x01;
+	AdvanceToPacketBody(tampered);
+	EXPECT_FALSE(PacketCryptoHelper::DecodePacket(tampered, salt.data(), salt.size(), key.Get(), false,
+		PACKET_DIRECTION::SERVER_TO_CLIENT));
+}
+
 TEST_F(PacketCryptoTest, CorePacket_EmptyBodyRoundTripSucceedsAtSequenceBoundaries)
 {
 	constexpr PacketSequence maxSequence = (std::numeric_limits<PacketSequence>::max)();
@@ -273,7 +323,7 @@ TEST(CryptoHelperTest, FillNonceRejectsInvalidArguments)
 TEST_F(PacketCryptoTest, AesGcmMatchesCppCSharpGoldenVectors)
 {
 	const auto testVectors = LoadProtocolInteropVectors();
-	ASSERT_EQ(testVectors.size(), 8u);
+	ASSERT_EQ(testVectors.size(), 10u);
 
 	for (const auto& testVector : testVectors)
 	{
@@ -292,6 +342,7 @@ TEST_F(PacketCryptoTest, AesGcmMatchesCppCSharpGoldenVectors)
 		if (not testVector.isCorePacket)
 		{
 			ASSERT_TRUE(testVector.packetId.has_value());
+			RUDPAckFrame::WritePiggybackField(packet, nullptr);
 			packet << *testVector.packetId;
 		}
 		if (not testVector.plaintext.empty())
@@ -318,6 +369,10 @@ TEST_F(PacketCryptoTest, AesGcmMatchesCppCSharpGoldenVectors)
 		EXPECT_EQ(decodedSequence, testVector.sequence);
 		if (not testVector.isCorePacket)
 		{
+			RUDPAckFrame decodedAckFrame;
+			bool hasAckFrame = true;
+			ASSERT_TRUE(RUDPAckFrame::ReadPiggybackField(packet, decodedAckFrame, hasAckFrame));
+			EXPECT_FALSE(hasAckFrame);
 			PacketId decodedPacketId{};
 			packet >> decodedPacketId;
 			EXPECT_EQ(decodedPacketId, *testVector.packetId);
@@ -328,5 +383,24 @@ TEST_F(PacketCryptoTest, AesGcmMatchesCppCSharpGoldenVectors)
 			packet.ReadBuffer(reinterpret_cast<char*>(decodedPlaintext.data()), static_cast<int>(decodedPlaintext.size()));
 		}
 		EXPECT_EQ(decodedPlaintext, testVector.plaintext);
+
+		// A core SEND_REPLY_TYPE packet carries an ACK frame body; both sides must agree on its layout.
+		if (testVector.isCorePacket && testVector.packetType == PACKET_TYPE::SEND_REPLY_TYPE)
+		{
+			NetBuffer frameBuffer;
+			frameBuffer.WriteBuffer(testVector.plaintext.data(), static_cast<int>(testVector.plaintext.size()));
+			RUDPAckFrame ackFrame;
+			ASSERT_TRUE(ackFrame.ReadFrom(frameBuffer));
+			EXPECT_NE(testVector.sequence & RUDPAckFrame::REPLY_SEQUENCE_FLAG, 0u);
+
+			NetBuffer rewritten;
+			ackFrame.WriteTo(rewritten);
+			ASSERT_EQ(rewritten.GetUseSize(), testVector.plaintext.size());
+			EXPECT_TRUE(std::equal(testVector.plaintext.begin(), testVector.plaintext.end(), rewritten.GetReadBufferPtr(),
+				[](const unsigned char expected, const char actual)
+				{
+					return expected == static_cast<unsigned char>(actual);
+				}));
+		}
 	}
 }
@@ -0,0 +1,101 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "DelayedAckTracker.h"
+
+// ============================================================
+// 지연 ACK 정책
+//
+// 순서대로 도착한 패킷은 N개가 쌓이거나 첫 패킷 이후 T ms가 지나면 한 번에 응답합니다.
+// 첫 패킷에서만 예약을 요청하므로 logic worker 큐에는 지연 구간마다 하나의 항목만 쌓입니다.
+// ============================================================
+
+namespace
+{
+	constexpr BYTE ACK_EVERY_PACKET_COUNT = 3;
+	constexpr unsigned int ACK_DELAY_MS = 10;
+}
+
+TEST(DelayedAckTrackerTest, DefaultConfiguration_SendsEveryPacketImmediately)
+{
+	DelayedAckTracker tracker;
+
+	EXPECT_EQ(tracker.OnInOrderPacket(0), DELAYED_ACK_ACTION::SEND_NOW);
+	EXPECT_EQ(tracker.OnInOrderPacket(1), DELAYED_ACK_ACTION::SEND_NOW);
+	EXPECT_FALSE(tracker.HasPendingAck());
+}
+
+TEST(DelayedAckTrackerTest, ZeroDelay_DisablesDelayedAck)
+{
+	DelayedAckTracker tracker;
+	tracker.Configure(ACK_EVERY_PACKET_COUNT, 0);
+
+	EXPECT_EQ(tracker.OnInOrderPacket(0), DELAYED_ACK_ACTION::SEND_NOW);
+	EXPECT_FALSE(tracker.HasPendingAck());
+}
+
+TEST(DelayedAckTrackerTest, FirstPacket_SchedulesDeadlineAndLaterPacketsJoinIt)
+{
+	DelayedAckTracker tracker;
+	tracker.Configure(ACK_EVERY_PACKET_COUNT, ACK_DELAY_MS);
+
+	EXPECT_EQ(tracker.OnInOrderPacket(100), DELAYED_ACK_ACTION::SCHEDULE);
+	EXPECT_EQ(tracker.GetAckDeadline(), 100 + ACK_DELAY_MS);
+	EXPECT_EQ(tracker.OnInOrderPacket(105), DELAYED_ACK_ACTION::ALREADY_SCHEDULED);
+	EXPECT_EQ(tracker.GetAckDeadline(), 100 + ACK_DELAY_MS);
+	EXPECT_TRUE(tracker.HasPendingAck());
+}
+
+TEST(DelayedAckTrackerTest, PacketCountReached_SendsNowAndClearsPending)
+{
+	DelayedAckTracker tracker;
+	tracker.Configure(ACK_EVERY_PACKET_COUNT, ACK_DELAY_MS);
+
+	EXPECT_EQ(tracker.OnInOrderPacket(0), DELAYED_ACK_ACTION::SCHEDULE);
+	EXPECT_EQ(tracker.OnInOrderPacket(0), DELAYED_ACK_ACTION::ALREADY_SCHEDULED);
+	EXPECT_EQ(tracker.OnInOrderPacket(0), DELAYED_ACK_ACTION::SEND_NOW);
+	EXPECT_FALSE(tracker.HasPendingAck());
+	EXPECT_FALSE(tracker.IsAckDue(ACK_DELAY_MS));
+}
+
+TEST(DelayedAckTrackerTest, IsAckDue_OnlyAfterDeadlineWhilePending)
+{
+	DelayedAckTracker tracker;
+	tracker.Configure(ACK_EVERY_PACKET_COUNT, ACK_DELAY_MS);
+
+	ASSERT_EQ(tracker.OnInOrderPacket(50), DELAYED_ACK_ACTION::SCHEDULE);
+	EXPECT_FALSE(tracker.IsAckDue(50 + ACK_DELAY_MS - 1));
+	EXPECT_TRUE(tracker.IsAckDue(50 + ACK_DELAY_MS));
+
+	tracker.OnAckSent(1);
+	EXPECT_FALSE(tracker.IsAckDue(50 + ACK_DELAY_MS));
+}
+
+TEST(DelayedAckTrackerTest, ImmediateReplyInBetween_RestartsDelayWindow)
+{
+	DelayedAckTracker tracker;
+	tracker.Configure(ACK_EVERY_PACKET_COUNT, ACK_DELAY_MS);
+
+	ASSERT_EQ(tracker.OnInOrderPacket(0), DELAYED_ACK_ACTION::SCHEDULE);
+	tracker.OnAckSent(1);
+
+	// 이전 예약 항목은 기한이 되어도 새 기한 전이므로 응답하지 않습니다.
+	EXPECT_EQ(tracker.OnInOrderPacket(5), DELAYED_ACK_ACTION::SCHEDULE);
+	EXPECT_FALSE(tracker.IsAckDue(ACK_DELAY_MS));
+	EXPECT_TRUE(tracker.IsAckDue(5 + ACK_DELAY_MS));
+}
+
+TEST(DelayedAckTrackerTest, IsAckedThrough_TracksLastSentCumulativeSequence)
+{
+	DelayedAckTracker tracker;
+	tracker.Configure(ACK_EVERY_PACKET_COUNT, ACK_DELAY_MS);
+
+	// 아직 보낸 ACK가 없으면 시퀀스 0도 알린 것으로 보지 않습니다.
+	EXPECT_FALSE(tracker.IsAckedThrough(0));
+
+	tracker.OnAckSent(7);
+	EXPECT_TRUE(tracker.IsAckedThrough(7));
+	EXPECT_FALSE(tracker.IsAckedThrough(8));
+
+	tracker.Configure(ACK_EVERY_PACKET_COUNT, ACK_DELAY_MS);
+	EXPECT_FALSE(tracker.IsAckedThrough(7));
+}
@@ -2,6 +2,7 @@
 #include "IRIOManager.h"
 #include <functional>
 #include <optional>
+#include <vector>
 
 class MockRIOManager final : public IRIOManager
 {
@@ -21,15 +22,28 @@ public:
 	bool RIOSendEx(
 		const RIO_RQ& rioRQ, PRIO_BUF rioBuffer, DWORD,
 		PRIO_BUF, PRIO_BUF remoteAddr, PRIO_BUF, PRIO_BUF,
-		ULONG, PVOID requestContext) const override
+		ULONG flags, PVOID requestContext) const override
 	{
 		auto* self = const_cast<MockRIOManager*>(this);
+		if ((flags & RIO_MSG_COMMIT_ONLY) != 0)
+		{
+			++self->rioSendCommitCallCount;
+			self->commitRequestQueueHistory.push_back(rioRQ);
+			return rioSendCommitReturn;
+		}
+
 		++self->rioSendExCallCount;
+		self->sendFlagsHistory.push_back(flags);
 		self->lastSendRequestQueue = rioRQ;
 		self->lastSendRequestContext = requestContext;
 		self->lastSendLength = rioBuffer != nullptr ? rioBuffer->Length : 0;
 		self->lastSendBufferId = rioBuffer != nullptr ? rioBuffer->BufferId : RIO_INVALID_BUFFERID;
 		self->lastSendRemoteAddress = remoteAddr;
+		if (rioBuffer != nullptr)
+		{
+			self->sendBufferHistory.push_back(*rioBuffer);
+		}
+		self->sendContextHistory.push_back(requestContext);
 		if (onRIOSendEx) return onRIOSendEx();
 		return rioSendExReturn;
 	}
@@ -76,6 +90,11 @@ public:
 		lastSendLength = 0;
 		lastSendBufferId = RIO_INVALID_BUFFERID;
 		lastSendRemoteAddress = nullptr;
+		sendBufferHistory.clear();
+		sendContextHistory.clear();
+		sendFlagsHistory.clear();
+		rioSendCommitCallCount = 0;
+		commitRequestQueueHistory.clear();
 		registerRIOBufferCallCount = 0;
 		deregisterBufferCallCount = 0;
 		dequeueCompletionsCallCount = 0;
@@ -92,6 +111,13 @@ public:
 	ULONG lastSendLength = 0;
 	RIO_BUFFERID lastSendBufferId = RIO_INVALID_BUFFERID;
 	PRIO_BUF lastSendRemoteAddress = nullptr;
+	std::vector<RIO_BUF> sendBufferHistory;
+	std::vector<PVOID> sendContextHistory;
+	std::vector<ULONG> sendFlagsHistory;
+
+	bool rioSendCommitReturn = true;
+	int rioSendCommitCallCount = 0;
+	std::vector<RIO_RQ> commitRequestQueueHistory;
 
 	bool initializeSessionRIOReturn = true;
 	int initializeSessionRIOCallCount = 0;
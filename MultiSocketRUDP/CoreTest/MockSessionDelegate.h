@@ -1,5 +1,6 @@
 #pragma once
 #include "ISessionDelegate.h"
+#include "SendSequenceBitmap.h"
 #include <deque>
 #include <functional>
 
@@ -24,8 +25,6 @@ public:
 
     void RecvContextReset(RUDPSession&) override { ++recvContextResetCount; }
     [[nodiscard]]
-    std::shared_ptr<IOContext> GetRecvBufferContext(const RUDPSession&) override { return recvBufferContextReturn; }
-    [[nodiscard]]
     RecvBuffer& GetRecvBuffer(RUDPSession& session) override { return dummyRecvBuffer; }
     [[nodiscard]]
     RIO_RQ GetRecvRIORQ(const RUDPSession&) override { return recvRIORQReturn; }
@@ -33,6 +32,12 @@ public:
     [[nodiscard]]
     std::atomic<IO_MODE>& GetSendIOMode(RUDPSession&) override { return dummyIOMode; }
     [[nodiscard]]
+    std::atomic_uint& GetSendDatagramsInFlight(RUDPSession&) override { return dummyDatagramsInFlight; }
+    [[nodiscard]]
+    std::atomic_bool& GetDeferredSendCommitPending(RUDPSession&) override { return dummyDeferredSendCommitPending; }
+    [[nodiscard]]
+    unsigned int GetDatagramSizeBudget(const RUDPSession&) override { return datagramSizeBudgetReturn; }
+    [[nodiscard]]
     bool IsNothingToSend(RUDPSession&) override { return isNothingToSendReturn; }
     [[nodiscard]]
     bool IsSendPacketInfoQueueEmpty(RUDPSession&) override { return isSendPacketInfoQueueEmpty; }
@@ -68,9 +73,19 @@ public:
     [[nodiscard]]
     RIO_BUFFERID GetSendBufferId(const RUDPSession&) override { return sendBufferIdReturn; }
     [[nodiscard]]
+    ULONG GetSendBufferOffset(const RUDPSession&) override { return 0; }
+    [[nodiscard]]
+    bool AcquireSendBuffer(RUDPSession&) override
+    {
+        ++acquireSendBufferCount; return acquireSendBufferReturn;
+    }
+    void ReleaseSendBuffer(RUDPSession&) override { ++releaseSendBufferCount; }
+    [[nodiscard]]
     RIO_RQ GetSendRIORQ(const RUDPSession&) override { return sendRIORQReturn; }
     [[nodiscard]]
-    std::set<MultiSocketRUDP::PacketSequenceSetKey>& GetCachedSequenceSet(RUDPSession&) override { return dummySeqSet; }
+    const RIO_BUF& GetClientAddressRIOBuffer(const RUDPSession&) override { return clientAddressRIOBufferReturn; }
+    [[nodiscard]]
+    SendSequenceBitmap& GetSendSequenceBitmap(RUDPSession&) override { return dummySeqSet; }
 
     [[nodiscard]]
     bool TryConnect(RUDPSession&, NetBuffer&, const sockaddr_in&) override
@@ -94,6 +109,7 @@ public:
     }
 
     void OnSendReply(RUDPSession&, NetBuffer&) override { ++onSendReplyCount; }
+    void OnPathMtuProbeReply(RUDPSession&, NetBuffer&) override { ++onPathMtuProbeReplyCount; }
     void Disconnect(RUDPSession&, NetBuffer&) override { ++disconnectCount; }
 
     void SendHeartbeatPacket(RUDPSession&, const unsigned long long) override { ++sendHeartbeatCount; }
@@ -136,7 +152,7 @@ public:
     void ResetCounts()
     {
         initializeSessionRIOCount = recvContextResetCount
-            = tryConnectCount = onRecvPacketCount = onSendReplyCount
+            = tryConnectCount = onRecvPacketCount = onSendReplyCount = onPathMtuProbeReplyCount
             = disconnectCount = sendHeartbeatCount = abortReservedCount
             = refreshLastRecvPacketTimeCount = 0;
     }
@@ -150,12 +166,16 @@ public:
     bool onRecvPacketReturn = true;
     int onRecvPacketCount = 0;
     int onSendReplyCount = 0;
+    int onPathMtuProbeReplyCount = 0;
     int disconnectCount = 0;
 
     PortType portReturn = 0;
     SessionIdType sessionIdReturn = INVALID_SESSION_ID;
 
     std::atomic<IO_MODE> dummyIOMode{};
+    std::atomic_uint dummyDatagramsInFlight{};
+    std::atomic_bool dummyDeferredSendCommitPending{};
+    unsigned int datagramSizeBudgetReturn = DEFAULT_DATAGRAM_SIZE_BUDGET;
     bool isNothingToSendReturn = true;
     bool isSendPacketInfoQueueEmpty = true;
     SendPacketInfo* tryGetFrontReturn = nullptr;
@@ -164,8 +184,12 @@ public:
     size_t sendPacketInfoQueueSizeRet = 0;
     char dummySendBuffer[65536]{};
     RIO_BUFFERID sendBufferIdReturn = RIO_INVALID_BUFFERID;
+    bool acquireSendBufferReturn = true;
+    int acquireSendBufferCount = 0;
+    int releaseSendBufferCount = 0;
     RIO_RQ sendRIORQReturn = RIO_INVALID_RQ;
-    std::set<MultiSocketRUDP::PacketSequenceSetKey> dummySeqSet;
+    RIO_BUF clientAddressRIOBufferReturn{ RIO_INVALID_BUFFERID, };
+    SendSequenceBitmap dummySeqSet;
     mutable std::mutex dummySeqMutex;
 
     unsigned char dummyKey[32]{};
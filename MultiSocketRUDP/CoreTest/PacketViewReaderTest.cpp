@@ -0,0 +1,113 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "../MultiSocketRUDPServer/PacketManager.h"
+#include "../MultiSocketRUDPServer/PacketViewReader.h"
+#include <string>
+#include <string_view>
+
+namespace
+{
+	// PacketGenerator가 Items에 int와 std::string을 가진 패킷에 대해 만드는 코드와 같은 모양입니다.
+	class TextPacket final : public IPacket
+	{
+	public:
+		PacketId GetPacketId() const override { return 1; }
+		void BufferToPacket(NetBuffer& buffer) override { buffer >> order >> text; }
+		void PacketToBuffer(NetBuffer& buffer) override { buffer << order << text; }
+
+		int order{};
+		std::string text;
+	};
+
+	class TextPacketView final
+	{
+	public:
+		[[nodiscard]]
+		bool Parse(NetBuffer& buffer) { return SetBufferToViewParameters(buffer, order, text); }
+
+		int order{};
+		std::string_view text{};
+	};
+
+	void WriteTextPacket(NetBuffer& buffer, const int order, const std::string& text)
+	{
+		buffer.Init();
+		TextPacket packet;
+		packet.order = order;
+		packet.text = text;
+		packet.PacketToBuffer(buffer);
+	}
+}
+
+// ------------------------------------------------------------
+// 뷰가 정의 순서대로 필드를 읽고, 문자열은 복사 없이 수신 버퍼 안을 가리키는지 확인합니다.
+// ------------------------------------------------------------
+TEST(PacketViewReaderTest, ParseReadsFieldsInOrderAndPointsIntoBuffer)
+{
+	NetBuffer buffer;
+	WriteTextPacket(buffer, 7, "zero copy string");
+	const auto readBefore = buffer.m_iRead;
+
+	TextPacketView view;
+	ASSERT_TRUE(view.Parse(buffer));
+	EXPECT_EQ(view.order, 7);
+	EXPECT_EQ(view.text, "zero copy string");
+
+	const char* bufferBegin = buffer.GetReadBufferPtr();
+	const char* bufferEnd = bufferBegin + buffer.GetUseSize();
+	EXPECT_GE(view.text.data(), bufferBegin);
+	EXPECT_LE(view.text.data() + view.text.size(), bufferEnd);
+
+	// 읽기 위치를 옮기지 않으므로 같은 버퍼를 복사 경로로도 읽을 수 있어야 합니다.
+	EXPECT_EQ(buffer.m_iRead, readBefore);
+	TextPacket packet;
+	packet.BufferToPacket(buffer);
+	EXPECT_EQ(packet.text, view.text);
+}
+
+// ------------------------------------------------------------
+// 빈 문자열도 길이만 읽고 성공해야 합니다.
+// ------------------------------------------------------------
+TEST(PacketViewReaderTest, ParseAcceptsEmptyString)
+{
+	NetBuffer buffer;
+	WriteTextPacket(buffer, 3, "");
+
+	TextPacketView view;
+	ASSERT_TRUE(view.Parse(buffer));
+	EXPECT_EQ(view.order, 3);
+	EXPECT_TRUE(view.text.empty());
+}
+
+// ------------------------------------------------------------
+// 고정 크기 필드나 문자열 길이가 남은 버퍼보다 크면 거부해야 합니다.
+// ------------------------------------------------------------
+TEST(PacketViewReaderTest, ParseRejectsFieldsPastBufferEnd)
+{
+	{
+		NetBuffer buffer;
+		buffer.Init();
+		buffer << BYTE{ 1 } << BYTE{ 2 };
+
+		TextPacketView view;
+		EXPECT_FALSE(view.Parse(buffer));
+	}
+
+	{
+		NetBuffer buffer;
+		buffer.Init();
+		buffer << 5 << BYTE{ 1 };
+
+		TextPacketView view;
+		EXPECT_FALSE(view.Parse(buffer));
+	}
+
+	{
+		NetBuffer buffer;
+		buffer.Init();
+		buffer << 5 << uint16_t{ 8 } << BYTE{ 'a' } << BYTE{ 'b' };
+
+		TextPacketView view;
+		EXPECT_FALSE(view.Parse(buffer));
+	}
+}
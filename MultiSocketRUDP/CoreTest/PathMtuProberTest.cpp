@@ -0,0 +1,146 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "PathMtuProber.h"
+
+// ============================================================
+// PLPMTUD 탐색
+//
+// 확인된 크기와 탐색 상한 사이를 이진 탐색합니다.
+// 프로브 시퀀스는 최상위 비트가 설정되어 데이터 시퀀스와 겹치지 않습니다.
+// ============================================================
+
+namespace
+{
+	constexpr unsigned int BASE_SIZE = 1200;
+	constexpr unsigned int MAX_SIZE = 1472;
+	constexpr unsigned int PROBE_TIMEOUT_MS = 100;
+}
+
+TEST(PathMtuProberTest, Configure_MaxNotAboveBase_NeverProbes)
+{
+	PathMtuProber prober;
+	prober.Configure(BASE_SIZE, BASE_SIZE);
+
+	PacketSequence sequence = 0;
+	unsigned int probeSize = 0;
+	EXPECT_FALSE(prober.TryBeginProbe(0, PROBE_TIMEOUT_MS, sequence, probeSize));
+	EXPECT_EQ(prober.GetDatagramSizeBudget(), BASE_SIZE);
+}
+
+TEST(PathMtuProberTest, FirstProbe_UsesMidpointAndFlaggedSequence)
+{
+	PathMtuProber prober;
+	prober.Configure(BASE_SIZE, MAX_SIZE);
+
+	PacketSequence sequence = 0;
+	unsigned int probeSize = 0;
+	ASSERT_TRUE(prober.TryBeginProbe(0, PROBE_TIMEOUT_MS, sequence, probeSize));
+
+	EXPECT_EQ(probeSize, BASE_SIZE + (MAX_SIZE - BASE_SIZE + 1) / 2);
+	EXPECT_TRUE(PathMtuProber::IsProbeSequence(sequence));
+	EXPECT_EQ(prober.GetDatagramSizeBudget(), BASE_SIZE);
+}
+
+TEST(PathMtuProberTest, ProbeInFlight_DoesNotIssueAnotherProbeBeforeTimeout)
+{
+	PathMtuProber prober;
+	prober.Configure(BASE_SIZE, MAX_SIZE);
+
+	PacketSequence sequence = 0;
+	unsigned int probeSize = 0;
+	ASSERT_TRUE(prober.TryBeginProbe(0, PROBE_TIMEOUT_MS, sequence, probeSize));
+
+	EXPECT_FALSE(prober.TryBeginProbe(PROBE_TIMEOUT_MS - 1, PROBE_TIMEOUT_MS, sequence, probeSize));
+}
+
+TEST(PathMtuProberTest, AckedProbe_RaisesBudgetAndContinuesUpward)
+{
+	PathMtuProber prober;
+	prober.Configure(BASE_SIZE, MAX_SIZE);
+
+	PacketSequence sequence = 0;
+	unsigned int probeSize = 0;
+	ASSERT_TRUE(prober.TryBeginProbe(0, PROBE_TIMEOUT_MS, sequence, probeSize));
+	ASSERT_TRUE(prober.OnProbeAcked(sequence, probeSize));
+	EXPECT_EQ(prober.GetDatagramSizeBudget(), probeSize);
+
+	const unsigned int confirmedSize = probeSize;
+	ASSERT_TRUE(prober.TryBeginProbe(1, PROBE_TIMEOUT_MS, sequence, probeSize));
+	EXPECT_EQ(probeSize, confirmedSize + (MAX_SIZE - confirmedSize + 1) / 2);
+}
+
+TEST(PathMtuProberTest, AckWithStaleSequence_IsIgnored)
+{
+	PathMtuProber prober;
+	prober.Configure(BASE_SIZE, MAX_SIZE);
+
+	PacketSequence sequence = 0;
+	unsigned int probeSize = 0;
+	ASSERT_TRUE(prober.TryBeginProbe(0, PROBE_TIMEOUT_MS, sequence, probeSize));
+
+	EXPECT_FALSE(prober.OnProbeAcked(sequence + 1, probeSize));
+	EXPECT_FALSE(prober.OnProbeAcked(sequence, probeSize + 1));
+	EXPECT_EQ(prober.GetDatagramSizeBudget(), BASE_SIZE);
+}
+
+TEST(PathMtuProberTest, RepeatedTimeouts_LowerSearchCeiling)
+{
+	PathMtuProber prober;
+	prober.Configure(BASE_SIZE, MAX_SIZE);
+
+	PacketSequence sequence = 0;
+	unsigned int probeSize = 0;
+	unsigned long long now = 0;
+	ASSERT_TRUE(prober.TryBeginProbe(now, PROBE_TIMEOUT_MS, sequence, probeSize));
+	const unsigned int failedSize = probeSize;
+
+	for (unsigned int attempt = 1; attempt < PathMtuProber::MAX_PROBE_ATTEMPTS; ++attempt)
+	{
+		now += PROBE_TIMEOUT_MS;
+		ASSERT_TRUE(prober.TryBeginProbe(now, PROBE_TIMEOUT_MS, sequence, probeSize));
+		EXPECT_EQ(probeSize, failedSize) << "Failed on attempt " << attempt;
+	}
+
+	now += PROBE_TIMEOUT_MS;
+	ASSERT_TRUE(prober.TryBeginProbe(now, PROBE_TIMEOUT_MS, sequence, probeSize));
+	EXPECT_LT(probeSize, failedSize);
+	EXPECT_EQ(probeSize, BASE_SIZE + (failedSize - 1 - BASE_SIZE + 1) / 2);
+	EXPECT_EQ(prober.GetDatagramSizeBudget(), BASE_SIZE);
+}
+
+TEST(PathMtuProberTest, SearchCompletes_WithinGranularityAndStopsProbing)
+{
+	PathMtuProber prober;
+	prober.Configure(BASE_SIZE, MAX_SIZE);
+
+	PacketSequence sequence = 0;
+	unsigned int probeSize = 0;
+	unsigned long long now = 0;
+	while (prober.TryBeginProbe(now, PROBE_TIMEOUT_MS, sequence, probeSize))
+	{
+		ASSERT_TRUE(prober.OnProbeAcked(sequence, probeSize));
+		++now;
+	}
+
+	EXPECT_LT(MAX_SIZE - prober.GetDatagramSizeBudget(), PathMtuProber::PROBE_SEARCH_GRANULARITY);
+	EXPECT_FALSE(prober.TryBeginProbe(now + PathMtuProber::PROBE_RAISE_INTERVAL_MS, PROBE_TIMEOUT_MS, sequence, probeSize));
+}
+
+TEST(PathMtuProberTest, LoweredCeiling_IsSearchedAgainAfterRaiseInterval)
+{
+	PathMtuProber prober;
+	prober.Configure(BASE_SIZE, MAX_SIZE);
+
+	PacketSequence sequence = 0;
+	unsigned int probeSize = 0;
+	unsigned long long now = 0;
+	while (prober.TryBeginProbe(now, PROBE_TIMEOUT_MS, sequence, probeSize))
+	{
+		now += PROBE_TIMEOUT_MS;
+	}
+
+	EXPECT_EQ(prober.GetDatagramSizeBudget(), BASE_SIZE);
+	EXPECT_FALSE(prober.TryBeginProbe(now + PathMtuProber::PROBE_RAISE_INTERVAL_MS - 1, PROBE_TIMEOUT_MS, sequence, probeSize));
+	ASSERT_TRUE(prober.TryBeginProbe(now + PathMtuProber::PROBE_RAISE_INTERVAL_MS, PROBE_TIMEOUT_MS, sequence, probeSize));
+	EXPECT_EQ(probeSize, BASE_SIZE + (MAX_SIZE - BASE_SIZE + 1) / 2);
+}
@@ -0,0 +1,174 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+#include "../Common/FlowController/RUDPAckFrame.h"
+
+// ------------------------------------------------------------
+// 직렬화한 프레임을 다시 읽으면 같은 누적 시퀀스와 SACK 구간이 나와야 한다
+// ------------------------------------------------------------
+TEST(RUDPAckFrameTest, WriteToAndReadFromRoundTripsCumulativeSequenceAndSackRanges)
+{
+	RUDPAckFrame written{ .cumulativeSequence = PacketSequence{ 1 } << 40, .advertiseWindow = 7 };
+	ASSERT_TRUE(written.AddSackRange(written.cumulativeSequence + 2, written.cumulativeSequence + 3));
+	ASSERT_TRUE(written.AddSackRange(written.cumulativeSequence + 9, written.cumulativeSequence + 9));
+
+	NetBuffer buffer;
+	written.WriteTo(buffer);
+
+	RUDPAckFrame read;
+	ASSERT_TRUE(read.ReadFrom(buffer));
+	EXPECT_EQ(read.cumulativeSequence, written.cumulativeSequence);
+	EXPECT_EQ(read.advertiseWindow, 7);
+	ASSERT_EQ(read.sackRangeCount, 2);
+	EXPECT_EQ(read.sackRanges[0].first, written.cumulativeSequence + 2);
+	EXPECT_EQ(read.sackRanges[0].last, written.cumulativeSequence + 3);
+	EXPECT_EQ(read.sackRanges[1].first, written.cumulativeSequence + 9);
+	EXPECT_EQ(read.sackRanges[1].last, written.cumulativeSequence + 9);
+}
+
+// ------------------------------------------------------------
+// 구간 수 초과, 역순 구간, 잘린 프레임은 거부해야 한다
+// ------------------------------------------------------------
+TEST(RUDPAckFrameTest, ReadFromRejectsMalformedFrames)
+{
+	NetBuffer tooManyRanges;
+	tooManyRanges << PacketSequence{ 0 } << BYTE{ 1 } << static_cast<BYTE>(MAX_SACK_RANGE_COUNT + 1);
+	RUDPAckFrame frame;
+	EXPECT_FALSE(frame.ReadFrom(tooManyRanges));
+
+	NetBuffer unorderedRanges;
+	unorderedRanges << PacketSequence{ 0 } << BYTE{ 1 } << BYTE{ 2 } << WORD{ 5 } << WORD{ 6 } << WORD{ 3 } << WORD{ 4 };
+	EXPECT_FALSE(frame.ReadFrom(unorderedRanges));
+
+	NetBuffer overlappingCumulative;
+	overlappingCumulative << PacketSequence{ 0 } << BYTE{ 1 } << BYTE{ 1 } << WORD{ 0 } << WORD{ 1 };
+	EXPECT_FALSE(frame.ReadFrom(overlappingCumulative));
+
+	NetBuffer truncated;
+	truncated << PacketSequence{ 0 } << BYTE{ 1 } << BYTE{ 1 } << WORD{ 2 };
+	EXPECT_FALSE(frame.ReadFrom(truncated));
+}
+
+// ------------------------------------------------------------
+// 덮인 항목만 시퀀스 오름차순으로 제거하고 나머지는 남겨야 한다
+// ------------------------------------------------------------
+TEST(RUDPAckFrameTest, EraseCoveredRemovesOnlyCoveredEntriesInSequenceOrder)
+{
+	std::map<PacketSequence, int> sequenceMap;
+	for (PacketSequence sequence = 1; sequence <= 10; ++sequence)
+	{
+		sequenceMap.emplace(sequence, static_cast<int>(sequence));
+	}
+
+	RUDPAckFrame ackFrame{ .cumulativeSequence = 3 };
+	ASSERT_TRUE(ackFrame.AddSackRange(5, 6));
+	ASSERT_TRUE(ackFrame.AddSackRange(9, 12));
+
+	std::vector<int> erased;
+	const size_t erasedCount = ackFrame.EraseCovered(sequenceMap, [&erased](const int value) { erased.push_back(value); });
+
+	EXPECT_EQ(erasedCount, 7);
+	EXPECT_EQ(erased, (std::vector<int>{ 1, 2, 3, 5, 6, 9, 10 }));
+	ASSERT_EQ(sequenceMap.size(), 3);
+	EXPECT_TRUE(sequenceMap.contains(4));
+	EXPECT_TRUE(sequenceMap.contains(7));
+	EXPECT_TRUE(sequenceMap.contains(8));
+}
+
+// ------------------------------------------------------------
+// 기준 시퀀스 뒤에 있는 SACK 구간 시퀀스만 세야 한다
+// ------------------------------------------------------------
+TEST(RUDPAckFrameTest, CountSackedAfterCountsOnlyLaterSackedSequences)
+{
+	RUDPAckFrame ackFrame{ .cumulativeSequence = 3 };
+	ASSERT_TRUE(ackFrame.AddSackRange(5, 6));
+	ASSERT_TRUE(ackFrame.AddSackRange(9, 12));
+
+	EXPECT_EQ(ackFrame.CountSackedAfter(4), 6);
+	EXPECT_EQ(ackFrame.CountSackedAfter(5), 5);
+	EXPECT_EQ(ackFrame.CountSackedAfter(8), 4);
+	EXPECT_EQ(ackFrame.CountSackedAfter(10), 2);
+	EXPECT_EQ(ackFrame.CountSackedAfter(12), 0);
+	EXPECT_EQ(RUDPAckFrame{ .cumulativeSequence = 3 }.CountSackedAfter(1), 0);
+}
+
+// ------------------------------------------------------------
+// 뒤 시퀀스가 FAST_RETRANSMIT_SACK_THRESHOLD개 이상 확인된 빈 자리만 손실로 보고, afterSequence 이하는 건너뛰어야 한다
+// ------------------------------------------------------------
+TEST(RUDPAckFrameTest, ForEachLostReportsHolesBelowSackThresholdOnly)
+{
+	static_assert(FAST_RETRANSMIT_SACK_THRESHOLD == 3);
+
+	std::map<PacketSequence, int> sequenceMap{ { 4, 4 }, { 7, 7 }, { 8, 8 }, { 13, 13 } };
+	RUDPAckFrame twoAfterHole{ .cumulativeSequence = 3 };
+	ASSERT_TRUE(twoAfterHole.AddSackRange(5, 6));
+	ASSERT_TRUE(twoAfterHole.AddSackRange(9, 10));
+
+	std::vector<int> lost;
+	EXPECT_EQ(twoAfterHole.ForEachLost(sequenceMap, 0, [&lost](const int value) { lost.push_back(value); }), 1);
+	EXPECT_EQ(lost, (std::vector<int>{ 4 }));
+
+	RUDPAckFrame threeAfterHole{ .cumulativeSequence = 3 };
+	ASSERT_TRUE(threeAfterHole.AddSackRange(5, 6));
+	ASSERT_TRUE(threeAfterHole.AddSackRange(9, 11));
+
+	lost.clear();
+	EXPECT_EQ(threeAfterHole.ForEachLost(sequenceMap, 0, [&lost](const int value) { lost.push_back(value); }), 3);
+	EXPECT_EQ(lost, (std::vector<int>{ 4, 7, 8 }));
+
+	lost.clear();
+	EXPECT_EQ(threeAfterHole.ForEachLost(sequenceMap, 7, [&lost](const int value) { lost.push_back(value); }), 1);
+	EXPECT_EQ(lost, (std::vector<int>{ 8 }));
+
+	EXPECT_EQ(RUDPAckFrame{ .cumulativeSequence = 3 }.ForEachLost(sequenceMap, 0, [](int) {}), 0);
+}
+
+// ------------------------------------------------------------
+// 피기백 필드는 ACK 유무 표시와 프레임을 함께 왕복하고, 복호화 전 크기 계산과 일치해야 한다
+// ------------------------------------------------------------
+TEST(RUDPAckFrameTest, PiggybackFieldRoundTripsAndReportsWireSize)
+{
+	NetBuffer absent;
+	RUDPAckFrame::WritePiggybackField(absent, nullptr);
+	EXPECT_EQ(RUDPAckFrame::GetPiggybackFieldSize(absent.GetReadBufferPtr(), absent.GetUseSize()), absent.GetUseSize());
+
+	RUDPAckFrame read;
+	bool hasAckFrame = true;
+	ASSERT_TRUE(RUDPAckFrame::ReadPiggybackField(absent, read, hasAckFrame));
+	EXPECT_FALSE(hasAckFrame);
+
+	RUDPAckFrame written{ .cumulativeSequence = 20, .advertiseWindow = 3 };
+	ASSERT_TRUE(written.AddSackRange(22, 24));
+	NetBuffer present;
+	RUDPAckFrame::WritePiggybackField(present, &written);
+	EXPECT_EQ(present.GetUseSize(), 1 + RUDPAckFrame::FIXED_WIRE_SIZE + RUDPAckFrame::SACK_RANGE_WIRE_SIZE);
+	EXPECT_EQ(RUDPAckFrame::GetPiggybackFieldSize(present.GetReadBufferPtr(), present.GetUseSize()), present.GetUseSize());
+
+	ASSERT_TRUE(RUDPAckFrame::ReadPiggybackField(present, read, hasAckFrame));
+	EXPECT_TRUE(hasAckFrame);
+	EXPECT_EQ(read.cumulativeSequence, 20u);
+	ASSERT_EQ(read.sackRangeCount, 1);
+	EXPECT_EQ(read.sackRanges[0].first, 22u);
+	EXPECT_EQ(read.sackRanges[0].last, 24u);
+}
+
+// ------------------------------------------------------------
+// 알 수 없는 표시 값이나 잘린 피기백 필드는 크기 계산과 읽기 모두에서 거부해야 한다
+// ------------------------------------------------------------
+TEST(RUDPAckFrameTest, PiggybackFieldRejectsUnknownFlagAndTruncatedFrame)
+{
+	NetBuffer unknownFlag;
+	unknownFlag << static_cast<BYTE>(RUDPAckFrame::PIGGYBACK_ACK_PRESENT + 1);
+	EXPECT_EQ(RUDPAckFrame::GetPiggybackFieldSize(unknownFlag.GetReadBufferPtr(), unknownFlag.GetUseSize()), -1);
+	RUDPAckFrame frame;
+	bool hasAckFrame = false;
+	EXPECT_FALSE(RUDPAckFrame::ReadPiggybackField(unknownFlag, frame, hasAckFrame));
+
+	RUDPAckFrame written{ .cumulativeSequence = 20 };
+	ASSERT_TRUE(written.AddSackRange(22, 24));
+	NetBuffer truncated;
+	RUDPAckFrame::WritePiggybackField(truncated, &written);
+	EXPECT_EQ(RUDPAckFrame::GetPiggybackFieldSize(truncated.GetReadBufferPtr(), truncated.GetUseSize() - 1), -1);
+	EXPECT_EQ(RUDPAckFrame::GetPiggybackFieldSize(truncated.GetReadBufferPtr(), 0), -1);
+}
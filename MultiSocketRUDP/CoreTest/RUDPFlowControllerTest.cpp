@@ -12,7 +12,7 @@ protected:
 
 	RUDPFlowController fc;
 
-	void GrowCwndTo(const uint8_t targetCwnd)
+	void GrowCwndTo(const uint32_t targetCwnd)
 	{
 		PacketSequence seq = fc.GetLastAckedSequence() + 1;
 		while (fc.GetCwnd() < targetCwnd)
@@ -32,56 +32,12 @@ TEST_F(RUDPFlowControllerTest, InitialState_LastAckedSequenceIsZero)
 	EXPECT_EQ(fc.GetLastAckedSequence(), 0);
 }
 
-// ------------------------------------------------------------
-// outstanding�� cwnd �̸��̸� ���� �����ؾ� �Ѵ�
-// ------------------------------------------------------------
-TEST_F(RUDPFlowControllerTest, CanSendPacket_ReturnsTrue_WhenOutstandingBelowCwnd)
-{
-	EXPECT_TRUE(fc.CanSendPacket(1, 0));
-	EXPECT_TRUE(fc.CanSendPacket(4, 0));
-}
-
-// ------------------------------------------------------------
-// outstanding�� cwnd �̻��̸� ���� �Ұ��ؾ� �Ѵ�
-// ------------------------------------------------------------
-TEST_F(RUDPFlowControllerTest, CanSendPacket_ReturnsFalse_WhenOutstandingReachesCwnd)
-{
-	EXPECT_FALSE(fc.CanSendPacket(5, 0));
-	EXPECT_FALSE(fc.CanSendPacket(6, 0));
-}
-
-TEST_F(RUDPFlowControllerTest, CanSendPacket_DoesNotTruncateLargeOutstandingCount)
-{
-	EXPECT_FALSE(fc.CanSendPacket(256, 0));
-	EXPECT_FALSE(fc.CanSendPacket(257, 0));
-	EXPECT_FALSE(fc.CanSendPacket(258, 0));
-	EXPECT_FALSE(fc.CanSendPacket(1025, 0));
-	EXPECT_FALSE(fc.CanSendPacket((PacketSequence{ 1 } << 32) + 1, 0));
-}
-
-TEST_F(RUDPFlowControllerTest, CanSendPacket_HandlesSequenceWraparound)
-{
-	constexpr PacketSequence maxSequence = ~PacketSequence{ 0 };
-
-	EXPECT_TRUE(fc.CanSendPacket(1, maxSequence - 1));
-	EXPECT_FALSE(fc.CanSendPacket(4, maxSequence - 1));
-	EXPECT_TRUE(fc.CanSendPacket(PacketSequence{ 1 } << 63, 0));
-}
-
-// ------------------------------------------------------------
-// lastAcked�� nextSend�� ������ outstanding=0���� ���� �����ؾ� �Ѵ�
-// ------------------------------------------------------------
-TEST_F(RUDPFlowControllerTest, CanSendPacket_ReturnsTrue_WhenNoOutstanding)
-{
-	EXPECT_TRUE(fc.CanSendPacket(1, 1));
-}
-
 // ------------------------------------------------------------
 // ���� ACK ���� �� cwnd�� 1 �����ؾ� �Ѵ�
 // ------------------------------------------------------------
 TEST_F(RUDPFlowControllerTest, OnReplyReceived_IncrementsCwnd)
 {
-	const uint16_t before = fc.GetCwnd();
+	const uint32_t before = fc.GetCwnd();
 	fc.OnReplyReceived(1);
 	EXPECT_EQ(fc.GetCwnd(), before + 1);
 }
@@ -110,7 +66,7 @@ TEST_F(RUDPFlowControllerTest, OnReplyReceived_DoesNotAliasTwoToTheThirtySecondG
 TEST_F(RUDPFlowControllerTest, OnReplyReceived_DuplicateAck_DoesNotChangeCwnd)
 {
 	fc.OnReplyReceived(5);
-	const uint16_t cwndAfterFirst = fc.GetCwnd();
+	const uint32_t cwndAfterFirst = fc.GetCwnd();
 
 	fc.OnReplyReceived(5);
 	fc.OnReplyReceived(3);
@@ -123,7 +79,7 @@ TEST_F(RUDPFlowControllerTest, OnReplyReceived_DuplicateAck_DoesNotChangeCwnd)
 TEST_F(RUDPFlowControllerTest, OnReplyReceived_LargeGap_TriggersCongestion)
 {
 	fc.OnReplyReceived(1);
-	const uint16_t cwndBefore = fc.GetCwnd();
+	const uint32_t cwndBefore = fc.GetCwnd();
 
 	fc.OnReplyReceived(8);
 	EXPECT_LT(fc.GetCwnd(), cwndBefore);
@@ -135,7 +91,7 @@ TEST_F(RUDPFlowControllerTest, OnReplyReceived_LargeGap_TriggersCongestion)
 TEST_F(RUDPFlowControllerTest, OnReplyReceived_SmallGap_DoesNotTriggerCongestion)
 {
 	fc.OnReplyReceived(1);
-	const uint16_t cwndBefore = fc.GetCwnd();
+	const uint32_t cwndBefore = fc.GetCwnd();
 
 	fc.OnReplyReceived(6);
 	EXPECT_GE(fc.GetCwnd(), cwndBefore);
@@ -146,8 +102,8 @@ TEST_F(RUDPFlowControllerTest, OnReplyReceived_SmallGap_DoesNotTriggerCongestion
 // ------------------------------------------------------------
 TEST_F(RUDPFlowControllerTest, OnReplyReceived_CwndDoesNotExceedMaxCwnd)
 {
-	GrowCwndTo(250);
-	const uint16_t cwndAtMax = fc.GetCwnd();
+	GrowCwndTo(MAX_CONGESTION_WINDOW);
+	const uint32_t cwndAtMax = fc.GetCwnd();
 
 	fc.OnReplyReceived(fc.GetLastAckedSequence() + 1);
 	EXPECT_EQ(fc.GetCwnd(), cwndAtMax);
@@ -159,7 +115,7 @@ TEST_F(RUDPFlowControllerTest, OnReplyReceived_CwndDoesNotExceedMaxCwnd)
 TEST_F(RUDPFlowControllerTest, OnCongestionEvent_HalvesCwnd)
 {
 	GrowCwndTo(8);
-	const uint16_t before = fc.GetCwnd();
+	const uint32_t before = fc.GetCwnd();
 
 	fc.OnCongestionEvent();
 	EXPECT_EQ(fc.GetCwnd(), before / 2);
@@ -181,9 +137,9 @@ TEST_F(RUDPFlowControllerTest, OnCongestionEvent_CwndMinimumIsOne)
 TEST_F(RUDPFlowControllerTest, OnTimeout_HalvesCwndWithMinimumOne)
 {
 	GrowCwndTo(10);
-	const uint16_t cwndBeforeTimeout = fc.GetCwnd();
+	const uint32_t cwndBeforeTimeout = fc.GetCwnd();
 	fc.OnTimeout();
-	EXPECT_EQ(fc.GetCwnd(), std::max<uint8_t>(cwndBeforeTimeout / 2, 1));
+	EXPECT_EQ(fc.GetCwnd(), std::max<uint32_t>(cwndBeforeTimeout / 2, 1));
 }
 
 // ------------------------------------------------------------
@@ -194,7 +150,7 @@ TEST_F(RUDPFlowControllerTest, OnTimeout_EntersRecovery_CwndNotIncreasedOnFirstA
 	GrowCwndTo(8);
 	fc.OnTimeout();
 
-	const uint16_t cwndAfterTimeout = fc.GetCwnd();
+	const uint32_t cwndAfterTimeout = fc.GetCwnd();
 	fc.OnReplyReceived(fc.GetLastAckedSequence() + 1);
 
 	// recovery ���¿��� ù ACK�� cwnd�� ������Ű�� �ʰ� recovery ������ ��
@@ -211,7 +167,7 @@ TEST_F(RUDPFlowControllerTest, AfterRecovery_CwndIncreasesNormally)
 
 	fc.OnReplyReceived(seq);
 	++seq;
-	const uint16_t cwndAfterRecovery = fc.GetCwnd();
+	const uint32_t cwndAfterRecovery = fc.GetCwnd();
 
 	fc.OnReplyReceived(seq);
 	EXPECT_EQ(fc.GetCwnd(), cwndAfterRecovery + 1);
@@ -30,6 +30,36 @@ TEST_F(RUDPFlowManagerTest, CanSend_ReturnsTrue_WithinInitialCwnd)
 TEST_F(RUDPFlowManagerTest, CanSend_ReturnsFalse_WhenExceedsCwnd)
 {
 	EXPECT_FALSE(fm.CanSend(5));
+	EXPECT_FALSE(fm.CanSend(6));
+}
+
+// ------------------------------------------------------------
+// 미확인 패킷 수가 크거나 32비트를 넘어도 잘리지 않고 cwnd와 비교해야 한다
+// ------------------------------------------------------------
+TEST_F(RUDPFlowManagerTest, CanSend_DoesNotTruncateLargeOutstandingCount)
+{
+	EXPECT_FALSE(fm.CanSend(256));
+	EXPECT_FALSE(fm.CanSend(257));
+	EXPECT_FALSE(fm.CanSend(258));
+	EXPECT_FALSE(fm.CanSend(1025));
+	EXPECT_FALSE(fm.CanSend((PacketSequence{ 1 } << 32) + 1));
+}
+
+// ------------------------------------------------------------
+// 시퀀스 차이가 음수로 넘어가면 미확인 패킷이 없는 것으로 보아야 한다
+// ------------------------------------------------------------
+TEST_F(RUDPFlowManagerTest, CanSend_HandlesSequenceWraparound)
+{
+	EXPECT_TRUE(fm.CanSend(PacketSequence{ 1 } << 63));
+}
+
+// ------------------------------------------------------------
+// 마지막 ACK 시퀀스와 다음 송신 시퀀스가 같으면 미확인 패킷이 없으므로 전송 가능해야 한다
+// ------------------------------------------------------------
+TEST_F(RUDPFlowManagerTest, CanSend_ReturnsTrue_WhenNoOutstanding)
+{
+	fm.OnAckReceived(1);
+	EXPECT_TRUE(fm.CanSend(1));
 }
 
 // ------------------------------------------------------------
@@ -76,9 +106,9 @@ TEST_F(RUDPFlowManagerTest, MarkReceived_SlidesWindow_AllowsNewSequence)
 // ------------------------------------------------------------
 TEST_F(RUDPFlowManagerTest, OnTimeout_HalvesCwnd)
 {
-	const uint16_t cwndBeforeTimeout = fm.GetCwnd();
+	const uint32_t cwndBeforeTimeout = fm.GetCwnd();
 	fm.OnTimeout();
-	EXPECT_EQ(fm.GetCwnd(), std::max<uint8_t>(cwndBeforeTimeout / 2, 1));
+	EXPECT_EQ(fm.GetCwnd(), std::max<uint32_t>(cwndBeforeTimeout / 2, 1));
 
 	EXPECT_TRUE(fm.CanSend(1));
 	EXPECT_TRUE(fm.CanSend(2));
@@ -78,11 +78,15 @@ protected:
         {
 			if (scheduler != nullptr)
 			{
-				std::scoped_lock lock(scheduler->lock);
-				while (not scheduler->heap.empty())
+				std::vector<SendPacketInfo*> remainList;
 				{
-					SendPacketInfo::Free(scheduler->heap.top().info);
-					scheduler->heap.pop();
+					std::scoped_lock lock(scheduler->lock);
+					scheduler->wheel.PopAll(remainList);
+				}
+
+				for (auto* remain : remainList)
+				{
+					SendPacketInfo::Free(remain);
 				}
 			}
 
@@ -161,6 +165,7 @@ protected:
 		mockDelegate.getSocketReturn = static_cast<SOCKET>(1);
 		mockDelegate.sendBufferIdReturn = reinterpret_cast<RIO_BUFFERID>(2);
 		mockDelegate.sendRIORQReturn = reinterpret_cast<RIO_RQ>(3);
+		mockDelegate.clientAddressRIOBufferReturn = { reinterpret_cast<RIO_BUFFERID>(4), CLIENT_ADDRESS_SLOT_SIZE * 5, sizeof(SOCKADDR_INET) };
 		mockRIO.rioSendExReturn = true;
 	}
 
@@ -214,9 +219,8 @@ TEST_F(RUDPIOHandlerTest, RetransmissionScheduler_PushAddsReferenceAndSignalsWak
     {
         std::scoped_lock lock(scheduler.lock);
         PushRetransmissionSchedule(scheduler, *info, std::chrono::steady_clock::now());
-        ASSERT_EQ(scheduler.heap.size(), 1);
-        EXPECT_EQ(scheduler.heap.top().info, info);
-        EXPECT_EQ(scheduler.heap.top().version, info->scheduleVersion);
+        ASSERT_EQ(scheduler.wheel.GetSize(), 1);
+        EXPECT_TRUE(RetransmissionTimingWheel::IsScheduled(*info));
     }
     EXPECT_TRUE(SignalRetransmissionWakeEvent(scheduler));
     EXPECT_EQ(info->refCount.load(std::memory_order_acquire), 2);
@@ -224,13 +228,12 @@ TEST_F(RUDPIOHandlerTest, RetransmissionScheduler_PushAddsReferenceAndSignalsWak
 
     {
         std::scoped_lock lock(scheduler.lock);
-        SendPacketInfo::Free(scheduler.heap.top().info);
-        scheduler.heap.pop();
+        CancelRetransmissionSchedule(scheduler, *info);
     }
     SendPacketInfo::Free(info);
 }
 
-TEST_F(RUDPIOHandlerTest, RetransmissionScheduler_RequeueMarksOlderHeapEntryStaleByVersion)
+TEST_F(RUDPIOHandlerTest, RetransmissionScheduler_RequeueMovesExistingEntryWithoutExtraReference)
 {
     SendPacketInfo* info = AllocSendPacketInfo();
     auto& scheduler = *retransmissionSchedulers[THREAD_ID];
@@ -238,36 +241,26 @@ TEST_F(RUDPIOHandlerTest, RetransmissionScheduler_RequeueMarksOlderHeapEntryStal
     {
         std::scoped_lock lock(scheduler.lock);
         PushRetransmissionSchedule(scheduler, *info, std::chrono::steady_clock::now());
-        PushRetransmissionSchedule(scheduler, *info, std::chrono::steady_clock::now());
+        PushRetransmissionSchedule(scheduler, *info, std::chrono::steady_clock::now() + std::chrono::milliseconds(RETRANSMIT_MS));
+        EXPECT_EQ(scheduler.wheel.GetSize(), 1);
     }
+    EXPECT_EQ(info->refCount.load(std::memory_order_acquire), 2);
 
-    size_t staleCount = 0;
-    size_t currentCount = 0;
+    std::vector<SendPacketInfo*> expiredList;
     {
         std::scoped_lock lock(scheduler.lock);
-        ASSERT_EQ(scheduler.heap.size(), 2);
-        while (not scheduler.heap.empty())
-        {
-            const auto entry = scheduler.heap.top();
-            scheduler.heap.pop();
-            if (entry.version == entry.info->scheduleVersion)
-            {
-                ++currentCount;
-            }
-            else
-            {
-                ++staleCount;
-            }
-            SendPacketInfo::Free(entry.info);
-        }
+        scheduler.wheel.PopExpired(std::chrono::steady_clock::now(), expiredList);
     }
+    EXPECT_TRUE(expiredList.empty());
 
-    EXPECT_EQ(staleCount, 1);
-    EXPECT_EQ(currentCount, 1);
+    {
+        std::scoped_lock lock(scheduler.lock);
+        CancelRetransmissionSchedule(scheduler, *info);
+    }
     SendPacketInfo::Free(info);
 }
 
-TEST_F(RUDPIOHandlerTest, RetransmissionScheduler_ErasedPacketEntryReturnsHeapReference)
+TEST_F(RUDPIOHandlerTest, RetransmissionScheduler_CancelReturnsWheelReference)
 {
     SendPacketInfo* info = AllocSendPacketInfo();
     auto& scheduler = *retransmissionSchedulers[THREAD_ID];
@@ -276,15 +269,11 @@ TEST_F(RUDPIOHandlerTest, RetransmissionScheduler_ErasedPacketEntryReturnsHeapRe
         std::scoped_lock lock(scheduler.lock);
         PushRetransmissionSchedule(scheduler, *info, std::chrono::steady_clock::now());
         info->isErasedPacketInfo.store(true, std::memory_order_release);
-    }
+        CancelRetransmissionSchedule(scheduler, *info);
+        EXPECT_EQ(scheduler.wheel.GetSize(), 0);
+        EXPECT_FALSE(RetransmissionTimingWheel::IsScheduled(*info));
 
-    {
-        std::scoped_lock lock(scheduler.lock);
-        ASSERT_EQ(scheduler.heap.size(), 1);
-        SendPacketInfo* erasedInfo = scheduler.heap.top().info;
-        scheduler.heap.pop();
-        EXPECT_TRUE(erasedInfo->isErasedPacketInfo.load(std::memory_order_acquire));
-        SendPacketInfo::Free(erasedInfo);
+        CancelRetransmissionSchedule(scheduler, *info);
     }
     EXPECT_EQ(info->refCount.load(std::memory_order_acquire), 1);
     SendPacketInfo::Free(info);
@@ -760,12 +749,16 @@ TEST_F(RUDPIOHandlerTest, DoSend_DataPacketBuildsStreamSchedulesRetransmissionAn
 	EXPECT_EQ(mockRIO.lastSendRequestQueue, mockDelegate.sendRIORQReturn);
 	EXPECT_EQ(mockRIO.lastSendBufferId, mockDelegate.sendBufferIdReturn);
 	EXPECT_EQ(mockRIO.lastSendLength, df_HEADER_SIZE + 1);
-	EXPECT_NE(mockRIO.lastSendRemoteAddress, nullptr);
+	ASSERT_NE(mockRIO.lastSendRemoteAddress, nullptr);
+	EXPECT_EQ(mockRIO.lastSendRemoteAddress->BufferId, mockDelegate.clientAddressRIOBufferReturn.BufferId);
+	EXPECT_EQ(mockRIO.lastSendRemoteAddress->Offset, mockDelegate.clientAddressRIOBufferReturn.Offset);
+	EXPECT_EQ(mockRIO.lastSendRemoteAddress->Length, sizeof(SOCKADDR_INET));
+	EXPECT_EQ(mockRIO.registerRIOBufferCallCount, 0);
 	EXPECT_EQ(mockDelegate.GetSendIOMode(session).load(), IO_MODE::IO_SENDING);
 	{
 		std::scoped_lock lock(retransmissionSchedulers[THREAD_ID]->lock);
-		ASSERT_EQ(retransmissionSchedulers[THREAD_ID]->heap.size(), 1u);
-		EXPECT_EQ(retransmissionSchedulers[THREAD_ID]->heap.top().info->sendPacketSequence, 7);
+		ASSERT_EQ(retransmissionSchedulers[THREAD_ID]->wheel.GetSize(), 1u);
+		EXPECT_TRUE(RetransmissionTimingWheel::IsScheduled(*info));
 	}
 
 	CompleteOutstandingSend();
@@ -786,7 +779,7 @@ TEST_F(RUDPIOHandlerTest, DoSend_ReplyPacketPostsWithoutRetransmissionSchedule)
 	EXPECT_EQ(mockRIO.rioSendExCallCount, 1);
 	{
 		std::scoped_lock lock(retransmissionSchedulers[THREAD_ID]->lock);
-		EXPECT_TRUE(retransmissionSchedulers[THREAD_ID]->heap.empty());
+		EXPECT_EQ(retransmissionSchedulers[THREAD_ID]->wheel.GetSize(), 0u);
 	}
 
 	CompleteOutstandingSend();
@@ -808,18 +801,18 @@ TEST_F(RUDPIOHandlerTest, DoSend_ZeroLengthPacketFailsAndRestoresIOMode)
 }
 
 // ------------------------------------------------------------
-// 주소 버퍼 등록 실패 시 송신 컨텍스트와 IO 모드가 누수 없이 롤백되는지 확인합니다.
+// 세션에 주소 슬롯이 없으면 송신 컨텍스트와 IO 모드가 누수 없이 롤백되는지 확인합니다.
 // ------------------------------------------------------------
-TEST_F(RUDPIOHandlerTest, DoSend_AddressBufferRegistrationFailureRollsBackContextAndIOMode)
+TEST_F(RUDPIOHandlerTest, DoSend_MissingClientAddressSlotRollsBackContextAndIOMode)
 {
 	SetupValidSendPath();
-	mockRIO.registerRIOBufferReturn = RIO_INVALID_BUFFERID;
+	mockDelegate.clientAddressRIOBufferReturn = { RIO_INVALID_BUFFERID, };
 	SendPacketInfo* info = AllocSerializedSendPacketInfo(12);
 	ASSERT_NE(info, nullptr);
 	mockDelegate.queuedSendPacketInfos.push_back(info);
 
 	EXPECT_FALSE(handler->DoSend(session, THREAD_ID));
-	EXPECT_EQ(mockRIO.registerRIOBufferCallCount, 1);
+	EXPECT_EQ(mockRIO.registerRIOBufferCallCount, 0);
 	EXPECT_EQ(mockRIO.rioSendExCallCount, 0);
 	EXPECT_EQ(mockDelegate.GetSendIOMode(session).load(), IO_MODE::IO_NONE_SENDING);
 }
@@ -852,3 +845,190 @@ TEST_F(RUDPIOHandlerTest, DoSend_RIOSendExFailureRestoresIOMode)
 	EXPECT_EQ(mockRIO.rioSendExCallCount, 1);
 	EXPECT_EQ(mockDelegate.GetSendIOMode(session).load(), IO_MODE::IO_NONE_SENDING);
 }
+
+// ============================================================
+// 14. DoSend — 데이터그램 분할
+// ============================================================
+
+// ------------------------------------------------------------
+// 예산 안에서는 여러 패킷을 한 데이터그램에 담고, 넘치면 패킷 경계에서 다음 데이터그램으로 나누는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendDatagramPackerTest, PacksPacketsUpToBudgetAndSplitsAtPacketBoundary)
+{
+	SendDatagramPacker packer(100);
+	EXPECT_EQ(packer.Append(40), 0u);
+	EXPECT_EQ(packer.Append(40), 40u);
+	EXPECT_EQ(packer.Append(40), 80u);
+	packer.Seal();
+
+	ASSERT_EQ(packer.GetDatagramCount(), 2u);
+	EXPECT_EQ(packer.GetDatagram(0).offset, 0u);
+	EXPECT_EQ(packer.GetDatagram(0).length, 80u);
+	EXPECT_EQ(packer.GetDatagram(1).offset, 80u);
+	EXPECT_EQ(packer.GetDatagram(1).length, 40u);
+	EXPECT_EQ(packer.GetTotalSendSize(), 120u);
+}
+
+// ------------------------------------------------------------
+// 예산보다 큰 단일 패킷은 잘리지 않고 단독 데이터그램이 되는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendDatagramPackerTest, OversizedPacketBecomesItsOwnDatagram)
+{
+	SendDatagramPacker packer(100);
+	std::ignore = packer.Append(10);
+	std::ignore = packer.Append(300);
+	std::ignore = packer.Append(10);
+	packer.Seal();
+
+	ASSERT_EQ(packer.GetDatagramCount(), 3u);
+	EXPECT_EQ(packer.GetDatagram(1).offset, 10u);
+	EXPECT_EQ(packer.GetDatagram(1).length, 300u);
+	EXPECT_EQ(packer.GetDatagram(2).length, 10u);
+}
+
+// ------------------------------------------------------------
+// 데이터그램 수가 MAX_DATAGRAM_BATCH_SIZE에 도달하면 새 데이터그램이 필요한 패킷은 거부하는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendDatagramPackerTest, CanAppendRejectsPacketBeyondBatchLimit)
+{
+	SendDatagramPacker packer(100);
+	for (unsigned int i = 0; i < MAX_DATAGRAM_BATCH_SIZE; ++i)
+	{
+		ASSERT_TRUE(packer.CanAppend(100)) << "Failed on datagram " << i;
+		std::ignore = packer.Append(100);
+	}
+
+	EXPECT_FALSE(packer.CanAppend(1));
+	packer.Seal();
+	EXPECT_EQ(packer.GetDatagramCount(), MAX_DATAGRAM_BATCH_SIZE);
+}
+
+// ------------------------------------------------------------
+// 송신 버퍼 전체 크기를 넘는 패킷은 거부하는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendDatagramPackerTest, CanAppendRejectsPacketBeyondSendBuffer)
+{
+	SendDatagramPacker packer(MAX_SEND_BUFFER_SIZE);
+	std::ignore = packer.Append(MAX_SEND_BUFFER_SIZE - 10);
+
+	EXPECT_TRUE(packer.CanAppend(10));
+	EXPECT_FALSE(packer.CanAppend(11));
+}
+
+// ------------------------------------------------------------
+// 한 송신 패스가 예산에 맞춰 여러 데이터그램으로 게시되고, 마지막 완료까지 IO_SENDING을 유지하는지 확인합니다.
+// ------------------------------------------------------------
+TEST_F(RUDPIOHandlerTest, DoSend_SplitsStreamIntoDatagramsAndHoldsSendModeUntilLastCompletion)
+{
+	SetupValidSendPath();
+	constexpr unsigned int packetSize = df_HEADER_SIZE + 1;
+	mockDelegate.datagramSizeBudgetReturn = packetSize * 2;
+	for (PacketSequence sequence = 21; sequence <= 23; ++sequence)
+	{
+		SendPacketInfo* info = AllocSerializedSendPacketInfo(sequence);
+		ASSERT_NE(info, nullptr);
+		mockDelegate.queuedSendPacketInfos.push_back(info);
+	}
+
+	ASSERT_TRUE(handler->DoSend(session, THREAD_ID));
+
+	ASSERT_EQ(mockRIO.rioSendExCallCount, 2);
+	ASSERT_EQ(mockRIO.sendBufferHistory.size(), 2u);
+	EXPECT_EQ(mockRIO.sendBufferHistory[0].Offset, 0u);
+	EXPECT_EQ(mockRIO.sendBufferHistory[0].Length, packetSize * 2);
+	EXPECT_EQ(mockRIO.sendBufferHistory[1].Offset, packetSize * 2);
+	EXPECT_EQ(mockRIO.sendBufferHistory[1].Length, packetSize);
+	EXPECT_EQ(mockDelegate.dummyDatagramsInFlight.load(), 2u);
+
+	ASSERT_TRUE(handler->IOCompleted(static_cast<IOContext*>(mockRIO.sendContextHistory[0]), 0, THREAD_ID));
+	EXPECT_EQ(mockDelegate.GetSendIOMode(session).load(), IO_MODE::IO_SENDING);
+
+	ASSERT_TRUE(handler->IOCompleted(static_cast<IOContext*>(mockRIO.sendContextHistory[1]), 0, THREAD_ID));
+	EXPECT_EQ(mockDelegate.GetSendIOMode(session).load(), IO_MODE::IO_NONE_SENDING);
+	EXPECT_EQ(mockDelegate.dummyDatagramsInFlight.load(), 0u);
+}
+
+// ------------------------------------------------------------
+// 두 번째 데이터그램 게시에 실패하면 게시하지 못한 몫만 완료 처리하고, 먼저 나간 데이터그램의 완료에서 IO 모드를 해제하는지 확인합니다.
+// ------------------------------------------------------------
+TEST_F(RUDPIOHandlerTest, DoSend_SecondDatagramPostFailureReleasesSendModeOnFirstCompletion)
+{
+	SetupValidSendPath();
+	constexpr unsigned int packetSize = df_HEADER_SIZE + 1;
+	mockDelegate.datagramSizeBudgetReturn = packetSize;
+	for (PacketSequence sequence = 31; sequence <= 32; ++sequence)
+	{
+		SendPacketInfo* info = AllocSerializedSendPacketInfo(sequence);
+		ASSERT_NE(info, nullptr);
+		mockDelegate.queuedSendPacketInfos.push_back(info);
+	}
+	mockRIO.onRIOSendEx = [this]() { return mockRIO.rioSendExCallCount == 1; };
+
+	EXPECT_FALSE(handler->DoSend(session, THREAD_ID));
+	EXPECT_EQ(mockRIO.rioSendExCallCount, 2);
+	EXPECT_EQ(mockDelegate.GetSendIOMode(session).load(), IO_MODE::IO_SENDING);
+
+	ASSERT_TRUE(handler->IOCompleted(static_cast<IOContext*>(mockRIO.sendContextHistory[0]), 0, THREAD_ID));
+	EXPECT_EQ(mockDelegate.GetSendIOMode(session).load(), IO_MODE::IO_NONE_SENDING);
+}
+
+// ============================================================
+// 15. 지연 커밋 — RIO_MSG_DEFER 게시와 일괄 커밋
+// ============================================================
+
+// ------------------------------------------------------------
+// 지연 커밋 구간에서는 데이터그램을 RIO_MSG_DEFER로 게시하고, 구간이 끝날 때 세션마다 한 번만 커밋하는지 확인합니다.
+// ------------------------------------------------------------
+TEST_F(RUDPIOHandlerTest, DoSend_DeferredCommitScopeDefersPostsAndCommitsOncePerSession)
+{
+	SetupValidSendPath();
+	constexpr unsigned int packetSize = df_HEADER_SIZE + 1;
+	mockDelegate.datagramSizeBudgetReturn = packetSize;
+	for (PacketSequence sequence = 31; sequence <= 32; ++sequence)
+	{
+		SendPacketInfo* info = AllocSerializedSendPacketInfo(sequence);
+		ASSERT_NE(info, nullptr);
+		mockDelegate.queuedSendPacketInfos.push_back(info);
+	}
+
+	handler->BeginDeferredSendCommit();
+	ASSERT_TRUE(handler->DoSend(session, THREAD_ID));
+
+	ASSERT_EQ(mockRIO.rioSendExCallCount, 2);
+	EXPECT_EQ(mockRIO.sendFlagsHistory, (std::vector<ULONG>{ RIO_MSG_DEFER, RIO_MSG_DEFER }));
+	EXPECT_EQ(mockRIO.rioSendCommitCallCount, 0);
+	EXPECT_TRUE(mockDelegate.dummyDeferredSendCommitPending.load());
+
+	handler->CommitDeferredSends();
+	EXPECT_EQ(mockRIO.rioSendCommitCallCount, 1);
+	EXPECT_EQ(mockRIO.commitRequestQueueHistory, (std::vector<RIO_RQ>{ mockDelegate.sendRIORQReturn }));
+	EXPECT_FALSE(mockDelegate.dummyDeferredSendCommitPending.load());
+
+	// 구간이 끝난 뒤에는 다시 커밋할 대상이 없습니다.
+	handler->CommitDeferredSends();
+	EXPECT_EQ(mockRIO.rioSendCommitCallCount, 1);
+
+	ASSERT_TRUE(handler->IOCompleted(static_cast<IOContext*>(mockRIO.sendContextHistory[0]), 0, THREAD_ID));
+	ASSERT_TRUE(handler->IOCompleted(static_cast<IOContext*>(mockRIO.sendContextHistory[1]), 0, THREAD_ID));
+	EXPECT_EQ(mockDelegate.GetSendIOMode(session).load(), IO_MODE::IO_NONE_SENDING);
+}
+
+// ------------------------------------------------------------
+// 지연 커밋 구간 밖의 송신은 플래그 없이 게시되어 별도 커밋을 기다리지 않는지 확인합니다.
+// ------------------------------------------------------------
+TEST_F(RUDPIOHandlerTest, DoSend_OutsideDeferredCommitScopePostsImmediately)
+{
+	SetupValidSendPath();
+	SendPacketInfo* info = AllocSerializedSendPacketInfo(33);
+	ASSERT_NE(info, nullptr);
+	mockDelegate.queuedSendPacketInfos.push_back(info);
+
+	ASSERT_TRUE(handler->DoSend(session, THREAD_ID));
+	EXPECT_EQ(mockRIO.sendFlagsHistory, (std::vector<ULONG>{ 0 }));
+
+	handler->BeginDeferredSendCommit();
+	handler->CommitDeferredSends();
+	EXPECT_EQ(mockRIO.rioSendCommitCallCount, 0);
+
+	CompleteOutstandingSend();
+}
@@ -106,11 +106,12 @@ private:
 // │    minimumCorePacketSize = sizeof(PacketSequence:8)                 │
 // │                          + AUTH_TAG_SIZE:16 = 24                    │
 // │    minimumPacketSize     = sizeof(PacketSequence:8)                 │
+// │                          + piggyback ACK flag:1                     │
 // │                          + sizeof(PacketId:4)                       │
-// │                          + AUTH_TAG_SIZE:16 = 28                    │
+// │                          + AUTH_TAG_SIZE:16 = 29                    │
 // │                                                                     │
 // │  1-byte 버퍼에서 packetType(1B) 을 읽으면 GetUseSize() = 0 이 되어  │
-// │  0 < 24 (또는 28) 조건에서 false 반환 → BCryptDecrypt 미호출.       │
+// │  0 < 24 (또는 29) 조건에서 false 반환 → BCryptDecrypt 미호출.       │
 // │  따라서 fake handle 을 가진 BCrypt API 에 대한 UB/crash 우려가 없다. │
 // └─────────────────────────────────────────────────────────────────────┘
 class RUDPPacketProcessorTest : public ::testing::Test
@@ -184,7 +185,7 @@ protected:
     //    buf[0]     = packetType 바이트
     //    buf[1:2]   = payloadLength = 1  →  GetUseSize() = 1 == GetPayloadLength() = 1
     //    ProcessByPacketType 가 packetType 읽은 후 GetUseSize() = 0
-    //    → DECODE_PACKET 의 minimumSize 체크(0 < 24 or 28)에서 false 반환
+    //    → DECODE_PACKET 의 minimumSize 체크(0 < 24 or 29)에서 false 반환
     //    → BCryptDecrypt 는 절대 호출되지 않는다
     static NetBuffer* MakeSingleBytePacketBuffer(const PACKET_TYPE packetType)
     {
@@ -241,6 +242,7 @@ protected:
         *buf << packetType << packetSequence;
         if (not isCorePacket)
         {
+            RUDPAckFrame::WritePiggybackField(*buf, nullptr);
             *buf << packetId;
         }
 
@@ -957,6 +959,41 @@ TEST_F(RUDPPacketProcessorTest, ProcessByPacketType_HeartbeatReplyDecryptSucceed
 	NetBuffer::Free(buf);
 }
 
+// ------------------------------------------------------------
+// 정상 MTU_PROBE_REPLY 패킷이 복호화되면 일반 응답이 아닌 프로브 응답 처리기로 전달되는지 확인합니다.
+// ------------------------------------------------------------
+TEST_F(RUDPPacketProcessorTest, ProcessByPacketType_MtuProbeReplyDecryptSucceeds_CallsProbeReplyHandler)
+{
+	SetupRealCrypto();
+	mockDelegate.canProcessReturn = true;
+	NetBuffer* buf = MakeEncryptedReceiveBuffer(
+		PACKET_TYPE::MTU_PROBE_REPLY_TYPE, (1ull << 63) | 1, 0, testKey.Get(), mockDelegate.dummySalt, true,
+		PACKET_DIRECTION::CLIENT_TO_SERVER_REPLY);
+	const auto validAddr = MakeValidAddrBuffer();
+
+	processor->OnRecvPacket(session, *buf, std::span<const unsigned char>(validAddr));
+
+	EXPECT_EQ(mockDelegate.onPathMtuProbeReplyCount, 1);
+	EXPECT_EQ(mockDelegate.onSendReplyCount, 0);
+	NetBuffer::Free(buf);
+}
+
+// ------------------------------------------------------------
+// 등록된 클라이언트가 아닌 주소에서 온 MTU_PROBE_REPLY 패킷은 무시하는지 확인합니다.
+// ------------------------------------------------------------
+TEST_F(RUDPPacketProcessorTest, ProcessByPacketType_MtuProbeReply_CanProcessPacketFalse_ProbeReplyHandlerNotCalled)
+{
+	SetupFakeKeyHandle();
+	mockDelegate.canProcessReturn = false;
+	NetBuffer* buf = MakeSingleBytePacketBuffer(PACKET_TYPE::MTU_PROBE_REPLY_TYPE);
+	const auto validAddr = MakeValidAddrBuffer();
+
+	processor->OnRecvPacket(session, *buf, std::span<const unsigned char>(validAddr));
+
+	EXPECT_EQ(mockDelegate.onPathMtuProbeReplyCount, 0);
+	NetBuffer::Free(buf);
+}
+
 // ------------------------------------------------------------
 // 인증 태그가 변조된 패킷이 delegate와 TPS 집계까지 전달되지 않는지 확인합니다.
 // ------------------------------------------------------------
@@ -219,3 +219,65 @@ TEST_F(RUDPReceiveWindowTest, Wraparound_MarkReceivedAcrossSequenceBoundary)
 
 	EXPECT_EQ(rw.GetWindowStart(), 1);
 }
+
+// ------------------------------------------------------------
+// ACK 프레임의 누적 시퀀스는 windowStart 직전 시퀀스여야 한다
+// ------------------------------------------------------------
+TEST_F(RUDPReceiveWindowTest, FillAckFrame_InOrder_HasCumulativeSequenceOnly)
+{
+	rw.Reset(1);
+	rw.MarkReceived(1);
+	rw.MarkReceived(2);
+
+	RUDPAckFrame ackFrame;
+	rw.FillAckFrame(ackFrame);
+
+	EXPECT_EQ(ackFrame.cumulativeSequence, 2);
+	EXPECT_EQ(ackFrame.sackRangeCount, 0);
+	EXPECT_EQ(ackFrame.advertiseWindow, WINDOW_SIZE);
+}
+
+// ------------------------------------------------------------
+// windowStart 이후 수신된 시퀀스들은 연속 구간으로 묶여 SACK 구간이 되어야 한다
+// ------------------------------------------------------------
+TEST_F(RUDPReceiveWindowTest, FillAckFrame_OutOfOrder_GroupsReceivedSequencesIntoSackRanges)
+{
+	rw.MarkReceived(0);
+	rw.MarkReceived(2);
+	rw.MarkReceived(3);
+	rw.MarkReceived(6);
+
+	RUDPAckFrame ackFrame;
+	rw.FillAckFrame(ackFrame);
+
+	EXPECT_EQ(ackFrame.cumulativeSequence, 0);
+	EXPECT_EQ(ackFrame.advertiseWindow, WINDOW_SIZE - 3);
+	ASSERT_EQ(ackFrame.sackRangeCount, 2);
+	EXPECT_EQ(ackFrame.sackRanges[0].first, 2);
+	EXPECT_EQ(ackFrame.sackRanges[0].last, 3);
+	EXPECT_EQ(ackFrame.sackRanges[1].first, 6);
+	EXPECT_EQ(ackFrame.sackRanges[1].last, 6);
+	EXPECT_FALSE(ackFrame.IsCovered(1));
+	EXPECT_TRUE(ackFrame.IsCovered(3));
+}
+
+// ------------------------------------------------------------
+// SACK 구간이 최대 개수를 넘으면 앞쪽 구간만 기록해야 한다
+// ------------------------------------------------------------
+TEST_F(RUDPReceiveWindowTest, FillAckFrame_KeepsLowestRangesWhenRangeCountExceedsLimit)
+{
+	RUDPReceiveWindow wideWindow{ 32 };
+	wideWindow.Reset(1);
+	for (PacketSequence sequence = 2; sequence <= 32; sequence += 2)
+	{
+		wideWindow.MarkReceived(sequence);
+	}
+
+	RUDPAckFrame ackFrame;
+	wideWindow.FillAckFrame(ackFrame);
+
+	ASSERT_EQ(ackFrame.sackRangeCount, MAX_SACK_RANGE_COUNT);
+	EXPECT_EQ(ackFrame.cumulativeSequence, 0);
+	EXPECT_EQ(ackFrame.sackRanges[0].first, 2);
+	EXPECT_EQ(ackFrame.GetHighestCoveredSequence(), MAX_SACK_RANGE_COUNT * 2);
+}
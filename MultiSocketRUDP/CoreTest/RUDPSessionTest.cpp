@@ -5,8 +5,13 @@
 #include "../MultiSocketRUDPServer/RUDPSession.h"
 #include "../MultiSocketRUDPServer/MultiSocketRUDPCore.h"
 #include "../MultiSocketRUDPServer/SendPacketInfo.h"
+#include "../MultiSocketRUDPServer/PacketViewReader.h"
+#include "../Common/PacketCrypto/PacketCryptoHelper.h"
 #include "MultiSocketRUDPCoreTestAccess.h"
 #include "RUDPSessionTestAccess.h"
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace
 {
@@ -34,6 +39,77 @@ namespace
 	public:
 		PacketId GetPacketId() const override { return 1; }
 	};
+
+	class OversizedPacket final : public IPacket
+	{
+	public:
+		PacketId GetPacketId() const override { return 1; }
+		size_t GetSerializedSize() const override { return PacketCryptoHelper::MAX_PACKET_BODY_SIZE + 1; }
+	};
+
+	constexpr PacketId DISPATCH_EMPTY_PACKET_ID = 2;
+	constexpr PacketId DISPATCH_TEXT_VIEW_PACKET_ID = 4;
+	constexpr PacketId DISPATCH_VALUE_PACKET_ID = 5;
+
+	class DispatchEmptyPacket final : public IPacket
+	{
+	public:
+		PacketId GetPacketId() const override { return DISPATCH_EMPTY_PACKET_ID; }
+	};
+
+	class DispatchValuePacket final : public IPacket
+	{
+	public:
+		PacketId GetPacketId() const override { return DISPATCH_VALUE_PACKET_ID; }
+		void BufferToPacket(NetBuffer& buffer) override { buffer >> value; }
+
+		int value{};
+	};
+
+	class DispatchTextPacketView final
+	{
+	public:
+		[[nodiscard]]
+		bool Parse(NetBuffer& buffer) { return SetBufferToViewParameters(buffer, text); }
+
+		std::string_view text{};
+	};
+
+	class PacketDispatchTestSession final : public RUDPSession
+	{
+	public:
+		explicit PacketDispatchTestSession(MultiSocketRUDPCore& inCore) : RUDPSession(inCore)
+		{
+			RegisterPacketHandler<PacketDispatchTestSession, DispatchEmptyPacket>(DISPATCH_EMPTY_PACKET_ID, &PacketDispatchTestSession::OnEmptyPacket);
+			RegisterPacketHandler<PacketDispatchTestSession, DispatchValuePacket>(DISPATCH_VALUE_PACKET_ID, &PacketDispatchTestSession::OnValuePacket);
+			RegisterPacketViewHandler<PacketDispatchTestSession, DispatchTextPacketView>(DISPATCH_TEXT_VIEW_PACKET_ID, &PacketDispatchTestSession::OnTextPacketView);
+		}
+
+		void OnEmptyPacket(const DispatchEmptyPacket&)
+		{
+			++emptyPacketCount;
+		}
+
+		void OnValuePacket(const DispatchValuePacket& packet)
+		{
+			valueSum += packet.value;
+			lastValue = packet.value;
+		}
+
+		void OnTextPacketView(const DispatchTextPacketView& packet)
+		{
+			++textViewCount;
+			lastText = std::string(packet.text);
+			lastTextData = packet.text.data();
+		}
+
+		int emptyPacketCount{};
+		long long valueSum{};
+		int lastValue{};
+		int textViewCount{};
+		std::string lastText;
+		const char* lastTextData{};
+	};
 }
 
 class SessionSocketContextTest : public ::testing::Test
@@ -96,6 +172,215 @@ TEST(RUDPSessionBehaviorTest, DisconnectedSessionRejectsSendAndDisconnectTransit
 	EXPECT_FALSE(session.IsReleasing());
 }
 
+// ------------------------------------------------------------
+// Verifies that a packet whose known body size exceeds the limit is refused
+// before a sequence number is consumed, and the session stays connected.
+// ------------------------------------------------------------
+TEST(RUDPSessionBehaviorTest, SendPacketRejectsOversizedBodyBeforeConsumingSequence)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	RUDPSessionBehaviorAccess::SetMaximumPacketHoldingQueueSize(4);
+	SessionBehaviorTestSession session{ core };
+	RUDPSessionBehaviorAccess::InitializeSession(session);
+	RUDPSessionBehaviorAccess::SetConnected(session);
+	const PacketSequence lastSequence = RUDPSessionBehaviorAccess::GetSendContext(session).GetLastSendPacketSequence();
+
+	OversizedPacket packet;
+	EXPECT_FALSE(session.SendPacket(packet));
+	EXPECT_EQ(RUDPSessionBehaviorAccess::GetSendContext(session).GetLastSendPacketSequence(), lastSequence);
+	EXPECT_EQ(session.GetSessionState(), SESSION_STATE::CONNECTED);
+}
+
+// ------------------------------------------------------------
+// Verifies that one oversized packet makes the whole batch fail before any
+// sequence number is reserved, and the session stays connected.
+// ------------------------------------------------------------
+TEST(RUDPSessionBehaviorTest, SendPacketsRejectsWholeBatchBeforeReservingSequences)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	RUDPSessionBehaviorAccess::SetMaximumPacketHoldingQueueSize(4);
+	SessionBehaviorTestSession session{ core };
+	RUDPSessionBehaviorAccess::InitializeSession(session);
+	RUDPSessionBehaviorAccess::SetConnected(session);
+	const PacketSequence lastSequence = RUDPSessionBehaviorAccess::GetSendContext(session).GetLastSendPacketSequence();
+
+	DispatchEmptyPacket smallPacket;
+	OversizedPacket oversizedPacket;
+	IPacket* packets[] = { &smallPacket, &oversizedPacket, &smallPacket };
+	EXPECT_FALSE(session.SendPackets(packets));
+	EXPECT_EQ(RUDPSessionBehaviorAccess::GetSendContext(session).GetLastSendPacketSequence(), lastSequence);
+	EXPECT_TRUE(RUDPSessionBehaviorAccess::GetSendContext(session).IsPendingQueueEmpty());
+	EXPECT_EQ(session.GetSessionState(), SESSION_STATE::CONNECTED);
+}
+
+// ------------------------------------------------------------
+// Verifies that an empty batch on a connected session is a successful no-op.
+// ------------------------------------------------------------
+TEST(RUDPSessionBehaviorTest, SendPacketsWithEmptyBatchSucceedsWithoutReservingSequences)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	RUDPSessionBehaviorAccess::SetMaximumPacketHoldingQueueSize(4);
+	SessionBehaviorTestSession session{ core };
+	RUDPSessionBehaviorAccess::InitializeSession(session);
+	RUDPSessionBehaviorAccess::SetConnected(session);
+	const PacketSequence lastSequence = RUDPSessionBehaviorAccess::GetSendContext(session).GetLastSendPacketSequence();
+
+	EXPECT_TRUE(session.SendPackets({}));
+	EXPECT_EQ(RUDPSessionBehaviorAccess::GetSendContext(session).GetLastSendPacketSequence(), lastSequence);
+}
+
+// ------------------------------------------------------------
+// Verifies that on a session blocked by the congestion window, a broadcast
+// body gets this session's own header and sequence, waits unencrypted in the
+// pending queue, asks for no flush schedule because the next ACK drains it,
+// and leaves the shared body untouched.
+// ------------------------------------------------------------
+TEST(RUDPSessionBehaviorTest, EnqueueBroadcastBodyQueuesOwnHeaderAndSharedBody)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	RUDPSessionBehaviorAccess::SetMaximumPacketHoldingQueueSize(4);
+	SessionBehaviorTestSession session{ core };
+	RUDPSessionBehaviorAccess::InitializeSession(session);
+	RUDPSessionBehaviorAccess::SetConnected(session);
+	SessionSendContext& sendContext = RUDPSessionBehaviorAccess::GetSendContext(session);
+	sendContext.InitializePendingQueue(4);
+	// Nothing is acked yet, so sequences past the initial window cannot take the immediate path.
+	const PacketSequence firstBroadcastSequence = sendContext.ReserveSendPacketSequences(INITIAL_CONGESTION_WINDOW) + INITIAL_CONGESTION_WINDOW;
+	ASSERT_FALSE(RUDPSessionBehaviorAccess::GetFlowManager(session).CanSend(firstBroadcastSequence));
+
+	NetBuffer* sharedBody = NetBuffer::Alloc();
+	ASSERT_NE(sharedBody, nullptr);
+	constexpr PacketId BROADCAST_PACKET_ID = 7;
+	constexpr uint32_t BROADCAST_VALUE = 42;
+	*sharedBody << BROADCAST_PACKET_ID << BROADCAST_VALUE;
+	const int sharedBodySize = sharedBody->GetUseSize();
+
+	bool needsFlushSchedule = false;
+	std::chrono::steady_clock::time_point flushTime{};
+	ASSERT_TRUE(RUDPSessionBehaviorAccess::EnqueueBroadcastBody(session, *sharedBody, needsFlushSchedule, flushTime));
+	EXPECT_FALSE(needsFlushSchedule);
+	ASSERT_TRUE(RUDPSessionBehaviorAccess::EnqueueBroadcastBody(session, *sharedBody, needsFlushSchedule, flushTime));
+	EXPECT_FALSE(needsFlushSchedule);
+	EXPECT_EQ(sharedBody->GetUseSize(), sharedBodySize);
+	EXPECT_EQ(sendContext.GetLastSendPacketSequence(), firstBroadcastSequence + 1);
+
+	for (PacketSequence expectedSequence = firstBroadcastSequence; expectedSequence <= firstBroadcastSequence + 1; ++expectedSequence)
+	{
+		std::pair<PacketSequence, NetBuffer*> item;
+		ASSERT_TRUE(sendContext.PopFromPendingQueue(item));
+		EXPECT_EQ(item.first, expectedSequence);
+		EXPECT_FALSE(item.second->m_bIsEncoded);
+
+		PACKET_TYPE packetType{};
+		PacketSequence packetSequence{};
+		BYTE piggybackAckFlag{};
+		PacketId packetId{};
+		uint32_t value{};
+		*item.second >> packetType >> packetSequence >> piggybackAckFlag >> packetId >> value;
+		EXPECT_EQ(packetType, PACKET_TYPE::SEND_TYPE);
+		EXPECT_EQ(packetSequence, expectedSequence);
+		EXPECT_EQ(piggybackAckFlag, RUDPAckFrame::PIGGYBACK_ACK_ABSENT);
+		EXPECT_EQ(packetId, BROADCAST_PACKET_ID);
+		EXPECT_EQ(value, BROADCAST_VALUE);
+		NetBuffer::Free(item.second);
+	}
+
+	EXPECT_TRUE(sendContext.IsPendingQueueEmpty());
+	EXPECT_EQ(session.GetSessionState(), SESSION_STATE::CONNECTED);
+	NetBuffer::Free(sharedBody);
+}
+
+// ------------------------------------------------------------
+// Verifies that a broadcast to a session the congestion window allows is
+// still left unencrypted in the pending queue for the owning IO worker,
+// with one flush due now; a second body rides on that same flush.
+// ------------------------------------------------------------
+TEST(RUDPSessionBehaviorTest, EnqueueBroadcastBodyHandsSendableSessionToIOWorker)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	RUDPSessionBehaviorAccess::SetMaximumPacketHoldingQueueSize(4);
+	SessionBehaviorTestSession session{ core };
+	RUDPSessionBehaviorAccess::InitializeSession(session);
+	RUDPSessionBehaviorAccess::SetConnected(session);
+	SessionSendContext& sendContext = RUDPSessionBehaviorAccess::GetSendContext(session);
+	sendContext.InitializePendingQueue(4);
+	const PacketSequence firstBroadcastSequence = sendContext.GetLastSendPacketSequence() + 1;
+	ASSERT_TRUE(RUDPSessionBehaviorAccess::GetFlowManager(session).CanSend(firstBroadcastSequence));
+
+	NetBuffer* sharedBody = NetBuffer::Alloc();
+	ASSERT_NE(sharedBody, nullptr);
+	*sharedBody << PacketId{ 7 } << uint32_t{ 42 };
+
+	bool needsFlushSchedule = false;
+	std::chrono::steady_clock::time_point flushTime{};
+	ASSERT_TRUE(RUDPSessionBehaviorAccess::EnqueueBroadcastBody(session, *sharedBody, needsFlushSchedule, flushTime));
+	EXPECT_TRUE(needsFlushSchedule);
+	EXPECT_LE(flushTime, std::chrono::steady_clock::now());
+	ASSERT_TRUE(RUDPSessionBehaviorAccess::EnqueueBroadcastBody(session, *sharedBody, needsFlushSchedule, flushTime));
+	EXPECT_FALSE(needsFlushSchedule);
+
+	for (PacketSequence expectedSequence = firstBroadcastSequence; expectedSequence <= firstBroadcastSequence + 1; ++expectedSequence)
+	{
+		std::pair<PacketSequence, NetBuffer*> item;
+		ASSERT_TRUE(sendContext.PopFromPendingQueue(item));
+		EXPECT_EQ(item.first, expectedSequence);
+		EXPECT_FALSE(item.second->m_bIsEncoded);
+		NetBuffer::Free(item.second);
+	}
+
+	EXPECT_TRUE(sendContext.IsPendingQueueEmpty());
+	NetBuffer::Free(sharedBody);
+}
+
+// ------------------------------------------------------------
+// Verifies that a full pending queue only skips this session: no sequence
+// is consumed, the queued packet stays, and the session stays connected.
+// ------------------------------------------------------------
+TEST(RUDPSessionBehaviorTest, EnqueueBroadcastBodyWithFullPendingQueueKeepsSessionConnected)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	RUDPSessionBehaviorAccess::SetMaximumPacketHoldingQueueSize(4);
+	SessionBehaviorTestSession session{ core };
+	RUDPSessionBehaviorAccess::InitializeSession(session);
+	RUDPSessionBehaviorAccess::SetConnected(session);
+	SessionSendContext& sendContext = RUDPSessionBehaviorAccess::GetSendContext(session);
+	sendContext.InitializePendingQueue(1);
+	std::ignore = sendContext.ReserveSendPacketSequences(INITIAL_CONGESTION_WINDOW);
+
+	NetBuffer* sharedBody = NetBuffer::Alloc();
+	ASSERT_NE(sharedBody, nullptr);
+	*sharedBody << PacketId{ 7 } << uint32_t{ 42 };
+
+	bool needsFlushSchedule = false;
+	std::chrono::steady_clock::time_point flushTime{};
+	ASSERT_TRUE(RUDPSessionBehaviorAccess::EnqueueBroadcastBody(session, *sharedBody, needsFlushSchedule, flushTime));
+	ASSERT_TRUE(sendContext.IsPendingQueueFull());
+	const PacketSequence lastSequence = sendContext.GetLastSendPacketSequence();
+
+	EXPECT_FALSE(RUDPSessionBehaviorAccess::EnqueueBroadcastBody(session, *sharedBody, needsFlushSchedule, flushTime));
+	EXPECT_FALSE(needsFlushSchedule);
+	EXPECT_EQ(sendContext.GetLastSendPacketSequence(), lastSequence);
+	EXPECT_EQ(session.GetSessionState(), SESSION_STATE::CONNECTED);
+
+	std::pair<PacketSequence, NetBuffer*> item;
+	ASSERT_TRUE(sendContext.PopFromPendingQueue(item));
+	EXPECT_EQ(item.first, lastSequence);
+	NetBuffer::Free(item.second);
+	NetBuffer::Free(sharedBody);
+}
+
+// ------------------------------------------------------------
+// Verifies that Broadcast refuses an oversized body before looking up any session.
+// ------------------------------------------------------------
+TEST(RUDPSessionBehaviorTest, BroadcastRejectsOversizedBodyBeforeTouchingSessions)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	OversizedPacket packet;
+	const SessionIdType sessionIds[] = { 0, 1, 2 };
+
+	EXPECT_FALSE(core.Broadcast(packet, sessionIds));
+}
+
 TEST(RUDPSessionBehaviorTest, OnRecvPacketUnknownPacketIdReturnsFalse)
 {
 	MultiSocketRUDPCore core{ L"", L"" };
@@ -105,7 +390,115 @@ TEST(RUDPSessionBehaviorTest, OnRecvPacketUnknownPacketIdReturnsFalse)
 	NetBuffer* buffer = NetBuffer::Alloc();
 	ASSERT_NE(buffer, nullptr);
 
-	*buffer << PacketSequence{ 0 } << PacketId{ 9999 };
+	*buffer << PacketSequence{ 0 } << RUDPAckFrame::PIGGYBACK_ACK_ABSENT << PacketId{ 9999 };
+
+	EXPECT_FALSE(RUDPSessionBehaviorAccess::OnRecvPacket(session, *buffer));
+
+	NetBuffer::Free(buffer);
+}
+
+// ------------------------------------------------------------
+// Verifies that each registered packet id reaches its own handler with the decoded packet.
+// ------------------------------------------------------------
+TEST(RUDPSessionBehaviorTest, ProcessPacketDispatchesRegisteredHandlerByPacketId)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	RUDPSessionBehaviorAccess::SetMaximumPacketHoldingQueueSize(4);
+	PacketDispatchTestSession session{ core };
+	RUDPSessionBehaviorAccess::InitializeSession(session);
+
+	NetBuffer packet;
+	packet.Init();
+	packet << DISPATCH_VALUE_PACKET_ID << 42;
+	EXPECT_TRUE(RUDPSessionBehaviorAccess::ProcessPacket(session, packet, 0));
+	EXPECT_EQ(session.lastValue, 42);
+
+	// The per-thread packet object is reused, so the second decode must overwrite the first value.
+	packet.Init();
+	packet << DISPATCH_VALUE_PACKET_ID << 7;
+	EXPECT_TRUE(RUDPSessionBehaviorAccess::ProcessPacket(session, packet, 1));
+	EXPECT_EQ(session.lastValue, 7);
+	EXPECT_EQ(session.valueSum, 49);
+
+	packet.Init();
+	packet << DISPATCH_EMPTY_PACKET_ID;
+	EXPECT_TRUE(RUDPSessionBehaviorAccess::ProcessPacket(session, packet, 2));
+	EXPECT_EQ(session.emptyPacketCount, 1);
+}
+
+// ------------------------------------------------------------
+// Verifies that ids inside the table without a handler and ids past its end are both rejected.
+// ------------------------------------------------------------
+TEST(RUDPSessionBehaviorTest, ProcessPacketRejectsUnregisteredIdsInsideAndPastTable)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	RUDPSessionBehaviorAccess::SetMaximumPacketHoldingQueueSize(4);
+	PacketDispatchTestSession session{ core };
+	RUDPSessionBehaviorAccess::InitializeSession(session);
+
+	for (const PacketId packetId : { PacketId{ 0 }, PacketId{ 3 }, DISPATCH_VALUE_PACKET_ID + 1 })
+	{
+		NetBuffer packet;
+		packet.Init();
+		packet << packetId << 1;
+		EXPECT_FALSE(RUDPSessionBehaviorAccess::ProcessPacket(session, packet, 0));
+	}
+	EXPECT_EQ(session.emptyPacketCount, 0);
+	EXPECT_EQ(session.valueSum, 0);
+}
+
+// ------------------------------------------------------------
+// Verifies that a view handler receives string fields that point into the received buffer.
+// ------------------------------------------------------------
+TEST(RUDPSessionBehaviorTest, ProcessPacketDispatchesViewHandlerWithoutCopyingStrings)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	RUDPSessionBehaviorAccess::SetMaximumPacketHoldingQueueSize(4);
+	PacketDispatchTestSession session{ core };
+	RUDPSessionBehaviorAccess::InitializeSession(session);
+
+	NetBuffer packet;
+	packet.Init();
+	packet << DISPATCH_TEXT_VIEW_PACKET_ID << std::string("view payload");
+	const char* bufferBegin = packet.GetBufferPtr();
+	const char* bufferEnd = bufferBegin + packet.GetAllUseSize();
+
+	ASSERT_TRUE(RUDPSessionBehaviorAccess::ProcessPacket(session, packet, 0));
+	EXPECT_EQ(session.textViewCount, 1);
+	EXPECT_EQ(session.lastText, "view payload");
+	EXPECT_GE(session.lastTextData, bufferBegin);
+	EXPECT_LT(session.lastTextData, bufferEnd);
+}
+
+// ------------------------------------------------------------
+// Verifies that a view whose string length runs past the buffer is rejected before the handler runs.
+// ------------------------------------------------------------
+TEST(RUDPSessionBehaviorTest, ProcessPacketRejectsMalformedViewPacket)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	RUDPSessionBehaviorAccess::SetMaximumPacketHoldingQueueSize(4);
+	PacketDispatchTestSession session{ core };
+	RUDPSessionBehaviorAccess::InitializeSession(session);
+
+	NetBuffer packet;
+	packet.Init();
+	packet << DISPATCH_TEXT_VIEW_PACKET_ID << uint16_t{ 64 } << BYTE{ 'a' };
+
+	EXPECT_FALSE(RUDPSessionBehaviorAccess::ProcessPacket(session, packet, 0));
+	EXPECT_EQ(session.textViewCount, 0);
+}
+
+TEST(RUDPSessionBehaviorTest, OnRecvPacketMalformedPiggybackAckReturnsFalse)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	RUDPSessionBehaviorAccess::SetMaximumPacketHoldingQueueSize(4);
+	SessionBehaviorTestSession session{ core };
+	RUDPSessionBehaviorAccess::InitializeSession(session);
+	NetBuffer* buffer = NetBuffer::Alloc();
+	ASSERT_NE(buffer, nullptr);
+
+	constexpr BYTE truncatedSackRangeCount = 2;
+	*buffer << PacketSequence{ 0 } << RUDPAckFrame::PIGGYBACK_ACK_PRESENT << PacketSequence{ 0 } << BYTE{ 0 } << truncatedSackRangeCount;
 
 	EXPECT_FALSE(RUDPSessionBehaviorAccess::OnRecvPacket(session, *buffer));
 
@@ -186,7 +579,8 @@ TEST(RUDPSessionBehaviorTest, OnSendReplyErasesTrackedSendPacketInfo)
 	ASSERT_EQ(RUDPSessionBehaviorAccess::GetSendContext(session).FindSendPacketInfo(sequence), info);
 
 	NetBuffer reply;
-	reply << sequence << BYTE{ 1 };
+	reply << RUDPAckFrame::REPLY_SEQUENCE_FLAG;
+	RUDPAckFrame{ .cumulativeSequence = sequence, .advertiseWindow = 1 }.WriteTo(reply);
 	RUDPSessionBehaviorAccess::OnSendReply(session, reply);
 
 	EXPECT_EQ(RUDPSessionBehaviorAccess::GetSendContext(session).FindSendPacketInfo(sequence), nullptr);
@@ -322,12 +716,14 @@ TEST(RUDPSessionBehaviorTest, OnSendReplyIgnoresFutureAndUnknownSequences)
 	RUDPSessionBehaviorAccess::GetSendContext(session).InsertSendPacketInfo(1, info);
 
 	NetBuffer futureReply;
-	futureReply << PacketSequence{ 2 } << BYTE{ 1 };
+	futureReply << RUDPAckFrame::REPLY_SEQUENCE_FLAG;
+	RUDPAckFrame{ .cumulativeSequence = 2, .advertiseWindow = 1 }.WriteTo(futureReply);
 	RUDPSessionBehaviorAccess::OnSendReply(session, futureReply);
 	EXPECT_EQ(RUDPSessionBehaviorAccess::GetSendContext(session).FindSendPacketInfo(1), info);
 
 	NetBuffer unknownReply;
-	unknownReply << PacketSequence{ 0 } << BYTE{ 1 };
+	unknownReply << RUDPAckFrame::REPLY_SEQUENCE_FLAG;
+	RUDPAckFrame{ .cumulativeSequence = 0, .advertiseWindow = 1 }.WriteTo(unknownReply);
 	RUDPSessionBehaviorAccess::OnSendReply(session, unknownReply);
 	EXPECT_EQ(RUDPSessionBehaviorAccess::GetSendContext(session).FindSendPacketInfo(1), info);
 
@@ -335,3 +731,47 @@ TEST(RUDPSessionBehaviorTest, OnSendReplyIgnoresFutureAndUnknownSequences)
 	SendPacketInfo::Free(info);
 	SendPacketInfo::Free(info);
 }
+
+TEST(RUDPSessionBehaviorTest, OnSendReplyRetiresCumulativeAndSackCoveredSequencesTogether)
+{
+	MultiSocketRUDPCore core{ L"", L"" };
+	SessionBehaviorTestSession session{ core };
+	auto& sendContext = RUDPSessionBehaviorAccess::GetSendContext(session);
+
+	std::vector<SendPacketInfo*> infos;
+	for (PacketSequence sequence = 1; sequence <= 5; ++sequence)
+	{
+		NetBuffer* sendBuffer = NetBuffer::Alloc();
+		SendPacketInfo* info = sendPacketInfoPool->Alloc();
+		ASSERT_NE(sendBuffer, nullptr);
+		ASSERT_NE(info, nullptr);
+		info->Initialize(&session, session.GetSessionGeneration(), sendBuffer, sequence, false);
+		sendContext.InsertSendPacketInfo(sequence, info);
+		std::ignore = sendContext.IncrementLastSendPacketSequence();
+		infos.push_back(info);
+	}
+
+	RUDPAckFrame ackFrame{ .cumulativeSequence = 2, .advertiseWindow = 1 };
+	ASSERT_TRUE(ackFrame.AddSackRange(4, 4));
+
+	NetBuffer reply;
+	reply << RUDPAckFrame::REPLY_SEQUENCE_FLAG;
+	ackFrame.WriteTo(reply);
+	RUDPSessionBehaviorAccess::OnSendReply(session, reply);
+
+	EXPECT_EQ(sendContext.FindSendPacketInfo(1), nullptr);
+	EXPECT_EQ(sendContext.FindSendPacketInfo(2), nullptr);
+	EXPECT_EQ(sendContext.FindSendPacketInfo(3), infos[2]);
+	EXPECT_EQ(sendContext.FindSendPacketInfo(4), nullptr);
+	EXPECT_EQ(sendContext.FindSendPacketInfo(5), infos[4]);
+	EXPECT_TRUE(infos[3]->isErasedPacketInfo.load(std::memory_order_acquire));
+	EXPECT_FALSE(infos[2]->isErasedPacketInfo.load(std::memory_order_acquire));
+	// The SACKed sequence 4 sits past the hole at 3, so congestion control only moves to the cumulative sequence.
+	EXPECT_EQ(RUDPSessionBehaviorAccess::GetFlowManager(session).GetLastAckedSequence(), 2u);
+
+	sendContext.ForEachAndClearSendPacketInfoMap([](SendPacketInfo* info) { SendPacketInfo::Free(info); });
+	for (SendPacketInfo* info : infos)
+	{
+		SendPacketInfo::Free(info);
+	}
+}
@@ -10,6 +10,11 @@ public:
 		return session.OnRecvPacket(recvPacket);
 	}
 
+	static bool ProcessPacket(RUDPSession& session, NetBuffer& recvPacket, const PacketSequence sequence)
+	{
+		return session.ProcessPacket(recvPacket, sequence);
+	}
+
 	static bool IsOlderRecvSequence(
 		const PacketSequence sequence,
 		const PacketSequence expectedSequence)
@@ -27,6 +32,11 @@ public:
 		return session.GetSendContext();
 	}
 
+	static const RUDPFlowManager& GetFlowManager(const RUDPSession& session)
+	{
+		return session.flowManager;
+	}
+
 	static void InitializeSession(RUDPSession& session)
 	{
 		session.InitializeSession();
@@ -137,4 +147,9 @@ public:
 	{
 		RUDPSession::SetMaximumPacketHoldingQueueSize(size);
 	}
+
+	static bool EnqueueBroadcastBody(RUDPSession& session, NetBuffer& sharedBody, bool& needsFlushSchedule, std::chrono::steady_clock::time_point& flushTime)
+	{
+		return session.EnqueueBroadcastBody(sharedBody, needsFlushSchedule, flushTime);
+	}
 };
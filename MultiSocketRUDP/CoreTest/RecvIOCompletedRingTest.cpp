@@ -0,0 +1,126 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "RecvIOCompletedRing.h"
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	// 링은 포인터를 역참조하지 않으므로 순번을 포인터 값으로 써서 순서를 확인합니다.
+	RecvIOCompletedContext* MakeFakeContext(const uintptr_t sequence)
+	{
+		return reinterpret_cast<RecvIOCompletedContext*>(sequence);
+	}
+}
+
+// ------------------------------------------------------------
+// 용량을 2의 거듭제곱으로 올려 잡고, 여러 번 감겨도 넣은 순서대로 묶어서 꺼내는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvIOCompletedRingTest, DequeueBatchPreservesOrderAcrossWraparound)
+{
+	RecvIOCompletedRing ring{ 3 };
+	ASSERT_EQ(ring.GetCapacity(), 4u);
+
+	std::array<RecvIOCompletedContext*, 3> batch{};
+	uintptr_t nextEnqueue = 1;
+	uintptr_t nextExpected = 1;
+	for (int round = 0; round < 5; ++round)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			ASSERT_TRUE(ring.TryEnqueue(MakeFakeContext(nextEnqueue++)));
+		}
+
+		size_t dequeued = 0;
+		while (const size_t count = ring.DequeueBatch(batch))
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				EXPECT_EQ(batch[i], MakeFakeContext(nextExpected++));
+			}
+			dequeued += count;
+		}
+		EXPECT_EQ(dequeued, 3u);
+	}
+	EXPECT_EQ(ring.DequeueBatch(batch), 0u);
+}
+
+// ------------------------------------------------------------
+// 가득 찬 링은 새 항목을 거부하고 버린 수를 세며, 자리가 나면 다시 받는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvIOCompletedRingTest, FullRingRejectsAndCountsDrops)
+{
+	RecvIOCompletedRing ring{ 2 };
+	ASSERT_TRUE(ring.TryEnqueue(MakeFakeContext(1)));
+	ASSERT_TRUE(ring.TryEnqueue(MakeFakeContext(2)));
+	EXPECT_FALSE(ring.TryEnqueue(MakeFakeContext(3)));
+	EXPECT_EQ(ring.GetDroppedCount(), 1u);
+
+	std::array<RecvIOCompletedContext*, 1> batch{};
+	ASSERT_EQ(ring.DequeueBatch(batch), 1u);
+	EXPECT_EQ(batch[0], MakeFakeContext(1));
+	EXPECT_TRUE(ring.TryEnqueue(MakeFakeContext(4)));
+	EXPECT_EQ(ring.GetDroppedCount(), 1u);
+}
+
+// ------------------------------------------------------------
+// 소비자가 잠들겠다고 알린 뒤에만 한 번 깨우고, 이미 항목이 있으면 잠들지 않는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvIOCompletedRingTest, WakesConsumerOnlyWhileWaiting)
+{
+	RecvIOCompletedRing ring{ 8 };
+	ASSERT_TRUE(ring.TryEnqueue(MakeFakeContext(1)));
+	EXPECT_FALSE(ring.ShouldWakeConsumer());
+	EXPECT_FALSE(ring.PrepareWait());
+
+	std::array<RecvIOCompletedContext*, 8> batch{};
+	ASSERT_EQ(ring.DequeueBatch(batch), 1u);
+	ASSERT_TRUE(ring.PrepareWait());
+
+	ASSERT_TRUE(ring.TryEnqueue(MakeFakeContext(2)));
+	EXPECT_TRUE(ring.ShouldWakeConsumer());
+	ASSERT_TRUE(ring.TryEnqueue(MakeFakeContext(3)));
+	EXPECT_FALSE(ring.ShouldWakeConsumer());
+
+	ring.FinishWait();
+	EXPECT_EQ(ring.DequeueBatch(batch), 2u);
+}
+
+// ------------------------------------------------------------
+// 생산자와 소비자 스레드가 동시에 돌아도 모든 항목이 순서대로 한 번씩 전달되는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvIOCompletedRingTest, ConcurrentProducerAndConsumerTransferAllInOrder)
+{
+	constexpr uintptr_t itemCount = 200000;
+	RecvIOCompletedRing ring{ 64 };
+
+	std::jthread producer([&ring]()
+		{
+			for (uintptr_t sequence = 1; sequence <= itemCount; ++sequence)
+			{
+				while (not ring.TryEnqueue(MakeFakeContext(sequence)))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+	std::array<RecvIOCompletedContext*, 16> batch{};
+	uintptr_t nextExpected = 1;
+	bool isInOrder = true;
+	while (nextExpected <= itemCount)
+	{
+		const size_t count = ring.DequeueBatch(batch);
+		for (size_t i = 0; i < count; ++i)
+		{
+			isInOrder = isInOrder && batch[i] == MakeFakeContext(nextExpected);
+			++nextExpected;
+		}
+	}
+	producer.join();
+
+	EXPECT_TRUE(isInOrder);
+	EXPECT_EQ(nextExpected, itemCount + 1);
+}
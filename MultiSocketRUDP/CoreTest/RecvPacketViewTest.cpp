@@ -0,0 +1,136 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "../Common/etc/CoreType.h"
+#include "RecvPacketView.h"
+#include "SessionPacketOrderer.h"
+#include <cstring>
+#include <vector>
+
+namespace
+{
+	void FillPacket(char* packet, const unsigned int packetSize, const char value)
+	{
+		std::memset(packet, value, packetSize);
+	}
+}
+
+// ------------------------------------------------------------
+// 뷰가 슬롯 메모리를 직접 가리키고, 분리하면 원래 버퍼로 돌아가는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvPacketViewTest, AttachPointsIntoSlotAndDetachRestoresOwnedBuffer)
+{
+	char slot[64];
+	FillPacket(slot, sizeof(slot), 0x11);
+
+	RecvPacketView view;
+	EXPECT_FALSE(view.IsAttached());
+
+	NetBuffer& buffer = view.Attach(&slot[8], 16);
+	char* const attachedBuffer = buffer.m_pSerializeBuffer;
+	EXPECT_TRUE(view.IsAttached());
+	EXPECT_EQ(attachedBuffer, &slot[8]);
+	EXPECT_EQ(buffer.m_iWrite, 16);
+
+	view.Detach();
+	EXPECT_FALSE(view.IsAttached());
+	EXPECT_NE(buffer.m_pSerializeBuffer, &slot[8]);
+
+	// 다시 붙여도 같은 뷰를 재사용합니다.
+	NetBuffer& reattached = view.Attach(slot, 4);
+	EXPECT_EQ(&reattached, &buffer);
+	EXPECT_EQ(reattached.m_pSerializeBuffer, slot);
+	EXPECT_EQ(reattached.m_iWrite, 4);
+}
+
+// ------------------------------------------------------------
+// 처리 중인 뷰를 보관하면 읽기 위치까지 복사된 별도 버퍼를 받아, 슬롯이 재사용되어도 내용이 유지되는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvPacketViewTest, AcquireHoldingBufferCopiesBorrowedPacket)
+{
+	char slot[32];
+	FillPacket(slot, sizeof(slot), 0x22);
+
+	RecvPacketView view;
+	NetBuffer& buffer = view.Attach(slot, sizeof(slot));
+	buffer.m_iRead = 7;
+
+	NetBuffer* holdingBuffer = nullptr;
+	{
+		const RecvPacketView::DispatchScope dispatchScope(&buffer);
+		holdingBuffer = RecvPacketView::AcquireHoldingBuffer(buffer);
+	}
+	ASSERT_NE(holdingBuffer, nullptr);
+	EXPECT_NE(holdingBuffer, &buffer);
+	EXPECT_EQ(holdingBuffer->m_iRead, 7);
+	EXPECT_EQ(holdingBuffer->m_iWrite, sizeof(slot));
+
+	FillPacket(slot, sizeof(slot), 0x33);
+	for (unsigned int i = 0; i < sizeof(slot); ++i)
+	{
+		EXPECT_EQ(holdingBuffer->m_pSerializeBuffer[i], 0x22);
+	}
+
+	NetBuffer::Free(holdingBuffer);
+}
+
+// ------------------------------------------------------------
+// 풀에서 할당된 일반 NetBuffer는 복사하지 않고 참조 수만 늘리는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvPacketViewTest, AcquireHoldingBufferAddsReferenceToPooledBuffer)
+{
+	NetBuffer* buffer = NetBuffer::Alloc();
+	ASSERT_NE(buffer, nullptr);
+
+	NetBuffer* holdingBuffer = nullptr;
+	{
+		// 다른 패킷이 처리 중이어도 그 뷰가 아니면 복사하지 않습니다.
+		RecvPacketView view;
+		char slot[8]{};
+		const RecvPacketView::DispatchScope dispatchScope(&view.Attach(slot, sizeof(slot)));
+		holdingBuffer = RecvPacketView::AcquireHoldingBuffer(*buffer);
+	}
+	EXPECT_EQ(holdingBuffer, buffer);
+
+	NetBuffer::Free(holdingBuffer);
+	NetBuffer::Free(buffer);
+}
+
+// ------------------------------------------------------------
+// SessionPacketOrderer가 순서가 어긋난 뷰를 보류하면 복사본을 들고 있다가, 슬롯이 재사용된 뒤에도 원래 내용으로 처리하는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvPacketViewTest, SessionPacketOrdererHoldsCopyOfBorrowedPacket)
+{
+	SessionPacketOrderer orderer{ 4 };
+	orderer.Reset(1);
+
+	char slot[16];
+	RecvPacketView view;
+	std::vector<char> processedFirstBytes;
+	const auto recorder = [&processedFirstBytes](NetBuffer& buffer, PacketSequence) -> bool
+		{
+			processedFirstBytes.push_back(buffer.m_pSerializeBuffer[0]);
+			return true;
+		};
+
+	FillPacket(slot, sizeof(slot), 0x02);
+	{
+		NetBuffer& buffer = view.Attach(slot, sizeof(slot));
+		const RecvPacketView::DispatchScope dispatchScope(&buffer);
+		EXPECT_EQ(orderer.OnReceive(2, buffer, recorder), ON_RECV_RESULT::PACKET_HELD);
+	}
+	view.Detach();
+
+	// 슬롯이 다시 게시되어 다음 패킷으로 덮어써집니다.
+	FillPacket(slot, sizeof(slot), 0x01);
+	{
+		NetBuffer& buffer = view.Attach(slot, sizeof(slot));
+		const RecvPacketView::DispatchScope dispatchScope(&buffer);
+		EXPECT_EQ(orderer.OnReceive(1, buffer, recorder), ON_RECV_RESULT::PROCESSED);
+	}
+	view.Detach();
+
+	ASSERT_EQ(processedFirstBytes.size(), 2u);
+	EXPECT_EQ(processedFirstBytes[0], 0x01);
+	EXPECT_EQ(processedFirstBytes[1], 0x02);
+	EXPECT_EQ(orderer.GetNextExpected(), 3u);
+}
@@ -0,0 +1,236 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "../Common/etc/CoreType.h"
+#include "RecvBuffer.h"
+#include "RecvDepthController.h"
+#include "RecvSlotPool.h"
+#include <vector>
+
+namespace
+{
+	int gRegisterCallCount = 0;
+	int gDeregisterCallCount = 0;
+	int gFailRegisterCallIndex = 0;
+
+	RIO_BUFFERID WINAPI CountingRegisterBuffer(PCHAR, DWORD)
+	{
+		++gRegisterCallCount;
+		if (gFailRegisterCallIndex == gRegisterCallCount)
+		{
+			return RIO_INVALID_BUFFERID;
+		}
+
+		return reinterpret_cast<RIO_BUFFERID>(static_cast<intptr_t>(gRegisterCallCount));
+	}
+
+	void WINAPI CountingDeregisterBuffer(RIO_BUFFERID)
+	{
+		++gDeregisterCallCount;
+	}
+
+	RIO_EXTENSION_FUNCTION_TABLE MakeCountingRioTable(const int failRegisterCallIndex = 0)
+	{
+		gRegisterCallCount = 0;
+		gDeregisterCallCount = 0;
+		gFailRegisterCallIndex = failRegisterCallIndex;
+
+		RIO_EXTENSION_FUNCTION_TABLE table{};
+		table.RIORegisterBuffer = CountingRegisterBuffer;
+		table.RIODeregisterBuffer = CountingDeregisterBuffer;
+		return table;
+	}
+
+	void RecordCompletions(RecvDepthController& controller, const unsigned int count, const unsigned long long now)
+	{
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			controller.OnRecvCompleted(now);
+		}
+	}
+}
+
+// ------------------------------------------------------------
+// 묶음 하나를 RIO 버퍼 하나로 등록하고, 각 슬롯의 RIO_BUF가 그 버퍼 안의 서로 다른 오프셋을 가리키는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvSlotPoolTest, ChunkIsRegisteredOnceAndSlotsUseOffsetsInsideIt)
+{
+	const auto table = MakeCountingRioTable();
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
+	EXPECT_EQ(gRegisterCallCount, 1);
+	EXPECT_EQ(pool.GetCapacity(), RECV_SLOT_POOL_CHUNK_SIZE);
+
+	IOContext* first = pool.Acquire();
+	IOContext* second = pool.Acquire();
+	ASSERT_NE(first, nullptr);
+	ASSERT_NE(second, nullptr);
+	EXPECT_EQ(first->BufferId, second->BufferId);
+	EXPECT_EQ(first->clientAddrRIOBuffer.BufferId, first->BufferId);
+	EXPECT_EQ(first->localAddrRIOBuffer.BufferId, first->BufferId);
+	EXPECT_NE(first->Offset, second->Offset);
+	EXPECT_EQ(first->Length, RECV_BUFFER_SIZE);
+	EXPECT_EQ(first->ioType, RIO_OPERATION_TYPE::OP_RECV);
+	EXPECT_NE(first->recvDataBuffer, nullptr);
+
+	EXPECT_EQ(pool.GetHighWaterMark(), 2u);
+
+	pool.Release(first);
+	pool.Release(second);
+	EXPECT_EQ(pool.GetHighWaterMark(), 2u);
+	pool.Cleanup();
+	EXPECT_EQ(gDeregisterCallCount, 1);
+	EXPECT_EQ(pool.GetCapacity(), 0u);
+}
+
+// ------------------------------------------------------------
+// 자유 슬롯이 바닥나면 묶음을 하나 더 등록하고, 등록에 실패하면 nullptr을 돌려주는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvSlotPoolTest, AcquireGrowsByChunkAndReportsRegistrationFailure)
+{
+	const auto table = MakeCountingRioTable(3);
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
+
+	std::vector<IOContext*> acquired;
+	for (unsigned int i = 0; i < RECV_SLOT_POOL_CHUNK_SIZE * 2; ++i)
+	{
+		acquired.push_back(pool.Acquire());
+		ASSERT_NE(acquired.back(), nullptr);
+	}
+	EXPECT_EQ(gRegisterCallCount, 2);
+	EXPECT_EQ(pool.GetCapacity(), RECV_SLOT_POOL_CHUNK_SIZE * 2);
+	EXPECT_EQ(pool.GetFreeCount(), 0u);
+
+	EXPECT_EQ(pool.Acquire(), nullptr);
+	EXPECT_EQ(pool.GetCapacity(), RECV_SLOT_POOL_CHUNK_SIZE * 2);
+
+	for (IOContext* context : acquired)
+	{
+		pool.Release(context);
+	}
+	pool.Cleanup();
+	EXPECT_EQ(gDeregisterCallCount, 2);
+}
+
+// ------------------------------------------------------------
+// 풀로 돌아온 슬롯은 이전 세션의 소유 정보를 들고 있지 않은지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvSlotPoolTest, ReleaseClearsOwnerBinding)
+{
+	const auto table = MakeCountingRioTable();
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
+	RecvBuffer owner;
+
+	IOContext* context = pool.Acquire();
+	ASSERT_NE(context, nullptr);
+	context->ownerRecvBuffer = &owner;
+	pool.Release(context);
+
+	EXPECT_EQ(context->ownerRecvBuffer, nullptr);
+	EXPECT_EQ(context->session, nullptr);
+}
+
+// ------------------------------------------------------------
+// 슬롯당 구간 완료 수가 충분하면 두 배로 늘리되 RECV_OUTSTANDING_COUNT를 넘지 않는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvDepthControllerTest, HotSessionGrowsUpToOutstandingCount)
+{
+	RecvDepthController controller;
+	controller.Reset(RECV_MIN_POSTED_SLOT_COUNT);
+	EXPECT_EQ(controller.GetTargetDepth(), RECV_MIN_POSTED_SLOT_COUNT);
+
+	unsigned long long now = 1000;
+	unsigned int expectedDepth = RECV_MIN_POSTED_SLOT_COUNT;
+	while (expectedDepth < RECV_OUTSTANDING_COUNT)
+	{
+		RecordCompletions(controller, controller.GetTargetDepth() * RECV_DEPTH_GROW_COMPLETIONS_PER_SLOT, now);
+		now += RECV_DEPTH_ADJUST_INTERVAL_MS;
+		controller.OnRecvCompleted(now);
+
+		expectedDepth = (std::min<unsigned int>)(expectedDepth * 2, RECV_OUTSTANDING_COUNT);
+		EXPECT_EQ(controller.GetTargetDepth(), expectedDepth);
+	}
+
+	RecordCompletions(controller, RECV_OUTSTANDING_COUNT * RECV_DEPTH_GROW_COMPLETIONS_PER_SLOT * 2, now);
+	controller.OnRecvCompleted(now + RECV_DEPTH_ADJUST_INTERVAL_MS);
+	EXPECT_EQ(controller.GetTargetDepth(), RECV_OUTSTANDING_COUNT);
+}
+
+// ------------------------------------------------------------
+// 오래 쉬었다 들어온 완료 하나로 깊이를 반으로 줄이고, 최소 게시 수 아래로는 내려가지 않는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvDepthControllerTest, IdleSessionShrinksToMinimumPostedSlots)
+{
+	RecvDepthController controller;
+	controller.Reset(RECV_OUTSTANDING_COUNT);
+
+	unsigned long long now = 1000;
+	controller.OnRecvCompleted(now);
+	for (int i = 0; i < 8; ++i)
+	{
+		now += RECV_DEPTH_ADJUST_INTERVAL_MS * 10;
+		controller.OnRecvCompleted(now);
+	}
+
+	EXPECT_EQ(controller.GetTargetDepth(), RECV_MIN_POSTED_SLOT_COUNT);
+}
+
+// ------------------------------------------------------------
+// 구간이 끝나기 전의 완료는 깊이를 바꾸지 않고, 중간 빈도에서는 깊이를 유지하는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvDepthControllerTest, DepthHoldsWithinIntervalAndAtSteadyRate)
+{
+	RecvDepthController controller;
+	controller.Reset(4);
+
+	RecordCompletions(controller, 4 * 2, 1000);
+	RecordCompletions(controller, 4 * 8, 1000 + RECV_DEPTH_ADJUST_INTERVAL_MS - 1);
+	EXPECT_EQ(controller.GetTargetDepth(), 4u);
+
+	controller.Reset(4);
+	RecordCompletions(controller, 4 * 2, 5000);
+	controller.OnRecvCompleted(5000 + RECV_DEPTH_ADJUST_INTERVAL_MS);
+	EXPECT_EQ(controller.GetTargetDepth(), 4u);
+
+	controller.Reset(RECV_OUTSTANDING_COUNT * 4);
+	EXPECT_EQ(controller.GetTargetDepth(), RECV_OUTSTANDING_COUNT);
+	controller.Reset(0);
+	EXPECT_EQ(controller.GetTargetDepth(), RECV_MIN_POSTED_SLOT_COUNT);
+}
+
+// ------------------------------------------------------------
+// 목표 깊이가 줄면 완료된 슬롯 중 넘치는 것만 풀로 돌려주는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvDepthControllerTest, RecvBufferReturnsSlotsAboveTargetDepthToPool)
+{
+	const auto table = MakeCountingRioTable();
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
+	RecvBuffer buffer;
+	buffer.slotPool = &pool;
+	buffer.ownerSessionId = 9;
+	buffer.depthController.Reset(RECV_OUTSTANDING_COUNT);
+
+	std::vector<IOContext*> posted;
+	while (IOContext* context = buffer.AcquireFreeRecvContext())
+	{
+		EXPECT_EQ(context->ownerSessionId, 9);
+		buffer.BeginRecvIo();
+		posted.push_back(context);
+	}
+	ASSERT_EQ(posted.size(), RECV_OUTSTANDING_COUNT);
+	EXPECT_EQ(pool.GetFreeCount(), pool.GetCapacity() - RECV_OUTSTANDING_COUNT);
+
+	buffer.depthController.Reset(RECV_MIN_POSTED_SLOT_COUNT);
+	for (IOContext* context : posted)
+	{
+		buffer.ReleaseRecvContext(context);
+		buffer.CompleteRecvIo();
+	}
+	EXPECT_EQ(buffer.heldRecvSlotCount.load(), RECV_MIN_POSTED_SLOT_COUNT);
+	EXPECT_EQ(pool.GetFreeCount(), pool.GetCapacity() - RECV_MIN_POSTED_SLOT_COUNT);
+
+	buffer.ClearFreeRecvContexts();
+	EXPECT_EQ(pool.GetFreeCount(), pool.GetCapacity());
+}
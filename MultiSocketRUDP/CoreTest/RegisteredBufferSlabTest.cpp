@@ -0,0 +1,154 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "../Common/etc/CoreType.h"
+#include "RegisteredBufferSlab.h"
+#include <set>
+#include <vector>
+
+namespace
+{
+	int gSlabRegisterCallCount = 0;
+	int gSlabDeregisterCallCount = 0;
+	int gSlabFailRegisterCallIndex = 0;
+
+	RIO_BUFFERID WINAPI SlabRegisterBuffer(PCHAR, DWORD)
+	{
+		++gSlabRegisterCallCount;
+		if (gSlabFailRegisterCallIndex == gSlabRegisterCallCount)
+		{
+			return RIO_INVALID_BUFFERID;
+		}
+
+		return reinterpret_cast<RIO_BUFFERID>(static_cast<intptr_t>(gSlabRegisterCallCount));
+	}
+
+	void WINAPI SlabDeregisterBuffer(RIO_BUFFERID)
+	{
+		++gSlabDeregisterCallCount;
+	}
+
+	RIO_EXTENSION_FUNCTION_TABLE MakeSlabRioTable(const int failRegisterCallIndex = 0)
+	{
+		gSlabRegisterCallCount = 0;
+		gSlabDeregisterCallCount = 0;
+		gSlabFailRegisterCallIndex = failRegisterCallIndex;
+
+		RIO_EXTENSION_FUNCTION_TABLE table{};
+		table.RIORegisterBuffer = SlabRegisterBuffer;
+		table.RIODeregisterBuffer = SlabDeregisterBuffer;
+		return table;
+	}
+
+	constexpr unsigned int TEST_CHUNK_SIZE = 4096;
+	constexpr unsigned int TEST_CHUNKS_PER_REGION = 4;
+}
+
+// ------------------------------------------------------------
+// 영역 하나를 한 번만 등록하고, 조각들이 같은 버퍼 ID 안에서 겹치지 않는 오프셋을 받는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RegisteredBufferSlabTest, RegionIsRegisteredOnceAndChunksUseDistinctOffsets)
+{
+	const auto table = MakeSlabRioTable();
+	RegisteredBufferSlab slab(table, TEST_CHUNK_SIZE, TEST_CHUNKS_PER_REGION);
+	ASSERT_TRUE(slab.Initialize());
+	ASSERT_TRUE(slab.Initialize());
+	EXPECT_EQ(gSlabRegisterCallCount, 1);
+	EXPECT_EQ(slab.GetCapacity(), TEST_CHUNKS_PER_REGION);
+
+	std::vector<RegisteredBufferChunk> chunks;
+	std::set<ULONG> offsets;
+	for (unsigned int i = 0; i < TEST_CHUNKS_PER_REGION; ++i)
+	{
+		const RegisteredBufferChunk chunk = slab.Acquire();
+		ASSERT_TRUE(chunk.IsValid());
+		EXPECT_EQ(chunk.bufferId, chunks.empty() ? chunk.bufferId : chunks.front().bufferId);
+		EXPECT_EQ(chunk.offset % TEST_CHUNK_SIZE, 0u);
+		EXPECT_EQ(chunk.buffer - chunk.offset, chunks.empty() ? chunk.buffer - chunk.offset : chunks.front().buffer - chunks.front().offset);
+		offsets.insert(chunk.offset);
+		chunks.push_back(chunk);
+	}
+	EXPECT_EQ(chunks.front().offset, 0u);
+	EXPECT_EQ(offsets.size(), TEST_CHUNKS_PER_REGION);
+	EXPECT_EQ(gSlabRegisterCallCount, 1);
+
+	for (const auto& chunk : chunks)
+	{
+		slab.Release(chunk);
+	}
+	slab.Cleanup();
+	EXPECT_EQ(gSlabDeregisterCallCount, 1);
+	EXPECT_EQ(slab.GetCapacity(), 0u);
+}
+
+// ------------------------------------------------------------
+// 조각이 모자라면 영역을 하나 더 등록하고, 동시에 빌려 간 최대 수를 high-water mark로 남기는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RegisteredBufferSlabTest, GrowsByRegionAndReportsHighWaterMark)
+{
+	const auto table = MakeSlabRioTable();
+	RegisteredBufferSlab slab(table, TEST_CHUNK_SIZE, TEST_CHUNKS_PER_REGION);
+	ASSERT_TRUE(slab.Initialize());
+
+	std::vector<RegisteredBufferChunk> chunks;
+	for (unsigned int i = 0; i < TEST_CHUNKS_PER_REGION + 1; ++i)
+	{
+		chunks.push_back(slab.Acquire());
+		ASSERT_TRUE(chunks.back().IsValid());
+	}
+	EXPECT_EQ(gSlabRegisterCallCount, 2);
+	EXPECT_EQ(slab.GetCapacity(), TEST_CHUNKS_PER_REGION * 2);
+	EXPECT_NE(chunks.front().bufferId, chunks.back().bufferId);
+	EXPECT_EQ(slab.GetInUseCount(), TEST_CHUNKS_PER_REGION + 1);
+
+	for (const auto& chunk : chunks)
+	{
+		slab.Release(chunk);
+	}
+	EXPECT_EQ(slab.GetInUseCount(), 0u);
+	EXPECT_EQ(slab.GetHighWaterMark(), TEST_CHUNKS_PER_REGION + 1);
+
+	const RegisteredBufferChunk reused = slab.Acquire();
+	ASSERT_TRUE(reused.IsValid());
+	EXPECT_EQ(gSlabRegisterCallCount, 2);
+	EXPECT_EQ(slab.GetHighWaterMark(), TEST_CHUNKS_PER_REGION + 1);
+	slab.Release(reused);
+
+	slab.Cleanup();
+	EXPECT_EQ(gSlabDeregisterCallCount, 2);
+}
+
+// ------------------------------------------------------------
+// 영역 등록에 실패하면 유효하지 않은 조각을 돌려주고, 이미 빌려 준 조각은 그대로 유지되는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RegisteredBufferSlabTest, RegistrationFailureReturnsInvalidChunk)
+{
+	const auto table = MakeSlabRioTable(2);
+	RegisteredBufferSlab slab(table, TEST_CHUNK_SIZE, 1);
+	ASSERT_TRUE(slab.Initialize());
+
+	const RegisteredBufferChunk first = slab.Acquire();
+	ASSERT_TRUE(first.IsValid());
+	const RegisteredBufferChunk second = slab.Acquire();
+	EXPECT_FALSE(second.IsValid());
+	EXPECT_EQ(second.bufferId, RIO_INVALID_BUFFERID);
+	EXPECT_EQ(slab.GetCapacity(), 1u);
+	EXPECT_EQ(slab.GetInUseCount(), 1u);
+
+	slab.Release(first);
+	slab.Cleanup();
+	EXPECT_EQ(gSlabDeregisterCallCount, 1);
+}
+
+// ------------------------------------------------------------
+// 첫 영역 등록에 실패하면 Initialize가 실패하고 해제할 등록이 남지 않는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RegisteredBufferSlabTest, InitializeFailureLeavesNothingRegistered)
+{
+	const auto table = MakeSlabRioTable(1);
+	RegisteredBufferSlab slab(table, TEST_CHUNK_SIZE, TEST_CHUNKS_PER_REGION);
+
+	EXPECT_FALSE(slab.Initialize());
+	EXPECT_EQ(slab.GetCapacity(), 0u);
+	slab.Cleanup();
+	EXPECT_EQ(gSlabDeregisterCallCount, 0);
+}
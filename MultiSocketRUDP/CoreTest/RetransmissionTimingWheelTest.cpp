@@ -0,0 +1,212 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "RetransmissionTimingWheel.h"
+#include "SendPacketInfo.h"
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	using TimePoint = RetransmissionTimingWheel::TimePoint;
+	using namespace std::chrono_literals;
+
+	const TimePoint BASE_TIME = TimePoint(std::chrono::seconds(100));
+
+	[[nodiscard]]
+	std::unique_ptr<SendPacketInfo[]> MakeSendPacketInfos(const size_t count)
+	{
+		auto infos = std::make_unique<SendPacketInfo[]>(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			infos[i].sendPacketSequence = i;
+		}
+
+		return infos;
+	}
+}
+
+// ------------------------------------------------------------
+// 등록과 취소가 크기와 연결 상태를 바로 반영하는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RetransmissionTimingWheelTest, ScheduleAndCancelUpdateSizeImmediately)
+{
+	RetransmissionTimingWheel wheel;
+	auto infos = MakeSendPacketInfos(3);
+
+	wheel.Schedule(infos[0], BASE_TIME + 10ms);
+	wheel.Schedule(infos[1], BASE_TIME + 10ms);
+	wheel.Schedule(infos[2], BASE_TIME + 20ms);
+	EXPECT_EQ(wheel.GetSize(), 3u);
+
+	EXPECT_TRUE(wheel.Cancel(infos[1]));
+	EXPECT_FALSE(RetransmissionTimingWheel::IsScheduled(infos[1]));
+	EXPECT_FALSE(wheel.Cancel(infos[1]));
+	EXPECT_EQ(wheel.GetSize(), 2u);
+
+	std::vector<SendPacketInfo*> expired;
+	wheel.PopExpired(BASE_TIME + 20ms, expired);
+	ASSERT_EQ(expired.size(), 2u);
+	EXPECT_EQ(wheel.GetSize(), 0u);
+	for (const auto* info : expired)
+	{
+		EXPECT_NE(info, &infos[1]);
+		EXPECT_FALSE(RetransmissionTimingWheel::IsScheduled(*info));
+	}
+}
+
+// ------------------------------------------------------------
+// tick 경계가 아닌 기한을 올림하여 기한보다 일찍 꺼내지 않는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RetransmissionTimingWheelTest, PopExpiredNeverFiresBeforeDeadline)
+{
+	RetransmissionTimingWheel wheel;
+	auto infos = MakeSendPacketInfos(1);
+	std::vector<SendPacketInfo*> expired;
+
+	wheel.PopExpired(BASE_TIME, expired);
+	wheel.Schedule(infos[0], BASE_TIME + 5ms + 300us);
+
+	wheel.PopExpired(BASE_TIME + 5ms + 299us, expired);
+	EXPECT_TRUE(expired.empty());
+	wheel.PopExpired(BASE_TIME + 5ms + 999us, expired);
+	EXPECT_TRUE(expired.empty());
+
+	wheel.PopExpired(BASE_TIME + 6ms, expired);
+	ASSERT_EQ(expired.size(), 1u);
+	EXPECT_EQ(expired[0], &infos[0]);
+}
+
+// ------------------------------------------------------------
+// 이미 지난 기한은 다음 tick에 꺼내지는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RetransmissionTimingWheelTest, PastDeadlineFiresOnNextTick)
+{
+	RetransmissionTimingWheel wheel;
+	auto infos = MakeSendPacketInfos(1);
+	std::vector<SendPacketInfo*> expired;
+
+	wheel.PopExpired(BASE_TIME, expired);
+	wheel.Schedule(infos[0], BASE_TIME - 50ms);
+
+	TimePoint nextDeadline{};
+	ASSERT_TRUE(wheel.GetNextDeadline(nextDeadline));
+	EXPECT_EQ(nextDeadline, BASE_TIME + 1ms);
+
+	wheel.PopExpired(BASE_TIME + 1ms, expired);
+	ASSERT_EQ(expired.size(), 1u);
+}
+
+// ------------------------------------------------------------
+// 다시 등록하면 이전 기한에서 빠지고 새 기한으로 옮겨지는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RetransmissionTimingWheelTest, RescheduleMovesEntryToNewDeadline)
+{
+	RetransmissionTimingWheel wheel;
+	auto infos = MakeSendPacketInfos(1);
+	std::vector<SendPacketInfo*> expired;
+
+	wheel.PopExpired(BASE_TIME, expired);
+	wheel.Schedule(infos[0], BASE_TIME + 10ms);
+	wheel.Schedule(infos[0], BASE_TIME + 30ms);
+	EXPECT_EQ(wheel.GetSize(), 1u);
+
+	wheel.PopExpired(BASE_TIME + 20ms, expired);
+	EXPECT_TRUE(expired.empty());
+
+	wheel.PopExpired(BASE_TIME + 30ms, expired);
+	ASSERT_EQ(expired.size(), 1u);
+}
+
+// ------------------------------------------------------------
+// 휠 한 바퀴보다 먼 기한이 같은 슬롯을 지날 때 꺼내지지 않고 기한에 꺼내지는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RetransmissionTimingWheelTest, DeadlineBeyondOneRoundWaitsUntilDue)
+{
+	RetransmissionTimingWheel wheel;
+	auto infos = MakeSendPacketInfos(2);
+	std::vector<SendPacketInfo*> expired;
+
+	const auto roundDuration = std::chrono::milliseconds(RetransmissionTimingWheel::SLOT_COUNT);
+	wheel.PopExpired(BASE_TIME, expired);
+	wheel.Schedule(infos[0], BASE_TIME + 5ms);
+	wheel.Schedule(infos[1], BASE_TIME + roundDuration + 5ms);
+
+	wheel.PopExpired(BASE_TIME + 5ms, expired);
+	ASSERT_EQ(expired.size(), 1u);
+	EXPECT_EQ(expired[0], &infos[0]);
+
+	expired.clear();
+	wheel.PopExpired(BASE_TIME + roundDuration + 4ms, expired);
+	EXPECT_TRUE(expired.empty());
+
+	wheel.PopExpired(BASE_TIME + roundDuration + 5ms, expired);
+	ASSERT_EQ(expired.size(), 1u);
+	EXPECT_EQ(expired[0], &infos[1]);
+}
+
+// ------------------------------------------------------------
+// 오래 호출되지 않았다가 한 바퀴 이상 지난 뒤 호출해도 기한이 지난 항목을 모두 꺼내는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RetransmissionTimingWheelTest, PopExpiredAfterLongIdleDrainsEverything)
+{
+	RetransmissionTimingWheel wheel;
+	constexpr size_t COUNT = 3000;
+	auto infos = MakeSendPacketInfos(COUNT);
+	std::vector<SendPacketInfo*> expired;
+
+	wheel.PopExpired(BASE_TIME, expired);
+	for (size_t i = 0; i < COUNT; ++i)
+	{
+		wheel.Schedule(infos[i], BASE_TIME + std::chrono::milliseconds(i + 1));
+	}
+
+	wheel.PopExpired(BASE_TIME + std::chrono::milliseconds(COUNT * 2), expired);
+	EXPECT_EQ(expired.size(), COUNT);
+	EXPECT_EQ(wheel.GetSize(), 0u);
+}
+
+// ------------------------------------------------------------
+// 다음 확인 시간이 가장 가까운 기한의 tick인지 확인합니다.
+// ------------------------------------------------------------
+TEST(RetransmissionTimingWheelTest, GetNextDeadlineReturnsNearestOccupiedTick)
+{
+	RetransmissionTimingWheel wheel;
+	auto infos = MakeSendPacketInfos(2);
+	std::vector<SendPacketInfo*> expired;
+
+	TimePoint nextDeadline{};
+	EXPECT_FALSE(wheel.GetNextDeadline(nextDeadline));
+
+	wheel.PopExpired(BASE_TIME, expired);
+	wheel.Schedule(infos[0], BASE_TIME + 200ms);
+	wheel.Schedule(infos[1], BASE_TIME + 70ms + 100us);
+
+	ASSERT_TRUE(wheel.GetNextDeadline(nextDeadline));
+	EXPECT_EQ(nextDeadline, BASE_TIME + 71ms);
+
+	ASSERT_TRUE(wheel.Cancel(infos[1]));
+	ASSERT_TRUE(wheel.GetNextDeadline(nextDeadline));
+	EXPECT_EQ(nextDeadline, BASE_TIME + 200ms);
+}
+
+// ------------------------------------------------------------
+// PopAll이 모든 항목을 빼고 휠을 비우는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RetransmissionTimingWheelTest, PopAllDrainsEveryEntry)
+{
+	RetransmissionTimingWheel wheel;
+	auto infos = MakeSendPacketInfos(4);
+	for (size_t i = 0; i < 4; ++i)
+	{
+		wheel.Schedule(infos[i], BASE_TIME + std::chrono::milliseconds(i * 700));
+	}
+
+	std::vector<SendPacketInfo*> items;
+	wheel.PopAll(items);
+	EXPECT_EQ(items.size(), 4u);
+	EXPECT_EQ(wheel.GetSize(), 0u);
+
+	TimePoint nextDeadline{};
+	EXPECT_FALSE(wheel.GetNextDeadline(nextDeadline));
+}
@@ -0,0 +1,208 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "SendPacketInfoQueue.h"
+#include "SendPacketInfo.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	[[nodiscard]]
+	std::unique_ptr<SendPacketInfo[]> MakeSendPacketInfos(const size_t count)
+	{
+		auto infos = std::make_unique<SendPacketInfo[]>(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			infos[i].sendPacketSequence = i;
+		}
+
+		return infos;
+	}
+}
+
+// ------------------------------------------------------------
+// 빈 큐에서 꺼내면 nullptr를 반환하고 크기가 0인지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendPacketInfoQueueTest, EmptyQueuePopsNothing)
+{
+	SendPacketInfoQueue queue;
+
+	EXPECT_TRUE(queue.IsEmpty());
+	EXPECT_EQ(queue.Pop(), nullptr);
+	EXPECT_EQ(queue.GetSize(), 0);
+}
+
+// ------------------------------------------------------------
+// 넣은 순서대로 꺼내지고, 비웠다가 다시 넣어도 순서가 유지되는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendPacketInfoQueueTest, PopsInPushOrderAcrossEmptyTransitions)
+{
+	SendPacketInfoQueue queue;
+	auto infos = MakeSendPacketInfos(4);
+
+	ASSERT_TRUE(queue.Push(&infos[0]));
+	EXPECT_EQ(queue.Pop(), &infos[0]);
+	EXPECT_EQ(queue.Pop(), nullptr);
+
+	for (size_t i = 0; i < 4; ++i)
+	{
+		ASSERT_TRUE(queue.Push(&infos[i]));
+	}
+	EXPECT_EQ(queue.GetSize(), 4);
+
+	for (size_t i = 0; i < 4; ++i)
+	{
+		EXPECT_EQ(queue.Pop(), &infos[i]);
+	}
+	EXPECT_EQ(queue.Pop(), nullptr);
+	EXPECT_TRUE(queue.IsEmpty());
+}
+
+// ------------------------------------------------------------
+// 큐에 있는 동안에는 같은 노드를 다시 넣을 수 없고, 꺼낸 뒤에는 다시 넣을 수 있는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendPacketInfoQueueTest, QueuedNodeCannotBeLinkedTwice)
+{
+	SendPacketInfoQueue queue;
+	auto infos = MakeSendPacketInfos(2);
+
+	ASSERT_TRUE(queue.Push(&infos[0]));
+	ASSERT_TRUE(queue.Push(&infos[1]));
+	EXPECT_FALSE(queue.Push(&infos[0]));
+	EXPECT_EQ(queue.GetSize(), 2);
+
+	EXPECT_EQ(queue.Pop(), &infos[0]);
+	EXPECT_TRUE(queue.Push(&infos[0]));
+	EXPECT_EQ(queue.Pop(), &infos[1]);
+	EXPECT_EQ(queue.Pop(), &infos[0]);
+	EXPECT_EQ(queue.Pop(), nullptr);
+}
+
+// ------------------------------------------------------------
+// 여러 생산자가 동시에 넣어도 모든 노드가 정확히 한 번, 생산자별 순서대로 꺼내지는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendPacketInfoQueueTest, ConcurrentProducersDeliverEveryNodeOnceInPerProducerOrder)
+{
+	constexpr size_t PRODUCER_COUNT = 4;
+	constexpr size_t PUSH_PER_PRODUCER = 50'000;
+
+	SendPacketInfoQueue queue;
+	auto infos = MakeSendPacketInfos(PRODUCER_COUNT * PUSH_PER_PRODUCER);
+	std::atomic_bool start{};
+
+	std::vector<std::thread> producers;
+	for (size_t producer = 0; producer < PRODUCER_COUNT; ++producer)
+	{
+		producers.emplace_back([&, producer]()
+		{
+			while (not start.load(std::memory_order_acquire))
+			{
+				std::this_thread::yield();
+			}
+
+			for (size_t i = 0; i < PUSH_PER_PRODUCER; ++i)
+			{
+				EXPECT_TRUE(queue.Push(&infos[producer * PUSH_PER_PRODUCER + i]));
+			}
+		});
+	}
+
+	std::vector<size_t> nextIndex(PRODUCER_COUNT);
+	std::vector<bool> seen(PRODUCER_COUNT * PUSH_PER_PRODUCER);
+	size_t popCount = 0;
+
+	start.store(true, std::memory_order_release);
+	while (popCount < PRODUCER_COUNT * PUSH_PER_PRODUCER)
+	{
+		SendPacketInfo* info = queue.Pop();
+		if (info == nullptr)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		const size_t sequence = info->sendPacketSequence;
+		const size_t producer = sequence / PUSH_PER_PRODUCER;
+		ASSERT_FALSE(seen[sequence]) << "sequence " << sequence << " popped twice";
+		ASSERT_EQ(sequence % PUSH_PER_PRODUCER, nextIndex[producer]) << "producer " << producer << " out of order";
+		seen[sequence] = true;
+		++nextIndex[producer];
+		++popCount;
+	}
+
+	for (auto& producer : producers)
+	{
+		producer.join();
+	}
+
+	EXPECT_EQ(queue.Pop(), nullptr);
+	EXPECT_TRUE(queue.IsEmpty());
+}
+
+// ------------------------------------------------------------
+// 생산자들이 적은 수의 노드를 서로 다투어 다시 넣는 동안 받아들여진 Push와 Pop 수가 같은지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendPacketInfoQueueTest, ConcurrentRepushOfSharedNodesKeepsPushAndPopBalanced)
+{
+	constexpr size_t PRODUCER_COUNT = 4;
+	constexpr size_t NODE_COUNT = 8;
+	constexpr size_t ATTEMPT_PER_PRODUCER = 200'000;
+
+	SendPacketInfoQueue queue;
+	auto infos = MakeSendPacketInfos(NODE_COUNT);
+	std::atomic<size_t> acceptedCount{};
+	std::atomic_bool producersDone{};
+
+	std::vector<std::thread> producers;
+	for (size_t producer = 0; producer < PRODUCER_COUNT; ++producer)
+	{
+		producers.emplace_back([&, producer]()
+		{
+			size_t accepted = 0;
+			for (size_t i = 0; i < ATTEMPT_PER_PRODUCER; ++i)
+			{
+				if (queue.Push(&infos[(producer + i) % NODE_COUNT]))
+				{
+					++accepted;
+				}
+			}
+			acceptedCount.fetch_add(accepted, std::memory_order_relaxed);
+		});
+	}
+
+	std::thread closer([&]()
+	{
+		for (auto& producer : producers)
+		{
+			producer.join();
+		}
+		producersDone.store(true, std::memory_order_release);
+	});
+
+	size_t popCount = 0;
+	while (true)
+	{
+		const bool done = producersDone.load(std::memory_order_acquire);
+		if (SendPacketInfo* info = queue.Pop())
+		{
+			ASSERT_LT(info->sendPacketSequence, NODE_COUNT);
+			++popCount;
+			continue;
+		}
+
+		if (done && queue.IsEmpty())
+		{
+			break;
+		}
+	}
+	closer.join();
+
+	EXPECT_EQ(popCount, acceptedCount.load());
+	EXPECT_GT(popCount, NODE_COUNT);
+	for (size_t i = 0; i < NODE_COUNT; ++i)
+	{
+		EXPECT_FALSE(infos[i].sendQueueLink.isQueued.load());
+	}
+}
@@ -133,7 +133,7 @@ TEST(SendPacketInfoTest, InitializeStoresPacketMetadataAndBuffer)
 	EXPECT_EQ(info->sendPacketSequence, 77);
 	EXPECT_TRUE(info->isReplyType);
 	EXPECT_EQ(info->retransmissionCount, 0);
-	EXPECT_EQ(info->scheduleVersion, 0u);
+	EXPECT_FALSE(info->retransmissionWheelLink.isLinked);
 	EXPECT_EQ(info->refCount.load(), 1);
 	SendPacketInfo::Free(info);
 }
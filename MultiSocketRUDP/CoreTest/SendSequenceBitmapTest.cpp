@@ -0,0 +1,108 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "SendSequenceBitmap.h"
+
+// ------------------------------------------------------------
+// 빈 비트맵은 어떤 시퀀스도 포함하지 않는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendSequenceBitmapTest, EmptyBitmapContainsNothing)
+{
+	SendSequenceBitmap bitmap;
+
+	EXPECT_TRUE(bitmap.IsEmpty());
+	EXPECT_FALSE(bitmap.Contains(false, 0));
+	EXPECT_FALSE(bitmap.Contains(true, 0));
+}
+
+// ------------------------------------------------------------
+// 같은 시퀀스는 한 번만 기록되고, 일반 패킷과 응답 패킷은 따로 기록되는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendSequenceBitmapTest, InsertRejectsDuplicateAndSeparatesReplyType)
+{
+	SendSequenceBitmap bitmap;
+
+	EXPECT_TRUE(bitmap.Insert(false, 100));
+	EXPECT_FALSE(bitmap.Insert(false, 100));
+	EXPECT_TRUE(bitmap.Contains(false, 100));
+	EXPECT_FALSE(bitmap.Contains(true, 100));
+
+	EXPECT_TRUE(bitmap.Insert(true, 100));
+	EXPECT_TRUE(bitmap.Contains(true, 100));
+	EXPECT_EQ(bitmap.GetSize(), 2);
+}
+
+// ------------------------------------------------------------
+// 처음 시퀀스보다 앞선 재전송과 뒤의 새 송신이 모두 창 안에서 기록되는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendSequenceBitmapTest, WindowCoversSequencesOnBothSidesOfFirstInsert)
+{
+	SendSequenceBitmap bitmap;
+	constexpr PacketSequence first = 10'000;
+	constexpr PacketSequence halfWindow = SendSequenceBitmap::WINDOW_BITS / 2;
+
+	ASSERT_TRUE(bitmap.Insert(false, first));
+	EXPECT_TRUE(bitmap.Insert(false, first - halfWindow));
+	EXPECT_TRUE(bitmap.Insert(false, first + halfWindow - 1));
+	EXPECT_TRUE(bitmap.Insert(false, first - 1));
+
+	EXPECT_TRUE(bitmap.Contains(false, first - halfWindow));
+	EXPECT_TRUE(bitmap.Contains(false, first + halfWindow - 1));
+	EXPECT_FALSE(bitmap.Contains(false, first + 1));
+	EXPECT_FALSE(bitmap.Insert(false, first - 1));
+}
+
+// ------------------------------------------------------------
+// 창 밖 시퀀스도 중복을 걸러내고, 창이 0 아래로 내려가지 않는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendSequenceBitmapTest, SequencesOutsideWindowAreStillDeduplicated)
+{
+	SendSequenceBitmap bitmap;
+
+	ASSERT_TRUE(bitmap.Insert(false, 1));
+	EXPECT_TRUE(bitmap.Insert(false, 1'000'000));
+	EXPECT_FALSE(bitmap.Insert(false, 1'000'000));
+	EXPECT_TRUE(bitmap.Contains(false, 1'000'000));
+	EXPECT_TRUE(bitmap.Insert(false, 0));
+	EXPECT_FALSE(bitmap.Insert(false, 0));
+}
+
+// ------------------------------------------------------------
+// 창 밖 기록 자리가 다 차면 새 시퀀스로 취급해 패킷을 빠뜨리지 않는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendSequenceBitmapTest, FullOverflowTreatsUnrecordedSequenceAsNew)
+{
+	SendSequenceBitmap bitmap;
+	constexpr PacketSequence farAway = 1'000'000;
+
+	ASSERT_TRUE(bitmap.Insert(false, 0));
+	for (PacketSequence i = 0; i < SendSequenceBitmap::OVERFLOW_CAPACITY; ++i)
+	{
+		ASSERT_TRUE(bitmap.Insert(false, farAway + i));
+	}
+
+	EXPECT_TRUE(bitmap.Insert(false, farAway + SendSequenceBitmap::OVERFLOW_CAPACITY));
+	EXPECT_FALSE(bitmap.Contains(false, farAway + SendSequenceBitmap::OVERFLOW_CAPACITY));
+	EXPECT_FALSE(bitmap.Insert(false, farAway));
+}
+
+// ------------------------------------------------------------
+// Clear 후에는 이전 기록이 남지 않고, 새 패스의 첫 시퀀스로 창을 다시 잡는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SendSequenceBitmapTest, ClearForgetsSequencesAndRebasesWindow)
+{
+	SendSequenceBitmap bitmap;
+
+	ASSERT_TRUE(bitmap.Insert(false, 5));
+	ASSERT_TRUE(bitmap.Insert(true, 7));
+	ASSERT_TRUE(bitmap.Insert(false, 2'000'000));
+	bitmap.Clear();
+
+	EXPECT_TRUE(bitmap.IsEmpty());
+	EXPECT_FALSE(bitmap.Contains(false, 5));
+	EXPECT_FALSE(bitmap.Contains(true, 7));
+	EXPECT_FALSE(bitmap.Contains(false, 2'000'000));
+
+	ASSERT_TRUE(bitmap.Insert(false, 2'000'000));
+	EXPECT_TRUE(bitmap.Insert(false, 2'000'001));
+	EXPECT_FALSE(bitmap.Contains(false, 5));
+}
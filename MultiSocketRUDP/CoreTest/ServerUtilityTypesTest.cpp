@@ -57,6 +57,52 @@ TEST(RecvBufferTest, ClearFreeRecvContextsDrainsQueuedContexts)
 	EXPECT_EQ(buffer.AcquireFreeRecvContext(), nullptr);
 }
 
+// ------------------------------------------------------------
+// 빌려준 수신 슬롯은 완료와 모든 뷰가 참조를 놓은 뒤에만 자유 큐로 돌아가는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvBufferTest, LentSlotReturnsToFreeQueueAfterLastReference)
+{
+	RecvBuffer buffer;
+	IOContext context;
+
+	ASSERT_TRUE(buffer.TryLendRecvSlot(&context));
+	buffer.BorrowRecvSlot(&context);
+	buffer.BorrowRecvSlot(&context);
+	EXPECT_EQ(buffer.lentRecvSlotCount.load(), 1u);
+
+	buffer.ReleaseRecvSlot(&context);
+	buffer.ReleaseRecvSlot(&context);
+	EXPECT_EQ(buffer.AcquireFreeRecvContext(), nullptr);
+
+	buffer.ReleaseRecvSlot(&context);
+	EXPECT_EQ(buffer.AcquireFreeRecvContext(), &context);
+	EXPECT_EQ(buffer.lentRecvSlotCount.load(), 0u);
+
+	// 빌려주지 않은 슬롯은 바로 반환됩니다.
+	buffer.ReleaseRecvSlot(&context);
+	EXPECT_EQ(buffer.AcquireFreeRecvContext(), &context);
+}
+
+// ------------------------------------------------------------
+// 최소 게시 슬롯 수를 남기고 그 이상은 빌려주지 않는지 확인합니다.
+// ------------------------------------------------------------
+TEST(RecvBufferTest, LendingKeepsMinimumPostedSlots)
+{
+	RecvBuffer buffer;
+	std::array<IOContext, RECV_OUTSTANDING_COUNT> contexts;
+
+	constexpr auto lendableCount = RECV_OUTSTANDING_COUNT - RECV_MIN_POSTED_SLOT_COUNT;
+	for (unsigned long i = 0; i < lendableCount; ++i)
+	{
+		EXPECT_TRUE(buffer.TryLendRecvSlot(&contexts[i]));
+	}
+	EXPECT_FALSE(buffer.TryLendRecvSlot(&contexts[lendableCount]));
+	EXPECT_EQ(contexts[lendableCount].recvSlotBorrowCount.load(), 0u);
+
+	buffer.ReleaseRecvSlot(&contexts[0]);
+	EXPECT_TRUE(buffer.TryLendRecvSlot(&contexts[lendableCount]));
+}
+
 // ------------------------------------------------------------
 // 패킷 정렬 키가 일반 데이터를 응답보다 우선하고 같은 종류에서는 시퀀스 순으로 정렬하는지 확인합니다.
 // ------------------------------------------------------------
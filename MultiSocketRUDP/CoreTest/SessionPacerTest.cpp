@@ -0,0 +1,88 @@
+﻿#include "PreCompile.h"
+#include <gtest/gtest.h>
+#include "SessionPacer.h"
+
+// ============================================================
+// 송신 페이서
+//
+// 보류 큐의 패킷은 혼잡 제어가 알려 준 간격마다 하나씩 나가며, 타이머 해상도를 흡수하도록 두 개까지는 연달아 나갈 수 있습니다.
+// ============================================================
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	const std::chrono::steady_clock::time_point baseTime = std::chrono::steady_clock::time_point{} + 1h;
+	constexpr std::chrono::steady_clock::duration PACING_INTERVAL = 1ms;
+}
+
+TEST(SessionPacerTest, Disabled_AlwaysAllowsSending)
+{
+	SessionPacer pacer;
+	pacer.Configure(false);
+
+	for (int i = 0; i < 10; ++i)
+	{
+		ASSERT_TRUE(pacer.CanSendNow(baseTime));
+		pacer.OnPacketReleased(baseTime, PACING_INTERVAL);
+	}
+}
+
+TEST(SessionPacerTest, Enabled_AllowsShortBurstThenSpacesPackets)
+{
+	SessionPacer pacer;
+	pacer.Configure(true);
+
+	ASSERT_TRUE(pacer.CanSendNow(baseTime));
+	pacer.OnPacketReleased(baseTime, PACING_INTERVAL);
+	ASSERT_TRUE(pacer.CanSendNow(baseTime));
+	pacer.OnPacketReleased(baseTime, PACING_INTERVAL);
+
+	EXPECT_FALSE(pacer.CanSendNow(baseTime));
+	EXPECT_EQ(pacer.GetNextDepartureTime(), baseTime + PACING_INTERVAL);
+	EXPECT_TRUE(pacer.CanSendNow(baseTime + PACING_INTERVAL));
+}
+
+TEST(SessionPacerTest, IdlePeriod_DoesNotAccumulateUnboundedBurst)
+{
+	SessionPacer pacer;
+	pacer.Configure(true);
+	pacer.OnPacketReleased(baseTime, PACING_INTERVAL);
+
+	const auto later = baseTime + 1s;
+	int releasedCount = 0;
+	while (pacer.CanSendNow(later))
+	{
+		pacer.OnPacketReleased(later, PACING_INTERVAL);
+		++releasedCount;
+	}
+
+	EXPECT_EQ(releasedCount, 2);
+}
+
+TEST(SessionPacerTest, ZeroInterval_DoesNotPace)
+{
+	SessionPacer pacer;
+	pacer.Configure(true);
+
+	for (int i = 0; i < 10; ++i)
+	{
+		ASSERT_TRUE(pacer.CanSendNow(baseTime));
+		pacer.OnPacketReleased(baseTime, std::chrono::steady_clock::duration::zero());
+	}
+}
+
+TEST(SessionPacerTest, ScheduleMark_IsTakenOnceUntilCleared)
+{
+	SessionPacer pacer;
+	pacer.Configure(true);
+
+	EXPECT_TRUE(pacer.TryMarkScheduled());
+	EXPECT_FALSE(pacer.TryMarkScheduled());
+
+	pacer.ClearScheduled();
+	EXPECT_TRUE(pacer.TryMarkScheduled());
+
+	pacer.Configure(true);
+	EXPECT_TRUE(pacer.TryMarkScheduled());
+}
@@ -1,6 +1,8 @@
 ﻿#include "PreCompile.h"
 #include <gtest/gtest.h>
 
+#include "RecvSlotPool.h"
+#include "RegisteredBufferSlab.h"
 #include "SessionRecvContext.h"
 #include "SessionRIOContext.h"
 
@@ -52,42 +54,52 @@ namespace
 	}
 }
 
-TEST(SessionRecvContextTest, InitializeRegistersEveryRecvBufferAndCleanupDeregistersThem)
+TEST(SessionRecvContextTest, InitializeTakesMinimumSlotsFromPoolAndCleanupReturnsThem)
 {
 	TestRIOState state;
 	const auto table = MakeTestRioTable(state);
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
 	SessionRecvContext context;
 
-	ASSERT_TRUE(context.Initialize(table, 7, nullptr));
-	EXPECT_EQ(state.registerCallCount, RECV_OUTSTANDING_COUNT * 3);
+	ASSERT_TRUE(context.Initialize(pool, 7, nullptr));
+	EXPECT_EQ(state.registerCallCount, 1);
+	EXPECT_EQ(pool.GetFreeCount(), pool.GetCapacity() - RECV_MIN_POSTED_SLOT_COUNT);
 
-	context.Cleanup(table);
+	context.Cleanup();
+	EXPECT_EQ(pool.GetFreeCount(), pool.GetCapacity());
+
+	pool.Cleanup();
 	EXPECT_EQ(state.deregisterCallCount, state.registerCallCount);
 }
 
-TEST(SessionRecvContextTest, InitializeFailureDeregistersBuffersRegisteredBeforeFailure)
+TEST(SessionRecvContextTest, InitializeFailsWhenPoolCannotRegisterSlots)
 {
 	TestRIOState state;
-	state.failRegisterCallIndex = 2;
+	state.failRegisterCallIndex = 1;
 	const auto table = MakeTestRioTable(state);
+	RecvSlotPool pool(table);
 	SessionRecvContext context;
 
-	EXPECT_FALSE(context.Initialize(table, 7, nullptr));
-	EXPECT_EQ(state.registerCallCount, 3);
-	EXPECT_EQ(state.deregisterCallCount, 2);
+	EXPECT_FALSE(context.Initialize(pool, 7, nullptr));
+	EXPECT_EQ(pool.GetCapacity(), 0u);
+	EXPECT_EQ(context.GetRecvBuffer().AcquireFreeRecvContext(), nullptr);
+	EXPECT_EQ(state.deregisterCallCount, 0);
 }
 
 // ------------------------------------------------------------
-// 수신 컨텍스트 초기화가 모든 RIO 버퍼와 메타데이터를 구성하고 자유 큐에 등록하는지 확인합니다.
+// 풀에서 받은 수신 컨텍스트가 세션 소유 정보와 RIO 버퍼 오프셋을 갖추고, 게시 상한까지만 나오는지 확인합니다.
 // ------------------------------------------------------------
-TEST(SessionRecvContextTest, InitializePopulatesEveryContextAndFreeQueue)
+TEST(SessionRecvContextTest, AcquiredContextsAreBoundToSessionUpToOutstandingCount)
 {
 	TestRIOState state;
 	const auto table = MakeTestRioTable(state);
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
 	SessionRecvContext context;
 	constexpr SessionIdType sessionId = 23;
 
-	ASSERT_TRUE(context.Initialize(table, sessionId, nullptr));
+	ASSERT_TRUE(context.Initialize(pool, sessionId, nullptr));
 	auto& recvBuffer = context.GetRecvBuffer();
 	std::set<IOContext*> acquired;
 	for (size_t i = 0; i < RECV_OUTSTANDING_COUNT; ++i)
@@ -97,15 +109,22 @@ TEST(SessionRecvContextTest, InitializePopulatesEveryContextAndFreeQueue)
 		acquired.insert(ioContext);
 		EXPECT_EQ(ioContext->ownerSessionId, sessionId);
 		EXPECT_EQ(ioContext->ioType, RIO_OPERATION_TYPE::OP_RECV);
+		EXPECT_EQ(ioContext->ownerRecvBuffer, &recvBuffer);
+		EXPECT_NE(ioContext->BufferId, RIO_INVALID_BUFFERID);
 		EXPECT_EQ(ioContext->Length, RECV_BUFFER_SIZE);
-		EXPECT_EQ(ioContext->Offset, 0u);
+		EXPECT_EQ(ioContext->clientAddrRIOBuffer.BufferId, ioContext->BufferId);
 		EXPECT_EQ(ioContext->clientAddrRIOBuffer.Length, sizeof(SOCKADDR_INET));
 		EXPECT_EQ(ioContext->localAddrRIOBuffer.Length, sizeof(SOCKADDR_INET));
 	}
 	EXPECT_EQ(acquired.size(), RECV_OUTSTANDING_COUNT);
 	EXPECT_EQ(recvBuffer.AcquireFreeRecvContext(), nullptr);
 
-	context.Cleanup(table);
+	for (IOContext* ioContext : acquired)
+	{
+		recvBuffer.ReleaseRecvContext(ioContext);
+	}
+	context.Cleanup();
+	EXPECT_EQ(pool.GetFreeCount(), pool.GetCapacity());
 }
 
 // ------------------------------------------------------------
@@ -115,8 +134,10 @@ TEST(SessionRecvContextTest, ReceiveTrackingAndResetExposeExpectedState)
 {
 	TestRIOState state;
 	const auto table = MakeTestRioTable(state);
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
 	SessionRecvContext context;
-	ASSERT_TRUE(context.Initialize(table, 3, nullptr));
+	ASSERT_TRUE(context.Initialize(pool, 3, nullptr));
 	auto& recvBuffer = context.GetRecvBuffer();
 	recvBuffer.BeginRecvIo();
 	recvBuffer.BeginRecvLogic();
@@ -125,43 +146,99 @@ TEST(SessionRecvContextTest, ReceiveTrackingAndResetExposeExpectedState)
 	recvBuffer.CompleteRecvLogic();
 	EXPECT_TRUE(recvBuffer.IsDrained());
 
-	context.Cleanup(table);
 	context.RecvContextReset();
-	EXPECT_EQ(context.GetRecvBufferContext(), nullptr);
+	EXPECT_EQ(pool.GetFreeCount(), pool.GetCapacity());
 	EXPECT_EQ(context.GetRecvBuffer().AcquireFreeRecvContext(), nullptr);
 }
 
-TEST(SessionRIOContextTest, InitializeCreatesRequestQueueAfterRecvAndSendBuffers)
+TEST(SessionRIOContextTest, InitializeCreatesRequestQueueWithoutRegisteringSessionBuffers)
 {
 	TestRIOState state;
 	const auto table = MakeTestRioTable(state);
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
+	RegisteredBufferSlab slab(table, MAX_SEND_BUFFER_SIZE, 2);
+	ASSERT_TRUE(slab.Initialize());
+	RegisteredBufferSlab addressSlab(table, CLIENT_ADDRESS_SLOT_SIZE, 4);
+	ASSERT_TRUE(addressSlab.Initialize());
 	SessionRIOContext context;
 
-	ASSERT_TRUE(context.Initialize(table, RIO_INVALID_CQ, RIO_INVALID_CQ, INVALID_SOCKET, 11, nullptr, 2));
+	ASSERT_TRUE(context.Initialize(table, pool, slab, addressSlab, RIO_INVALID_CQ, RIO_INVALID_CQ, INVALID_SOCKET, 11, nullptr, 2));
 
-	EXPECT_EQ(state.registerCallCount, RECV_OUTSTANDING_COUNT * 3 + 1);
+	EXPECT_EQ(state.registerCallCount, 3);
 	EXPECT_EQ(state.createRequestQueueCallCount, 1);
 	EXPECT_EQ(state.requestQueueSessionId, 11);
 	EXPECT_EQ(context.GetRIORQ(), state.createRequestQueueReturn);
+	EXPECT_EQ(slab.GetInUseCount(), 0u);
+	EXPECT_EQ(addressSlab.GetInUseCount(), 1u);
 
-	context.Cleanup(table);
+	context.Cleanup();
+	pool.Cleanup();
+	slab.Cleanup();
+	addressSlab.Cleanup();
 	EXPECT_EQ(state.deregisterCallCount, state.registerCallCount);
 }
 
 // ------------------------------------------------------------
-// 송신 버퍼 등록 실패 시 먼저 등록된 모든 수신 버퍼가 해제되는지 확인합니다.
+// 송신 패스 도중 정리되어도 빌린 송신 버퍼가 슬랩으로 돌아가는지 확인합니다.
 // ------------------------------------------------------------
-TEST(SessionRIOContextTest, SendBufferRegistrationFailureRollsBackRecvBuffers)
+TEST(SessionRIOContextTest, CleanupReturnsBorrowedSendBufferToSlab)
 {
 	TestRIOState state;
-	state.failRegisterCallIndex = RECV_OUTSTANDING_COUNT * 3 + 1;
 	const auto table = MakeTestRioTable(state);
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
+	RegisteredBufferSlab slab(table, MAX_SEND_BUFFER_SIZE, 2);
+	ASSERT_TRUE(slab.Initialize());
+	RegisteredBufferSlab addressSlab(table, CLIENT_ADDRESS_SLOT_SIZE, 4);
+	ASSERT_TRUE(addressSlab.Initialize());
 	SessionRIOContext context;
 
-	EXPECT_FALSE(context.Initialize(table, RIO_INVALID_CQ, RIO_INVALID_CQ, INVALID_SOCKET, 17, nullptr, 2));
-	EXPECT_EQ(state.createRequestQueueCallCount, 0);
-	EXPECT_EQ(state.registerCallCount, RECV_OUTSTANDING_COUNT * 3 + 1);
-	EXPECT_EQ(state.deregisterCallCount, RECV_OUTSTANDING_COUNT * 3);
+	ASSERT_TRUE(context.Initialize(table, pool, slab, addressSlab, RIO_INVALID_CQ, RIO_INVALID_CQ, INVALID_SOCKET, 17, nullptr, 2));
+	ASSERT_TRUE(context.GetSendContext().AcquireSendBuffer());
+	EXPECT_EQ(slab.GetInUseCount(), 1u);
+
+	context.Cleanup();
+	EXPECT_EQ(slab.GetInUseCount(), 0u);
+	EXPECT_EQ(slab.GetHighWaterMark(), 1u);
+	EXPECT_EQ(pool.GetFreeCount(), pool.GetCapacity());
+}
+
+// ------------------------------------------------------------
+// 연결 시 기록한 주소가 세션의 등록된 주소 슬롯에 들어가고, 정리하면 슬롯이 슬랩으로 돌아가는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SessionRIOContextTest, ClientAddressIsWrittenOnceIntoRegisteredSlot)
+{
+	TestRIOState state;
+	const auto table = MakeTestRioTable(state);
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
+	RegisteredBufferSlab slab(table, MAX_SEND_BUFFER_SIZE, 2);
+	ASSERT_TRUE(slab.Initialize());
+	RegisteredBufferSlab addressSlab(table, CLIENT_ADDRESS_SLOT_SIZE, 4);
+	ASSERT_TRUE(addressSlab.Initialize());
+	SessionRIOContext context;
+	EXPECT_EQ(context.GetClientAddressRIOBuffer().BufferId, RIO_INVALID_BUFFERID);
+
+	ASSERT_TRUE(context.Initialize(table, pool, slab, addressSlab, RIO_INVALID_CQ, RIO_INVALID_CQ, INVALID_SOCKET, 5, nullptr, 2));
+	const RIO_BUF addressBuffer = context.GetClientAddressRIOBuffer();
+	EXPECT_EQ(addressBuffer.BufferId, reinterpret_cast<RIO_BUFFERID>(static_cast<intptr_t>(3)));
+	EXPECT_EQ(addressBuffer.Offset % CLIENT_ADDRESS_SLOT_SIZE, 0u);
+	EXPECT_EQ(addressBuffer.Length, sizeof(SOCKADDR_INET));
+
+	SOCKADDR_INET clientAddress{};
+	clientAddress.Ipv4.sin_family = AF_INET;
+	clientAddress.Ipv4.sin_port = htons(4321);
+	context.SetClientAddress(clientAddress);
+
+	// 슬롯 주소는 슬랩에서 같은 조각을 다시 꺼내 확인합니다.
+	context.Cleanup();
+	EXPECT_EQ(addressSlab.GetInUseCount(), 0u);
+	const RegisteredBufferChunk slot = addressSlab.Acquire();
+	ASSERT_TRUE(slot.IsValid());
+	EXPECT_EQ(slot.offset, addressBuffer.Offset);
+	EXPECT_EQ(memcmp(slot.buffer, &clientAddress, sizeof(SOCKADDR_INET)), 0);
+	addressSlab.Release(slot);
 }
 
 // ------------------------------------------------------------
@@ -180,64 +257,58 @@ TEST(SessionRIOContextTest, WrapperMethodsForwardToRecvAndSendContexts)
 	context.GetSendContext().ClearPendingQueue();
 }
 
-TEST(SessionRIOContextTest, RequestQueueFailureCleansRegisteredRecvAndSendBuffers)
+TEST(SessionRIOContextTest, RequestQueueFailureReturnsRecvSlotsAndDetachesSendSlab)
 {
 	TestRIOState state;
 	state.createRequestQueueReturn = RIO_INVALID_RQ;
 	const auto table = MakeTestRioTable(state);
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
+	RegisteredBufferSlab slab(table, MAX_SEND_BUFFER_SIZE, 2);
+	ASSERT_TRUE(slab.Initialize());
+	RegisteredBufferSlab addressSlab(table, CLIENT_ADDRESS_SLOT_SIZE, 4);
+	ASSERT_TRUE(addressSlab.Initialize());
 	SessionRIOContext context;
 
-	EXPECT_FALSE(context.Initialize(table, RIO_INVALID_CQ, RIO_INVALID_CQ, INVALID_SOCKET, 11, nullptr, 2));
+	EXPECT_FALSE(context.Initialize(table, pool, slab, addressSlab, RIO_INVALID_CQ, RIO_INVALID_CQ, INVALID_SOCKET, 11, nullptr, 2));
 
-	EXPECT_EQ(state.registerCallCount, RECV_OUTSTANDING_COUNT * 3 + 1);
+	EXPECT_EQ(state.registerCallCount, 3);
 	EXPECT_EQ(state.createRequestQueueCallCount, 1);
-	EXPECT_EQ(state.deregisterCallCount, state.registerCallCount);
+	EXPECT_EQ(state.deregisterCallCount, 0);
+	EXPECT_EQ(pool.GetFreeCount(), pool.GetCapacity());
+	EXPECT_FALSE(context.GetSendContext().AcquireSendBuffer());
+	EXPECT_EQ(slab.GetInUseCount(), 0u);
+	EXPECT_EQ(addressSlab.GetInUseCount(), 0u);
+	EXPECT_EQ(context.GetClientAddressRIOBuffer().BufferId, RIO_INVALID_BUFFERID);
 }
 
 TEST(SessionRecvContextTest, ContextBeforeInitializeIsEmptyAndCleanupIsSafe)
 {
-	TestRIOState state;
-	const auto table = MakeTestRioTable(state);
 	SessionRecvContext context;
 
-	EXPECT_EQ(context.GetRecvBufferContext(), nullptr);
-	EXPECT_NO_FATAL_FAILURE(context.Cleanup(table));
-	EXPECT_EQ(state.deregisterCallCount, 0);
+	EXPECT_EQ(context.GetRecvBuffer().AcquireFreeRecvContext(), nullptr);
+	EXPECT_NO_FATAL_FAILURE(context.Cleanup());
 }
 
 TEST(SessionRecvContextTest, CleanupIsIdempotentAndContextCanBeReinitialized)
 {
 	TestRIOState state;
 	const auto table = MakeTestRioTable(state);
+	RecvSlotPool pool(table);
+	ASSERT_TRUE(pool.Initialize());
 	SessionRecvContext context;
-	constexpr int buffersPerInitialization = RECV_OUTSTANDING_COUNT * 3;
-
-	ASSERT_TRUE(context.Initialize(table, 3, nullptr));
-	context.Cleanup(table);
-	context.Cleanup(table);
-	EXPECT_EQ(state.registerCallCount, buffersPerInitialization);
-	EXPECT_EQ(state.deregisterCallCount, buffersPerInitialization);
-
-	ASSERT_TRUE(context.Initialize(table, 4, nullptr));
-	EXPECT_EQ(state.registerCallCount, buffersPerInitialization * 2);
-	context.Cleanup(table);
-	EXPECT_EQ(state.deregisterCallCount, buffersPerInitialization * 2);
-}
 
-TEST(SessionRecvContextTest, EveryRegistrationFailurePositionRollsBackValidBuffers)
-{
-	constexpr int totalBufferRegistrations = RECV_OUTSTANDING_COUNT * 3;
-	for (int failureIndex = 1; failureIndex <= totalBufferRegistrations; ++failureIndex)
-	{
-		TestRIOState state;
-		state.failRegisterCallIndex = failureIndex;
-		const auto table = MakeTestRioTable(state);
-		SessionRecvContext context;
-
-		EXPECT_FALSE(context.Initialize(table, 7, nullptr)) << "failureIndex=" << failureIndex;
-		EXPECT_EQ(state.deregisterCallCount, state.registerCallCount - 1)
-			<< "failureIndex=" << failureIndex;
-		EXPECT_EQ(context.GetRecvBuffer().AcquireFreeRecvContext(), nullptr)
-			<< "failureIndex=" << failureIndex;
-	}
+	ASSERT_TRUE(context.Initialize(pool, 3, nullptr));
+	context.Cleanup();
+	context.Cleanup();
+	EXPECT_EQ(pool.GetFreeCount(), pool.GetCapacity());
+
+	ASSERT_TRUE(context.Initialize(pool, 4, nullptr));
+	IOContext* ioContext = context.GetRecvBuffer().AcquireFreeRecvContext();
+	ASSERT_NE(ioContext, nullptr);
+	EXPECT_EQ(ioContext->ownerSessionId, 4);
+	context.GetRecvBuffer().ReleaseRecvContext(ioContext);
+	context.Cleanup();
+	EXPECT_EQ(pool.GetFreeCount(), pool.GetCapacity());
+	EXPECT_EQ(state.registerCallCount, 1);
 }
@@ -3,6 +3,7 @@
 
 #include "SessionSendContext.h"
 #include "SendPacketInfo.h"
+#include "../Common/FlowController/RUDPAckFrame.h"
 
 namespace
 {
@@ -66,45 +67,43 @@ TEST(SessionSendContextTest, InitialStateHasNoQueuedReservedOrPendingPackets)
 }
 
 // ------------------------------------------------------------
-// 초기화와 반복 정리가 RIO 송신 버퍼를 정확히 한 번 등록하고 해제하는지 확인합니다.
+// 초기화는 송신 버퍼를 빌리지 않고, 빌린 버퍼는 반복 정리에도 슬랩에 한 번만 돌아가는지 확인합니다.
 // ------------------------------------------------------------
-TEST(SessionSendContextTest, InitializeAndCleanupManageRegisteredBufferIdempotently)
+TEST(SessionSendContextTest, InitializeAndCleanupBorrowSendBufferFromSlabIdempotently)
 {
 	SendContextRIOState state;
 	const auto table = MakeSendContextRIOTable(state);
+	RegisteredBufferSlab slab(table, MAX_SEND_BUFFER_SIZE, 2);
+	ASSERT_TRUE(slab.Initialize());
 	SessionSendContext context;
 
-	ASSERT_TRUE(context.Initialize(table, 3));
+	ASSERT_TRUE(context.Initialize(slab, 3));
 	EXPECT_EQ(state.registerCount, 1);
-	EXPECT_NE(context.GetSendBufferId(), RIO_INVALID_BUFFERID);
-
-	context.Cleanup(table);
-	context.Cleanup(table);
-	EXPECT_EQ(state.deregisterCount, 1);
+	EXPECT_EQ(context.GetRIOSendBuffer(), nullptr);
 	EXPECT_EQ(context.GetSendBufferId(), RIO_INVALID_BUFFERID);
-}
-
-// ------------------------------------------------------------
-// RIO 버퍼 등록 실패 후 송신 버퍼 ID가 무효 상태로 유지되고 중복 해제되지 않는지 확인합니다.
-// ------------------------------------------------------------
-TEST(SessionSendContextTest, InitializeFailureLeavesInvalidBufferId)
-{
-	SendContextRIOState state;
-	state.registerResult = RIO_INVALID_BUFFERID;
-	const auto table = MakeSendContextRIOTable(state);
-	SessionSendContext context;
-
-	EXPECT_FALSE(context.Initialize(table, 1));
+	EXPECT_EQ(slab.GetInUseCount(), 0u);
+
+	ASSERT_TRUE(context.AcquireSendBuffer());
+	ASSERT_TRUE(context.AcquireSendBuffer());
+	EXPECT_NE(context.GetRIOSendBuffer(), nullptr);
+	EXPECT_EQ(context.GetSendBufferId(), state.registerResult);
+	EXPECT_EQ(context.GetSendBufferOffset(), 0u);
+	EXPECT_EQ(slab.GetInUseCount(), 1u);
+
+	context.Cleanup();
+	context.Cleanup();
+	EXPECT_EQ(slab.GetInUseCount(), 0u);
 	EXPECT_EQ(context.GetSendBufferId(), RIO_INVALID_BUFFERID);
-	context.Cleanup(table);
+	EXPECT_FALSE(context.AcquireSendBuffer());
 	EXPECT_EQ(state.deregisterCount, 0);
 }
 
 TEST(SessionSendContextTest, QueueAndReservedPacketOwnershipTransitionsAreConsistent)
 {
 	SessionSendContext context;
-	auto* first = reinterpret_cast<SendPacketInfo*>(1);
-	auto* second = reinterpret_cast<SendPacketInfo*>(2);
+	SendPacketInfo infos[2];
+	auto* first = &infos[0];
+	auto* second = &infos[1];
 
 	EXPECT_TRUE(context.IsNothingToSend());
 	context.PushSendPacketInfo(first);
@@ -115,6 +114,33 @@ TEST(SessionSendContextTest, QueueAndReservedPacketOwnershipTransitionsAreConsis
 	EXPECT_TRUE(context.IsNothingToSend());
 }
 
+// ------------------------------------------------------------
+// 아직 큐에 있는 패킷을 다시 넣으면 한 번만 꺼내지고 늘어난 참조는 바로 돌려주는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SessionSendContextTest, PushingQueuedPacketAgainReleasesExtraReference)
+{
+	SessionSendContext context;
+	SendPacketInfo* info = MakeSendPacketInfo(7);
+	ASSERT_NE(info, nullptr);
+
+	context.PushSendPacketInfo(info);
+	info->AddRefCount();
+	context.PushSendPacketInfo(info);
+
+	EXPECT_EQ(info->refCount.load(), 1);
+	EXPECT_EQ(context.GetSendPacketInfoQueueSize(), 1);
+	EXPECT_EQ(context.TryGetFrontAndPop(), info);
+	EXPECT_EQ(context.TryGetFrontAndPop(), nullptr);
+
+	info->AddRefCount();
+	context.PushSendPacketInfo(info);
+	EXPECT_EQ(context.TryGetFrontAndPop(), info);
+	EXPECT_EQ(info->refCount.load(), 2);
+
+	SendPacketInfo::Free(info);
+	SendPacketInfo::Free(info);
+}
+
 TEST(SessionSendContextTest, SendPacketMapFindAndErasePreservesCallerReference)
 {
 	SessionSendContext context;
@@ -207,12 +233,101 @@ TEST(SessionSendContextTest, PacketMapEraseAndClearInvokeExpectedOwnershipCallba
 	SendPacketInfo::Free(second);
 }
 
+// ------------------------------------------------------------
+// 손실로 판단된 패킷을 참조를 늘려 한 번만 고르고, 이후 ACK에서 새로 생긴 손실만 고르는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SessionSendContextTest, CollectFastRetransmitTargetsPicksEachLostPacketOnce)
+{
+	SessionSendContext context;
+	std::vector<SendPacketInfo*> infos;
+	for (PacketSequence sequence = 1; sequence <= 10; ++sequence)
+	{
+		SendPacketInfo* info = MakeSendPacketInfo(sequence);
+		ASSERT_NE(info, nullptr);
+		context.InsertSendPacketInfo(sequence, info);
+		infos.push_back(info);
+	}
+
+	const auto freeAcked = [](SendPacketInfo* info) { SendPacketInfo::Free(info); };
+	RUDPAckFrame firstAck{ .cumulativeSequence = 1 };
+	ASSERT_TRUE(firstAck.AddSackRange(3, 5));
+	EXPECT_EQ(context.EraseAckedSendPacketInfos(firstAck, freeAcked), 4u);
+
+	std::array<SendPacketInfo*, MAX_FAST_RETRANSMIT_PER_ACK> lostInfos{};
+	ASSERT_EQ(context.CollectFastRetransmitTargets(firstAck, lostInfos), 1u);
+	EXPECT_EQ(lostInfos[0], infos[1]);
+	EXPECT_EQ(infos[1]->refCount.load(), 3);
+	SendPacketInfo::Free(lostInfos[0]);
+
+	EXPECT_EQ(context.CollectFastRetransmitTargets(firstAck, lostInfos), 0u);
+
+	RUDPAckFrame secondAck{ .cumulativeSequence = 1 };
+	ASSERT_TRUE(secondAck.AddSackRange(3, 5));
+	ASSERT_TRUE(secondAck.AddSackRange(7, 9));
+	EXPECT_EQ(context.EraseAckedSendPacketInfos(secondAck, freeAcked), 3u);
+	ASSERT_EQ(context.CollectFastRetransmitTargets(secondAck, lostInfos), 1u);
+	EXPECT_EQ(lostInfos[0], infos[5]);
+	SendPacketInfo::Free(lostInfos[0]);
+
+	context.ForEachAndClearSendPacketInfoMap(freeAcked);
+	for (SendPacketInfo* info : infos)
+	{
+		SendPacketInfo::Free(info);
+	}
+}
+
+// ------------------------------------------------------------
+// 버퍼 크기를 넘는 손실은 그만큼만 고르고, 남은 손실은 다음 호출에서 이어서 고르는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SessionSendContextTest, CollectFastRetransmitTargetsStopsAtBufferSizeAndResumes)
+{
+	SessionSendContext context;
+	std::vector<SendPacketInfo*> infos;
+	for (PacketSequence sequence = 1; sequence <= 10; ++sequence)
+	{
+		SendPacketInfo* info = MakeSendPacketInfo(sequence);
+		ASSERT_NE(info, nullptr);
+		context.InsertSendPacketInfo(sequence, info);
+		infos.push_back(info);
+	}
+
+	const auto freeAcked = [](SendPacketInfo* info) { SendPacketInfo::Free(info); };
+	RUDPAckFrame ackFrame{ .cumulativeSequence = 0 };
+	ASSERT_TRUE(ackFrame.AddSackRange(6, 10));
+	EXPECT_EQ(context.EraseAckedSendPacketInfos(ackFrame, freeAcked), 5u);
+
+	std::array<SendPacketInfo*, 2> lostInfos{};
+	for (const size_t firstIndex : { 0u, 2u })
+	{
+		ASSERT_EQ(context.CollectFastRetransmitTargets(ackFrame, lostInfos), 2u);
+		EXPECT_EQ(lostInfos[0], infos[firstIndex]);
+		EXPECT_EQ(lostInfos[1], infos[firstIndex + 1]);
+		SendPacketInfo::Free(lostInfos[0]);
+		SendPacketInfo::Free(lostInfos[1]);
+	}
+
+	ASSERT_EQ(context.CollectFastRetransmitTargets(ackFrame, lostInfos), 1u);
+	EXPECT_EQ(lostInfos[0], infos[4]);
+	SendPacketInfo::Free(lostInfos[0]);
+	EXPECT_EQ(context.CollectFastRetransmitTargets(ackFrame, lostInfos), 0u);
+
+	context.ForEachAndClearSendPacketInfoMap(freeAcked);
+	for (SendPacketInfo* info : infos)
+	{
+		SendPacketInfo::Free(info);
+	}
+}
+
 // ------------------------------------------------------------
 // reset이 소유 큐와 보류 버퍼를 해제하고 시퀀스·버퍼 ID·IO 모드를 초기화하는지 확인합니다.
 // ------------------------------------------------------------
 TEST(SessionSendContextTest, ResetClearsOwnedQueuesPendingBuffersAndSequenceState)
 {
+	SendContextRIOState state;
+	RegisteredBufferSlab slab(MakeSendContextRIOTable(state), MAX_SEND_BUFFER_SIZE, 1);
+	ASSERT_TRUE(slab.Initialize());
 	SessionSendContext context;
+	ASSERT_TRUE(context.Initialize(slab, 1));
 	SendPacketInfo* queued = MakeSendPacketInfo(1);
 	SendPacketInfo* reserved = MakeSendPacketInfo(2);
 	NetBuffer* pending = NetBuffer::Alloc();
@@ -224,7 +339,7 @@ TEST(SessionSendContextTest, ResetClearsOwnedQueuesPendingBuffersAndSequenceStat
 	context.SetReservedSendPacketInfo(reserved);
 	context.InitializePendingQueue(1);
 	ASSERT_TRUE(context.PushToPendingQueue(3, pending));
-	context.SetSendRIOBufferId(reinterpret_cast<RIO_BUFFERID>(9));
+	ASSERT_TRUE(context.AcquireSendBuffer());
 	context.GetIOMode().store(IO_MODE::IO_SENDING);
 	EXPECT_EQ(context.IncrementLastSendPacketSequence(), 1);
 
@@ -234,6 +349,7 @@ TEST(SessionSendContextTest, ResetClearsOwnedQueuesPendingBuffersAndSequenceStat
 	EXPECT_TRUE(context.IsPendingQueueEmpty());
 	EXPECT_EQ(context.GetLastSendPacketSequence(), 0);
 	EXPECT_EQ(context.GetSendBufferId(), RIO_INVALID_BUFFERID);
+	EXPECT_EQ(slab.GetInUseCount(), 0u);
 	EXPECT_EQ(context.GetIOMode().load(), IO_MODE::IO_NONE_SENDING);
 }
 
@@ -251,3 +367,16 @@ TEST(SessionSendContextTest, ZeroCapacityPendingQueueRejectsPackets)
 	EXPECT_FALSE(context.PushToPendingQueue(1, buffer));
 	NetBuffer::Free(buffer);
 }
+
+// ------------------------------------------------------------
+// 여러 시퀀스를 한 번에 예약하면 연속된 구간의 첫 번호를 돌려주고, 다음 번호는 그 구간 뒤에서 이어지는지 확인합니다.
+// ------------------------------------------------------------
+TEST(SessionSendContextTest, ReserveSendPacketSequencesReturnsFirstOfContiguousRange)
+{
+	SessionSendContext context;
+
+	EXPECT_EQ(context.IncrementLastSendPacketSequence(), 1);
+	EXPECT_EQ(context.ReserveSendPacketSequences(3), 2);
+	EXPECT_EQ(context.GetLastSendPacketSequence(), 4);
+	EXPECT_EQ(context.IncrementLastSendPacketSequence(), 5);
+}
@@ -5,6 +5,7 @@
 #include "PacketManager.h"
 #include "../Common/PacketCrypto/PacketCryptoHelper.h"
 #include <mutex>
+#include <span>
 
 void SendPacketInfo::Free(SendPacketInfo* target)
 {
@@ -30,6 +31,8 @@ bool RUDPClientCore::Start(const std::wstring& clientCoreOptionFile, const std::
 {
 	threadStopFlag = false;
 	isConnected = false;
+	receiveWindow.Reset(LOGIN_PACKET_SEQUENCE + 1);
+	lastReplyPacketSequence = 0;
 	Logger::GetInstance().RunLoggerThread(printLogToConsole);
 
 	if (not ReadOptionFile(clientCoreOptionFile, sessionGetterOptionFilePath))
@@ -415,6 +418,7 @@ void RUDPClientCore::RunRetransmissionThread()
 
 			sendPacketInfo->retransmissionTimeStamp = GetTickCount64() + retransmissionThreadSleepMs;
 			SendPacket(*sendPacketInfo);
+			timeoutRetransmissionCount.fetch_add(1, std::memory_order_relaxed);
 			SendPacketInfo::Free(sendPacketInfo);
 		}
 
@@ -430,20 +434,22 @@ void RUDPClientCore::OnRecvStream(NetBuffer& recvBuffer, int recvSize)
 {
 	while (recvSize > df_HEADER_SIZE)
 	{
-		NetBuffer* recvPacketBuffer = NetBuffer::Alloc();
-		recvBuffer.ReadBuffer(recvPacketBuffer->GetBufferPtr(), df_HEADER_SIZE);
-		recvPacketBuffer->m_iRead = 0;
-
-		const WORD payloadLength = GetPayloadLength(*recvPacketBuffer);
-		if (payloadLength <= 0 || payloadLength > dfDEFAULTSIZE || payloadLength > recvSize)
+		const WORD payloadLength = GetPayloadLength(recvBuffer);
+		if (payloadLength <= 0 || payloadLength > RECV_BUFFER_SIZE - df_HEADER_SIZE || payloadLength > recvSize)
 		{
-			NetBuffer::Free(recvPacketBuffer);
 			break;
 		}
 		const int packetSize = (payloadLength + df_HEADER_SIZE);
 		recvSize -= packetSize;
-		
-		recvBuffer.ReadBuffer(recvPacketBuffer->GetWriteBufferPtr(), payloadLength);
+
+		// MTU 프로브처럼 기본 크기보다 큰 패킷은 버퍼를 늘려서 받습니다.
+		NetBuffer* recvPacketBuffer = NetBuffer::Alloc();
+		if (packetSize > dfDEFAULTSIZE)
+		{
+			recvPacketBuffer->Resize(packetSize);
+		}
+
+		recvBuffer.ReadBuffer(recvPacketBuffer->GetBufferPtr(), packetSize);
 		recvPacketBuffer->m_iRead = df_HEADER_SIZE;
 		recvPacketBuffer->m_iWrite = static_cast<WORD>(packetSize);
 
@@ -486,6 +492,18 @@ void RUDPClientCore::ProcessRecvPacket(OUT NetBuffer& receivedBuffer)
 		unsigned int packetId = 0;
 		if (packetType == PACKET_TYPE::SEND_TYPE)
 		{
+			RUDPAckFrame piggybackedAckFrame;
+			bool hasPiggybackedAck = false;
+			if (not RUDPAckFrame::ReadPiggybackField(receivedBuffer, piggybackedAckFrame, hasPiggybackedAck))
+			{
+				return;
+			}
+
+			if (hasPiggybackedAck)
+			{
+				OnAckFrameReceived(piggybackedAckFrame);
+			}
+
 			const WORD originalRead = receivedBuffer.m_iRead;
 			receivedBuffer >> packetId;
 			receivedBuffer.m_iRead = originalRead;
@@ -498,17 +516,37 @@ void RUDPClientCore::ProcessRecvPacket(OUT NetBuffer& receivedBuffer)
 
 		if (ShouldSendReplyToServer(packetSequence, packetId))
 		{
+			receiveWindow.MarkReceived(packetSequence);
 			if (packetType == PACKET_TYPE::HEARTBEAT_TYPE)
 			{
-				SendReplyToServer(packetSequence, PACKET_TYPE::HEARTBEAT_REPLY_TYPE);
+				SendReplyToServer(PACKET_TYPE::HEARTBEAT_REPLY_TYPE);
 			}
 			else
 			{
-				SendReplyToServer(packetSequence);
+				SendReplyToServer();
 			}
 		}
 		break;
 	}
+	case PACKET_TYPE::MTU_PROBE_TYPE:
+	{
+		if (not PacketCryptoHelper::DecodePacket(
+			receivedBuffer,
+			sessionSalt,
+			SESSION_SALT_SIZE,
+			sessionKeyHandle,
+			isCorePacket,
+			direction
+		))
+		{
+			return;
+		}
+
+		WORD probeSize;
+		receivedBuffer >> packetSequence >> probeSize;
+		SendPathMtuProbeReplyToServer(packetSequence, probeSize);
+		break;
+	}
 	case PACKET_TYPE::SEND_REPLY_TYPE:
 	{
 		direction = PACKET_DIRECTION::SERVER_TO_CLIENT_REPLY;
@@ -526,7 +564,7 @@ void RUDPClientCore::ProcessRecvPacket(OUT NetBuffer& receivedBuffer)
 		}
 
 		receivedBuffer >> packetSequence;
-		OnSendReply(receivedBuffer, packetSequence);
+		OnSendReply(receivedBuffer);
 		break;
 	}
 	default:
@@ -537,19 +575,28 @@ void RUDPClientCore::ProcessRecvPacket(OUT NetBuffer& receivedBuffer)
 	}
 }
 
-void RUDPClientCore::OnSendReply(NetBuffer& recvPacket, const PacketSequence packetSequence)
+void RUDPClientCore::OnSendReply(NetBuffer& recvPacket)
 {
-	if (lastSendPacketSequence < packetSequence)
+	RUDPAckFrame ackFrame;
+	if (not ackFrame.ReadFrom(recvPacket))
 	{
 		return;
 	}
 
-	BYTE remoteWindow;
-	recvPacket >> remoteWindow;
-	remoteAdvertisedWindow.store(remoteWindow, std::memory_order_relaxed);
-	lastAckedSequence.store(packetSequence, std::memory_order_relaxed);
+	OnAckFrameReceived(ackFrame);
+}
 
-	if (packetSequence == 0 && not isConnected)
+void RUDPClientCore::OnAckFrameReceived(const RUDPAckFrame& ackFrame)
+{
+	if (lastSendPacketSequence < ackFrame.cumulativeSequence)
+	{
+		return;
+	}
+
+	remoteAdvertisedWindow.store(ackFrame.advertiseWindow, std::memory_order_relaxed);
+	lastAckedSequence.store(ackFrame.cumulativeSequence, std::memory_order_relaxed);
+
+	if (ackFrame.IsCovered(LOGIN_PACKET_SEQUENCE) && not isConnected)
 	{
 		isConnected = true;
 		serverAliveChecker.StartServerAliveCheck(serverAliveCheckMs);
@@ -557,26 +604,82 @@ void RUDPClientCore::OnSendReply(NetBuffer& recvPacket, const PacketSequence pac
 
 	{
 		std::scoped_lock lock(sendPacketInfoMapLock);
-		const auto itor = sendPacketInfoMap.find(packetSequence);
-		if (itor != sendPacketInfoMap.end())
+		ackFrame.EraseCovered(sendPacketInfoMap, [](SendPacketInfo* info)
 		{
-			SendPacketInfo* info = itor->second;
-			sendPacketInfoMap.erase(itor);
 			SendPacketInfo::Free(info);
-		}
+		});
 	}
 
+	FastRetransmitLostPackets(ackFrame);
 	TryFlushPendingQueue();
 }
 
-void RUDPClientCore::SendReplyToServer(const PacketSequence inRecvPacketSequence, const PACKET_TYPE packetType)
+void RUDPClientCore::FastRetransmitLostPackets(const RUDPAckFrame& ackFrame)
+{
+	std::array<SendPacketInfo*, MAX_FAST_RETRANSMIT_PER_ACK> lostInfos;
+	size_t lostCount = 0;
+	{
+		std::scoped_lock lock(sendPacketInfoMapLock);
+		ackFrame.ForEachLost(sendPacketInfoMap, lastFastRetransmitSequence, [&](SendPacketInfo* lostInfo)
+		{
+			lastFastRetransmitSequence = lostInfo->sendPacketSequence;
+			if (lostInfo->retransmissionCount + 1 >= maxPacketRetransmissionCount)
+			{
+				return;
+			}
+
+			++lostInfo->retransmissionCount;
+			lostInfo->retransmissionTimeStamp = GetTickCount64() + retransmissionThreadSleepMs;
+			lostInfo->AddRefCount();
+			lostInfos[lostCount++] = lostInfo;
+		}, lostInfos.size());
+	}
+
+	for (SendPacketInfo* lostInfo : std::span(lostInfos.data(), lostCount))
+	{
+		SendPacket(*lostInfo);
+		SendPacketInfo::Free(lostInfo);
+	}
+
+	fastRetransmissionCount.fetch_add(static_cast<uint32_t>(lostCount), std::memory_order_relaxed);
+}
+
+void RUDPClientCore::SendReplyToServer(const PACKET_TYPE packetType)
+{
+	auto& buffer = *NetBuffer::Alloc();
+
+	RUDPAckFrame ackFrame;
+	receiveWindow.FillAckFrame(ackFrame);
+
+	const PacketSequence replySequence = RUDPAckFrame::REPLY_SEQUENCE_FLAG | ++lastReplyPacketSequence;
+	buffer << packetType << replySequence;
+	ackFrame.WriteTo(buffer);
+	PacketCryptoHelper::EncodePacket(
+		buffer,
+		replySequence,
+		PACKET_DIRECTION::CLIENT_TO_SERVER_REPLY,
+		sessionSalt,
+		SESSION_SALT_SIZE,
+		sessionKeyHandle,
+		true
+	);
+
+	{
+		std::scoped_lock lock(sendBufferQueueLock);
+		sendBufferQueue.Enqueue(&buffer);
+
+		ReleaseSemaphore(sendEventHandles[0], 1, nullptr);
+	}
+}
+
+void RUDPClientCore::SendPathMtuProbeReplyToServer(const PacketSequence probeSequence, const WORD probeSize)
 {
 	auto& buffer = *NetBuffer::Alloc();
 
-	buffer << packetType << inRecvPacketSequence;
+	buffer << PACKET_TYPE::MTU_PROBE_REPLY_TYPE << probeSequence << probeSize;
 	PacketCryptoHelper::EncodePacket(
 		buffer,
-		inRecvPacketSequence,
+		probeSequence,
 		PACKET_DIRECTION::CLIENT_TO_SERVER_REPLY,
 		sessionSalt,
 		SESSION_SALT_SIZE,
@@ -680,7 +783,9 @@ void RUDPClientCore::SendPacket(OUT IPacket& packet)
 
 	constexpr auto packetType = PACKET_TYPE::SEND_TYPE;
 	const PacketSequence packetSequence = ++lastSendPacketSequence;
-	*buffer << packetType << packetSequence << packet.GetPacketId();
+	*buffer << packetType << packetSequence;
+	RUDPAckFrame::WritePiggybackField(*buffer, nullptr);
+	*buffer << packet.GetPacketId();
 	packet.PacketToBuffer(*buffer);
 
 	return SendPacket(*buffer, packetSequence, false);
@@ -745,6 +850,7 @@ void RUDPClientCore::SendPacketForTest(char* streamData, const int streamSize)
 	constexpr auto packetType = PACKET_TYPE::SEND_TYPE;
 	const PacketSequence packetSequence = ++lastSendPacketSequence;
 	*buffer << packetType << packetSequence;
+	RUDPAckFrame::WritePiggybackField(*buffer, nullptr);
 	buffer->WriteBuffer(streamData, streamSize);
 	SendPacket(*buffer, packetSequence, true);
 }
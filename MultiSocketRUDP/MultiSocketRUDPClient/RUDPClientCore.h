@@ -12,6 +12,7 @@
 #include "Queue.h"
 #include <queue>
 #include "../Common/TLS/TLSHelper.h"
+#include "../Common/FlowController/RUDPReceiveWindow.h"
 
 #pragma comment(lib, "ws2_32.lib")
 
@@ -81,6 +82,14 @@ protected:
 public:
 	bool IsStopped() const { return isStopped.load(std::memory_order_acquire); }
 	bool IsConnected() const { return isConnected; }
+	// ----------------------------------------
+	// @brief 재전송 주기에 걸려 다시 보낸 패킷 수를 반환합니다.
+	// ----------------------------------------
+	unsigned int GetTimeoutRetransmissionCount() const { return timeoutRetransmissionCount.load(std::memory_order_relaxed); }
+	// ----------------------------------------
+	// @brief SACK으로 손실을 감지해 재전송 주기 전에 다시 보낸 패킷 수를 반환합니다.
+	// ----------------------------------------
+	unsigned int GetFastRetransmissionCount() const { return fastRetransmissionCount.load(std::memory_order_relaxed); }
 
 private:
 	bool CreateRUDPSocket();
@@ -154,8 +163,34 @@ private:
 
 	void OnRecvStream(NetBuffer& recvBuffer, int recvSize);
 	void ProcessRecvPacket(OUT NetBuffer& receivedBuffer);
-	void OnSendReply(NetBuffer& recvPacket, PacketSequence packetSequence);
-	void SendReplyToServer(PacketSequence inRecvPacketSequence, PACKET_TYPE packetType = PACKET_TYPE::SEND_REPLY_TYPE);
+	// ----------------------------------------
+	// @brief 서버의 ACK 프레임이 덮는 송신 패킷 정보를 한 번에 제거합니다.
+	// @param recvPacket 복호화된 응답 패킷 (ACK 프레임부터 읽습니다)
+	// ----------------------------------------
+	void OnSendReply(NetBuffer& recvPacket);
+	// ----------------------------------------
+	// @brief 응답 패킷이나 SEND_TYPE 헤더에 실려 온 ACK 프레임을 송신 상태에 반영합니다.
+	// @param ackFrame 검증된 ACK 프레임
+	// ----------------------------------------
+	void OnAckFrameReceived(const RUDPAckFrame& ackFrame);
+	// ----------------------------------------
+	// @brief ACK 프레임 기준으로 손실로 판단된 패킷을 재전송 주기를 기다리지 않고 다시 보냅니다.
+	// 이미 빠른 재전송한 시퀀스 이하는 다시 고르지 않으며, 재전송 한도에 닿는 패킷은 재전송 스레드에 맡깁니다.
+	// @param ackFrame 덮는 항목이 이미 제거된 ACK 프레임
+	// ----------------------------------------
+	void FastRetransmitLostPackets(const RUDPAckFrame& ackFrame);
+	// ----------------------------------------
+	// @brief 현재 수신 윈도우 상태로 누적 ACK와 SACK 구간을 담은 응답을 서버에 보냅니다.
+	// @param packetType SEND_REPLY_TYPE 또는 HEARTBEAT_REPLY_TYPE
+	// ----------------------------------------
+	void SendReplyToServer(PACKET_TYPE packetType = PACKET_TYPE::SEND_REPLY_TYPE);
+	// ----------------------------------------
+	// @brief 서버의 MTU 프로브에 응답합니다.
+	// 프로브의 패딩은 돌려보내지 않고 시퀀스와 크기만 담아 보냅니다.
+	// @param probeSequence 프로브 시퀀스
+	// @param probeSize 프로브 데이터그램 전체 크기
+	// ----------------------------------------
+	void SendPathMtuProbeReplyToServer(PacketSequence probeSequence, WORD probeSize);
 	void DoSend();
 	static void SleepRemainingFrameTime(OUT TickSet& tickSet, unsigned int intervalMs);
 
@@ -174,6 +209,10 @@ private:
 	std::atomic<PacketSequence> lastSendPacketSequence{};
 	std::map<PacketSequence, SendPacketInfo*> sendPacketInfoMap;
 	std::mutex sendPacketInfoMapLock;
+	// 수신 스레드에서만 접근합니다.
+	PacketSequence lastFastRetransmitSequence{};
+	std::atomic_uint32_t timeoutRetransmissionCount{};
+	std::atomic_uint32_t fastRetransmissionCount{};
 
 	struct RecvPacketInfoPriority
 	{
@@ -188,6 +227,11 @@ private:
 	std::atomic<BYTE> remoteAdvertisedWindow{ 1 };
 	std::atomic<PacketSequence> lastAckedSequence{ 0 };
 	PacketSequence nextRecvPacketSequence{ 1 };
+
+	// 수신 스레드에서만 접근합니다. 서버에 보낼 ACK 프레임의 누적 시퀀스와 SACK 구간을 만드는 데 사용합니다.
+	static constexpr BYTE ACK_TRACKING_WINDOW_SIZE = 255;
+	RUDPReceiveWindow receiveWindow{ ACK_TRACKING_WINDOW_SIZE };
+	PacketSequence lastReplyPacketSequence{};
 #pragma endregion RUDP
 
 public:
@@ -0,0 +1,56 @@
+#include "PreCompile.h"
+#include "DelayedAckTracker.h"
+
+void DelayedAckTracker::Configure(const BYTE inAckEveryPacketCount, const unsigned int inAckDelayMs) noexcept
+{
+	ackEveryPacketCount = inAckEveryPacketCount;
+	ackDelayMs = inAckDelayMs;
+	pendingPacketCount = 0;
+	ackDeadline = 0;
+	hasSentAck = false;
+	lastAckedSequence = 0;
+}
+
+DELAYED_ACK_ACTION DelayedAckTracker::OnInOrderPacket(const unsigned long long now) noexcept
+{
+	if (ackEveryPacketCount <= 1 || ackDelayMs == 0 || ++pendingPacketCount >= ackEveryPacketCount)
+	{
+		pendingPacketCount = 0;
+		return DELAYED_ACK_ACTION::SEND_NOW;
+	}
+
+	if (pendingPacketCount > 1)
+	{
+		return DELAYED_ACK_ACTION::ALREADY_SCHEDULED;
+	}
+
+	ackDeadline = now + ackDelayMs;
+	return DELAYED_ACK_ACTION::SCHEDULE;
+}
+
+void DelayedAckTracker::OnAckSent(const PacketSequence cumulativeSequence) noexcept
+{
+	pendingPacketCount = 0;
+	hasSentAck = true;
+	lastAckedSequence = cumulativeSequence;
+}
+
+bool DelayedAckTracker::IsAckedThrough(const PacketSequence cumulativeSequence) const noexcept
+{
+	return hasSentAck && lastAckedSequence == cumulativeSequence;
+}
+
+bool DelayedAckTracker::IsAckDue(const unsigned long long now) const noexcept
+{
+	return pendingPacketCount > 0 && ackDeadline <= now;
+}
+
+bool DelayedAckTracker::HasPendingAck() const noexcept
+{
+	return pendingPacketCount > 0;
+}
+
+unsigned long long DelayedAckTracker::GetAckDeadline() const noexcept
+{
+	return ackDeadline;
+}
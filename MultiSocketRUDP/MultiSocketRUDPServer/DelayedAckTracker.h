@@ -0,0 +1,69 @@
+#pragma once
+#include "../Common/etc/CoreType.h"
+
+enum class DELAYED_ACK_ACTION : uint8_t
+{
+	SEND_NOW = 0,
+	SCHEDULE,
+	ALREADY_SCHEDULED,
+};
+
+// ----------------------------------------
+// @brief 세션별 지연 ACK 정책을 관리합니다.
+// @details 순서대로 도착한 패킷은 ackEveryPacketCount개가 쌓이거나 첫 패킷 이후 ackDelayMs가 지나면 한 번에 응답합니다.
+//          순서가 어긋난 패킷이나 중복 패킷은 이 정책을 거치지 않고 즉시 응답해야 합니다.
+//          세션의 수신 로직 스레드에서만 접근하므로 동기화하지 않습니다.
+// ----------------------------------------
+class DelayedAckTracker
+{
+public:
+	// ----------------------------------------
+	// @brief 지연 ACK 조건을 설정하고 대기 상태를 초기화합니다.
+	// @param inAckEveryPacketCount 이 개수만큼 패킷이 쌓이면 즉시 응답합니다. 1 이하이면 지연하지 않습니다.
+	// @param inAckDelayMs 첫 미응답 패킷 이후 응답을 미룰 최대 시간. 0이면 지연하지 않습니다.
+	// ----------------------------------------
+	void Configure(BYTE inAckEveryPacketCount, unsigned int inAckDelayMs) noexcept;
+
+	// ----------------------------------------
+	// @brief 순서대로 처리된 패킷 하나를 기록하고 응답 방법을 결정합니다.
+	// @param now 현재 시간 (밀리초)
+	// @return SEND_NOW이면 즉시 응답, SCHEDULE이면 GetAckDeadline()에 응답하도록 예약해야 합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	DELAYED_ACK_ACTION OnInOrderPacket(unsigned long long now) noexcept;
+
+	// ----------------------------------------
+	// @brief ACK 프레임을 보냈으므로 대기 중인 패킷 수를 비웁니다.
+	// @param cumulativeSequence 보낸 ACK 프레임의 누적 시퀀스
+	// ----------------------------------------
+	void OnAckSent(PacketSequence cumulativeSequence) noexcept;
+
+	// ----------------------------------------
+	// @brief 마지막으로 보낸 ACK 프레임이 이미 해당 누적 시퀀스까지 알렸는지 확인합니다.
+	// @details 패킷 처리 중 응답 데이터 패킷에 ACK가 실려 나갔다면 별도 응답을 보내지 않아도 됩니다.
+	// @param cumulativeSequence 현재 수신 윈도우의 누적 시퀀스
+	// ----------------------------------------
+	[[nodiscard]]
+	bool IsAckedThrough(PacketSequence cumulativeSequence) const noexcept;
+
+	// ----------------------------------------
+	// @brief 미룬 응답의 기한이 지났는지 확인합니다.
+	// @param now 현재 시간 (밀리초)
+	// @return 대기 중인 패킷이 있고 기한이 지났으면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool IsAckDue(unsigned long long now) const noexcept;
+
+	[[nodiscard]]
+	bool HasPendingAck() const noexcept;
+	[[nodiscard]]
+	unsigned long long GetAckDeadline() const noexcept;
+
+private:
+	BYTE ackEveryPacketCount{ 1 };
+	unsigned int ackDelayMs{};
+	BYTE pendingPacketCount{};
+	unsigned long long ackDeadline{};
+	bool hasSentAck{};
+	PacketSequence lastAckedSequence{};
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include <MSWSock.h>
+#include <atomic>
 #include "NetServerSerializeBuffer.h"
+#include "RecvPacketView.h"
 
 class RUDPSession;
 struct RecvBuffer;
@@ -25,6 +27,8 @@ struct IOContext : RIO_BUF
 	RUDPSession* session = nullptr;
 	RecvBuffer* ownerRecvBuffer = nullptr;
 	char* recvDataBuffer = nullptr;
+	// 수신 슬롯을 logic worker에 빌려준 동안의 참조 수입니다. 빌려주지 않은 슬롯은 0입니다.
+	std::atomic_uint32_t recvSlotBorrowCount{};
 	RIO_BUF clientAddrRIOBuffer{ RIO_INVALID_BUFFERID, };
 	RIO_BUF localAddrRIOBuffer{ RIO_INVALID_BUFFERID, };
 	char clientAddrBuffer[sizeof(SOCKADDR_INET)];
@@ -46,12 +50,26 @@ struct RecvIOCompletedContext
 		ownerRecvBuffer = inOwnerRecvBuffer;
 		ownerSessionGeneration = inOwnerSessionGeneration;
 		buffer = inBuffer;
+		borrowedRecvContext = nullptr;
 		memcpy(clientAddrBuffer, inClientAddrBuffer, sizeof(SOCKADDR_INET));
 	}
 
+	void InitBorrowedContext(IOContext* inBorrowedRecvContext, char* packet, const unsigned int packetSize)
+	{
+		InitContext(inBorrowedRecvContext->session,
+			inBorrowedRecvContext->ownerRecvBuffer,
+			inBorrowedRecvContext->ownerSessionGeneration,
+			&recvPacketView.Attach(packet, packetSize),
+			inBorrowedRecvContext->clientAddrBuffer);
+		borrowedRecvContext = inBorrowedRecvContext;
+	}
+
 	RUDPSession* session{};
 	RecvBuffer* ownerRecvBuffer{};
 	uint32_t ownerSessionGeneration{};
 	NetBuffer* buffer{};
+	// buffer가 recvPacketView이면 패킷이 들어 있는 수신 슬롯의 컨텍스트입니다.
+	IOContext* borrowedRecvContext{};
+	RecvPacketView recvPacketView;
 	char clientAddrBuffer[sizeof(SOCKADDR_INET)];
 };
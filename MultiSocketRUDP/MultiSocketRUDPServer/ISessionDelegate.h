@@ -14,7 +14,7 @@ struct IOContext;
 struct RecvBuffer;
 struct SendPacketInfo;
 
-namespace MultiSocketRUDP { struct PacketSequenceSetKey; }
+class SendSequenceBitmap;
 
 enum class IO_MODE : unsigned int;
 enum class SESSION_STATE : unsigned char;
@@ -39,14 +39,18 @@ public:
 
 	virtual void RecvContextReset(RUDPSession& session) = 0;
 	[[nodiscard]]
-	virtual std::shared_ptr<IOContext> GetRecvBufferContext(const RUDPSession& session) = 0;
-	[[nodiscard]]
 	virtual RecvBuffer& GetRecvBuffer(RUDPSession& session) = 0;
 	[[nodiscard]]
 	virtual RIO_RQ GetRecvRIORQ(const RUDPSession& session) = 0;
 
 	[[nodiscard]]
 	virtual std::atomic<IO_MODE>& GetSendIOMode(RUDPSession& session) = 0;
+	[[nodiscard]]
+	virtual std::atomic_uint& GetSendDatagramsInFlight(RUDPSession& session) = 0;
+	[[nodiscard]]
+	virtual std::atomic_bool& GetDeferredSendCommitPending(RUDPSession& session) = 0;
+	[[nodiscard]]
+	virtual unsigned int GetDatagramSizeBudget(const RUDPSession& session) = 0;
 	virtual bool IsNothingToSend(RUDPSession& session) = 0;
 	virtual bool IsSendPacketInfoQueueEmpty(RUDPSession& session) = 0;
 	[[nodiscard]]
@@ -63,9 +67,16 @@ public:
 	[[nodiscard]]
 	virtual RIO_BUFFERID GetSendBufferId(const RUDPSession& session) = 0;
 	[[nodiscard]]
+	virtual ULONG GetSendBufferOffset(const RUDPSession& session) = 0;
+	[[nodiscard]]
+	virtual bool AcquireSendBuffer(RUDPSession& session) = 0;
+	virtual void ReleaseSendBuffer(RUDPSession& session) = 0;
+	[[nodiscard]]
 	virtual RIO_RQ GetSendRIORQ(const RUDPSession& session) = 0;
 	[[nodiscard]]
-	virtual std::set<MultiSocketRUDP::PacketSequenceSetKey>& GetCachedSequenceSet(RUDPSession& session) = 0;
+	virtual const RIO_BUF& GetClientAddressRIOBuffer(const RUDPSession& session) = 0;
+	[[nodiscard]]
+	virtual SendSequenceBitmap& GetSendSequenceBitmap(RUDPSession& session) = 0;
 
 	[[nodiscard]]
 	virtual bool TryConnect(RUDPSession& session, NetBuffer& recvPacket, const sockaddr_in& clientAddr) = 0;
@@ -75,6 +86,7 @@ public:
 	virtual bool OnRecvPacket(RUDPSession& session, NetBuffer& recvPacket) = 0;
 	virtual void RefreshLastRecvPacketTime(RUDPSession& session, unsigned long long now) = 0;
 	virtual void OnSendReply(RUDPSession& session, NetBuffer& recvPacket) = 0;
+	virtual void OnPathMtuProbeReply(RUDPSession& session, NetBuffer& recvPacket) = 0;
 	virtual void Disconnect(RUDPSession& session, NetBuffer& recvPacket) = 0;
 
 	virtual void SendHeartbeatPacket(RUDPSession& session, const unsigned long long now) = 0;
@@ -84,6 +84,8 @@ void MultiSocketRUDPCore::RunIOWorkerThread(const std::stop_token& stopToken, co
 			return;
 		}
 
+		// 이번 반복에서 완료 후속 송신과 페이싱 송신이 게시한 요청은 반복 끝에서 한 번에 커밋합니다.
+		ioHandler->BeginDeferredSendCommit();
 		for (ULONG i = 0; i < numOfResults; ++i)
 		{
 			const auto context = reinterpret_cast<IOContext*>(rioResults[i].RequestContext);
@@ -99,6 +101,9 @@ void MultiSocketRUDPCore::RunIOWorkerThread(const std::stop_token& stopToken, co
 			}
 		}
 
+		FlushDuePacedSends(threadId);
+		ioHandler->CommitDeferredSends();
+
 #if USE_IO_WORKER_THREAD_SLEEP_FOR_FRAME == USE_WORKER_THREAD_SLEEP_FOR_FRAME
 		SleepRemainingFrameTime(tickSet, workerThreadOneFrameMs);
 #elif USE_IO_WORKER_THREAD_SLEEP_FOR_FRAME == USE_WORKER_THREAD_SLEEP_ZERO
@@ -114,13 +119,27 @@ void MultiSocketRUDPCore::RunIOWorkerThread(const std::stop_token& stopToken, co
 void MultiSocketRUDPCore::RunRecvLogicWorkerThread(const std::stop_token& stopToken, const ThreadIdType threadId)
 {
 	const HANDLE eventHandles[2] = { recvLogicThreadEventHandles[threadId], recvLogicThreadEventStopHandle };
+	auto& recvQueue = *recvIOCompletedContexts[threadId];
+	DWORD waitMs = INFINITE;
 	while (not stopToken.stop_requested())
 	{
-		switch (WaitForMultipleObjects(2, eventHandles, FALSE, INFINITE))
+		// 링이 비어 있을 때만 잠든다고 알리고 기다리므로, 바쁜 동안에는 IO worker가 event를 신호하지 않습니다.
+		if (not recvQueue.PrepareWait())
+		{
+			OnRecvPacket(threadId);
+			waitMs = FlushDueDelayedAcks(threadId);
+			continue;
+		}
+
+		const DWORD waitResult = WaitForMultipleObjects(2, eventHandles, FALSE, waitMs);
+		recvQueue.FinishWait();
+		switch (waitResult)
 		{
 		case WAIT_OBJECT_0:
 			OnRecvPacket(threadId);
 			break;
+		case WAIT_TIMEOUT:
+			break;
 		case WAIT_OBJECT_0 + 1:
 			Sleep(LOGIC_THREAD_STOP_SLEEP_TIME);
 			OnRecvPacket(threadId);
@@ -143,6 +162,8 @@ void MultiSocketRUDPCore::RunRecvLogicWorkerThread(const std::stop_token& stopTo
 			return;
 		}
 		}
+
+		waitMs = FlushDueDelayedAcks(threadId);
 	}
 }
 
@@ -172,29 +193,13 @@ void MultiSocketRUDPCore::RunRetransmissionThread(const std::stop_token& stopTok
 		std::chrono::steady_clock::time_point nextDeadline{};
 		{
 			std::scoped_lock lock(scheduler.lock);
-			const auto now = std::chrono::steady_clock::now();
-			while (not scheduler.heap.empty())
+			scheduler.wheel.PopExpired(std::chrono::steady_clock::now(), dueList);
+			for (auto* sendPacketInfo : dueList)
 			{
-				const RetransmissionHeapEntry& top = scheduler.heap.top();
-				if (top.info->isErasedPacketInfo.load(std::memory_order_acquire) || top.version != top.info->scheduleVersion)
-				{
-					SendPacketInfo* staleInfo = top.info;
-					scheduler.heap.pop();
-					SendPacketInfo::Free(staleInfo);
-					continue;
-				}
-
-				if (top.deadline > now)
-				{
-					hasNext = true;
-					nextDeadline = top.deadline;
-					break;
-				}
-
-				top.info->InvalidateRttSample();
-				dueList.push_back(top.info);
-				scheduler.heap.pop();
+				sendPacketInfo->InvalidateRttSample();
 			}
+
+			hasNext = scheduler.wheel.GetNextDeadline(nextDeadline);
 		}
 
 		for (auto* sendPacketInfo : dueList)
@@ -255,12 +260,13 @@ void MultiSocketRUDPCore::RunRetransmissionThread(const std::stop_token& stopTok
 
 	{
 		std::scoped_lock lock(scheduler.lock);
-		while (not scheduler.heap.empty())
-		{
-			SendPacketInfo* info = scheduler.heap.top().info;
-			scheduler.heap.pop();
-			SendPacketInfo::Free(info);
-		}
+		dueList.clear();
+		scheduler.wheel.PopAll(dueList);
+	}
+
+	for (auto* sendPacketInfo : dueList)
+	{
+		SendPacketInfo::Free(sendPacketInfo);
 	}
 }
 
@@ -299,7 +305,11 @@ void MultiSocketRUDPCore::ProcessRetransmission(SendPacketInfo* sendPacketInfo,
 		sendPacketInfo->owner->OnRetransmissionTimeout();
 	}
 
-	if (not SendPacket(sendPacketInfo) && sendPacketInfo->IsOwnerValid())
+	if (SendPacket(sendPacketInfo))
+	{
+		timeoutRetransmissionCount.fetch_add(1, std::memory_order_relaxed);
+	}
+	else if (sendPacketInfo->IsOwnerValid())
 	{
 		sendPacketInfo->owner->DoDisconnect(DISCONNECT_REASON::BY_ERROR);
 	}
@@ -6,6 +6,7 @@
 #include "Ticker.h"
 #include "MultiSocketRUDPCoreFunctionDelegate.h"
 #include "RIOManager.h"
+#include "RecvSlotPool.h"
 #include "RUDPSessionBroker.h"
 #include "SendPacketInfo.h"
 #include "../Common/etc/UtilFunc.h"
@@ -13,6 +14,7 @@
 #include "RUDPThreadManager.h"
 #include "RUDPPacketProcessor.h"
 #include "RUDPIOHandler.h"
+#include <array>
 
 #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
 #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
@@ -20,7 +22,7 @@
 
 namespace
 {
-	SOCKET CreateRUDPSocket()
+	SOCKET CreateRUDPSocket(const bool dontFragment)
 	{
 		const SOCKET sock = WSASocket(AF_INET, SOCK_DGRAM, IPPROTO_UDP, nullptr, 0, WSA_FLAG_REGISTERED_IO);
 		if (sock == INVALID_SOCKET)
@@ -29,6 +31,18 @@ namespace
 			return INVALID_SOCKET;
 		}
 
+		// PLPMTUD 프로브가 단편화되어 통과하면 경로 MTU를 알 수 없으므로 DF 비트를 설정합니다.
+		if (dontFragment)
+		{
+			constexpr DWORD enable = TRUE;
+			if (setsockopt(sock, IPPROTO_IP, IP_DONTFRAGMENT, reinterpret_cast<const char*>(&enable), sizeof(enable)) == SOCKET_ERROR)
+			{
+				LOG_ERROR(std::format("setsockopt(IP_DONTFRAGMENT) failed with error code {}", WSAGetLastError()));
+				closesocket(sock);
+				return INVALID_SOCKET;
+			}
+		}
+
 		sockaddr_in serverAddr = {};
 		serverAddr.sin_family = AF_INET;
 		serverAddr.sin_addr.S_un.S_addr = INADDR_ANY;
@@ -59,30 +73,6 @@ namespace
 	}
 }
 
-void MultiSocketRUDPCore::RecvIOCompletedQueue::Enqueue(RecvIOCompletedContext* const inContext)
-{
-	std::scoped_lock lock(queueLock);
-	contexts.push(inContext);
-}
-
-bool MultiSocketRUDPCore::RecvIOCompletedQueue::Dequeue(RecvIOCompletedContext** const outContext)
-{
-	if (outContext == nullptr)
-	{
-		return false;
-	}
-
-	std::scoped_lock lock(queueLock);
-	if (contexts.empty())
-	{
-		return false;
-	}
-
-	*outContext = contexts.front();
-	contexts.pop();
-	return true;
-}
-
 MultiSocketRUDPCore::MultiSocketRUDPCore(std::wstring&& inSessionBrokerCertStoreName
 	, std::wstring&& inSessionBrokerCertSubjectName)
 	: MultiSocketRUDPCore(TLSHelper::ServerCertificateConfig::FromStore(inSessionBrokerCertStoreName, inSessionBrokerCertSubjectName))
@@ -165,10 +155,19 @@ void MultiSocketRUDPCore::StopServer()
 	CloseWorkerEventHandles();
 	CloseRetransmissionSchedulerHandles();
 	retransmissionSchedulers.clear();
+	delayedAckQueues.clear();
+	pacedSendQueues.clear();
 
 	Ticker::GetInstance().Stop();
 
 	ClearAllSession();
+	LOG_DEBUG(std::format("Registered buffer high-water mark. send buffers {}, recv slots {}", GetSendBufferHighWaterMark(), GetRecvSlotHighWaterMark()));
+	{
+		LOG_DEBUG(std::format("Recv packets dropped by full logic worker rings {}", GetRecvIOCompletedDroppedCount()));
+	}
+	recvSlotPools.clear();
+	sendBufferSlabs.clear();
+	clientAddressSlabs.clear();
 	MultiSocketRUDPCoreFunctionDelegate::Instance().Clear(*this);
 	StopLoggerThread();
 
@@ -273,7 +272,41 @@ unsigned int MultiSocketRUDPCore::GetAllDisconnectedByRetransmissionCount() cons
 	return sessionManager->GetAllDisconnectedByRetransmissionCount();
 }
 
+unsigned int MultiSocketRUDPCore::GetTimeoutRetransmissionCount() const
+{
+	return timeoutRetransmissionCount.load(std::memory_order_relaxed);
+}
+
+unsigned int MultiSocketRUDPCore::GetFastRetransmissionCount() const
+{
+	return fastRetransmissionCount.load(std::memory_order_relaxed);
+}
+
 bool MultiSocketRUDPCore::SendPacket(SendPacketInfo* sendPacketInfo) const
+{
+	if (not EnqueueSendPacketInfo(sendPacketInfo))
+	{
+		return false;
+	}
+
+	return ioHandler->DoSend(*sendPacketInfo->owner, sendPacketInfo->owner->threadId);
+}
+
+bool MultiSocketRUDPCore::SendPackets(RUDPSession& owner, const std::span<SendPacketInfo* const> sendPacketInfos) const
+{
+	for (SendPacketInfo* sendPacketInfo : sendPacketInfos)
+	{
+		if (not EnqueueSendPacketInfo(sendPacketInfo))
+		{
+			return false;
+		}
+	}
+
+	// 모두 큐에 넣은 뒤 한 번만 송신 패스를 돌려야 같은 패스에서 데이터그램으로 묶입니다.
+	return ioHandler->DoSend(owner, owner.threadId);
+}
+
+bool MultiSocketRUDPCore::EnqueueSendPacketInfo(SendPacketInfo* sendPacketInfo) const
 {
 	if (sendPacketInfo == nullptr || sendPacketInfo->owner == nullptr || sendPacketInfo->GetBuffer() == nullptr)
 	{
@@ -302,11 +335,6 @@ bool MultiSocketRUDPCore::SendPacket(SendPacketInfo* sendPacketInfo) const
 
 	sendPacketInfo->AddRefCount();
 	sendPacketInfo->owner->rioContext.GetSendContext().PushSendPacketInfo(sendPacketInfo);
-	if (not ioHandler->DoSend(*sendPacketInfo->owner, sendPacketInfo->owner->threadId))
-	{
-		return false;
-	}
-
 	return true;
 }
 
@@ -331,9 +359,43 @@ void MultiSocketRUDPCore::MarkSendPacketInfoErased(OUT SendPacketInfo* eraseTarg
 		}
 
 		eraseTarget->isErasedPacketInfo.store(true, std::memory_order_release);
+		CancelRetransmissionSchedule(*retransmissionSchedulers[threadId], *eraseTarget);
 	}
 }
 
+bool MultiSocketRUDPCore::FastRetransmit(OUT SendPacketInfo* sendPacketInfo, const ThreadIdType threadId)
+{
+	if (sendPacketInfo == nullptr || threadId >= retransmissionSchedulers.size() || retransmissionSchedulers[threadId] == nullptr)
+	{
+		return false;
+	}
+
+	{
+		std::scoped_lock lock(retransmissionSchedulers[threadId]->lock);
+		if (sendPacketInfo->isErasedPacketInfo.load(std::memory_order_acquire)
+			|| sendPacketInfo->retransmissionCount + 1 >= maxPacketRetransmissionCount)
+		{
+			return false;
+		}
+
+		++sendPacketInfo->retransmissionCount;
+	}
+
+	sendPacketInfo->InvalidateRttSample();
+	if (not SendPacket(sendPacketInfo))
+	{
+		if (sendPacketInfo->IsOwnerValid())
+		{
+			sendPacketInfo->owner->DoDisconnect(DISCONNECT_REASON::BY_ERROR);
+		}
+
+		return false;
+	}
+
+	fastRetransmissionCount.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
 RIO_EXTENSION_FUNCTION_TABLE MultiSocketRUDPCore::GetRIOFunctionTable() const
 {
 	return rioManager->GetRIOFunctionTable();
@@ -369,6 +431,104 @@ unsigned int MultiSocketRUDPCore::GetMaxRetransmissionMs() const
 	return maxRetransmissionMs;
 }
 
+unsigned int MultiSocketRUDPCore::GetDatagramSizeBudget() const
+{
+	return datagramSizeBudget;
+}
+
+unsigned int MultiSocketRUDPCore::GetMaxProbeDatagramSize() const
+{
+	return maxProbeDatagramSize;
+}
+
+BYTE MultiSocketRUDPCore::GetDelayedAckPacketCount() const
+{
+	return delayedAckPacketCount;
+}
+
+unsigned int MultiSocketRUDPCore::GetDelayedAckTimeoutMs() const
+{
+	return delayedAckTimeoutMs;
+}
+
+CONGESTION_CONTROL_TYPE MultiSocketRUDPCore::GetCongestionControlType() const
+{
+	return congestionControlType;
+}
+
+bool MultiSocketRUDPCore::IsSendPacingEnabled() const
+{
+	return useSendPacing;
+}
+
+bool MultiSocketRUDPCore::IsZeroCopyRecvEnabled() const
+{
+	return useZeroCopyRecv;
+}
+
+RecvSlotPool* MultiSocketRUDPCore::GetRecvSlotPool(const ThreadIdType threadId) const
+{
+	if (threadId >= recvSlotPools.size())
+	{
+		return nullptr;
+	}
+
+	return recvSlotPools[threadId].get();
+}
+
+RegisteredBufferSlab* MultiSocketRUDPCore::GetSendBufferSlab(const ThreadIdType threadId) const
+{
+	if (threadId >= sendBufferSlabs.size())
+	{
+		return nullptr;
+	}
+
+	return sendBufferSlabs[threadId].get();
+}
+
+RegisteredBufferSlab* MultiSocketRUDPCore::GetClientAddressSlab(const ThreadIdType threadId) const
+{
+	if (threadId >= clientAddressSlabs.size())
+	{
+		return nullptr;
+	}
+
+	return clientAddressSlabs[threadId].get();
+}
+
+size_t MultiSocketRUDPCore::GetSendBufferHighWaterMark() const
+{
+	size_t highWaterMark = 0;
+	for (const auto& slab : sendBufferSlabs)
+	{
+		highWaterMark += slab->GetHighWaterMark();
+	}
+
+	return highWaterMark;
+}
+
+size_t MultiSocketRUDPCore::GetRecvSlotHighWaterMark() const
+{
+	size_t highWaterMark = 0;
+	for (const auto& pool : recvSlotPools)
+	{
+		highWaterMark += pool->GetHighWaterMark();
+	}
+
+	return highWaterMark;
+}
+
+size_t MultiSocketRUDPCore::GetRecvIOCompletedDroppedCount() const
+{
+	size_t droppedCount = 0;
+	for (const auto& recvQueue : recvIOCompletedContexts)
+	{
+		droppedCount += recvQueue->GetDroppedCount();
+	}
+
+	return droppedCount;
+}
+
 void MultiSocketRUDPCore::DisconnectSession(const SessionIdType disconnectTargetSessionId) const
 {
 	if (not sessionManager->ReleaseSession(disconnectTargetSessionId))
@@ -420,12 +580,51 @@ bool MultiSocketRUDPCore::EnqueueContextResult(const IOContext* contextResult, N
 		contextResult->ownerSessionGeneration,
 		buffer,
 		contextResult->clientAddrBuffer);
-	recvIOCompletedContexts[threadId]->Enqueue(recvIOContext);
-	SignalRecvLogicThread(threadId);
+	PushRecvIOCompletedContext(recvIOContext, threadId);
+
+	return true;
+}
+
+bool MultiSocketRUDPCore::EnqueueBorrowedContextResult(IOContext* contextResult, char* packet, const unsigned int packetSize, const BYTE threadId)
+{
+	if (contextResult == nullptr || contextResult->session == nullptr ||
+		contextResult->ownerRecvBuffer == nullptr || packet == nullptr)
+	{
+		LOG_ERROR("Invalid context or packet in EnqueueBorrowedContextResult()");
+		return false;
+	}
+
+	const auto recvIOContext = recvIOCompletedContextPool.Alloc();
+	if (recvIOContext == nullptr)
+	{
+		LOG_ERROR("recvIOContext is nullptr in EnqueueBorrowedContextResult()");
+		return false;
+	}
+
+	contextResult->ownerRecvBuffer->BorrowRecvSlot(contextResult);
+	contextResult->ownerRecvBuffer->BeginRecvLogic();
+	recvIOContext->InitBorrowedContext(contextResult, packet, packetSize);
+	PushRecvIOCompletedContext(recvIOContext, threadId);
 
 	return true;
 }
 
+void MultiSocketRUDPCore::PushRecvIOCompletedContext(RecvIOCompletedContext* const recvIOContext, const BYTE threadId)
+{
+	auto& recvQueue = *recvIOCompletedContexts[threadId];
+	if (not recvQueue.TryEnqueue(recvIOContext))
+	{
+		// logic worker가 밀려 링이 가득 찼으므로 수신 손실로 보고 버립니다. 재전송이 복구합니다.
+		CompleteRecvIOCompletedContext(recvIOContext, false);
+		return;
+	}
+
+	if (recvQueue.ShouldWakeConsumer())
+	{
+		SignalRecvLogicThread(threadId);
+	}
+}
+
 void MultiSocketRUDPCore::SignalRecvLogicThread(const BYTE threadId)
 {
 	if (SetEvent(recvLogicThreadEventHandles[threadId]))
@@ -458,7 +657,7 @@ bool MultiSocketRUDPCore::InitRIO()
 	{
 		rioManager = std::make_unique<RIOManager>(sessionDelegate);
 		ioHandler = std::make_unique<RUDPIOHandler>(*rioManager, sessionDelegate, contextPool, retransmissionSchedulers, maxHoldingPacketQueueSize, retransmissionMs,
-			simulatedPacketLossPercent, simulatedPacketLossSeed);
+			simulatedPacketLossPercent, simulatedPacketLossSeed, useZeroCopyRecv);
 		if (rioManager == nullptr || ioHandler == nullptr)
 		{
 			LOG_ERROR("RIOManager or RUDPIOHandler creation failed");
@@ -472,6 +671,24 @@ bool MultiSocketRUDPCore::InitRIO()
 			result = false;
 			break;
 		}
+
+		recvSlotPools.reserve(numOfWorkerThread);
+		sendBufferSlabs.reserve(numOfWorkerThread);
+		clientAddressSlabs.reserve(numOfWorkerThread);
+		for (unsigned char id = 0; id < numOfWorkerThread; ++id)
+		{
+			auto& recvSlotPool = recvSlotPools.emplace_back(std::make_unique<RecvSlotPool>(rioManager->GetRIOFunctionTable()));
+			auto& sendBufferSlab = sendBufferSlabs.emplace_back(std::make_unique<RegisteredBufferSlab>(
+				rioManager->GetRIOFunctionTable(), MAX_SEND_BUFFER_SIZE, SEND_BUFFER_SLAB_CHUNKS_PER_REGION));
+			auto& clientAddressSlab = clientAddressSlabs.emplace_back(std::make_unique<RegisteredBufferSlab>(
+				rioManager->GetRIOFunctionTable(), CLIENT_ADDRESS_SLOT_SIZE, CLIENT_ADDRESS_SLOTS_PER_REGION));
+			if (not recvSlotPool->Initialize() || not sendBufferSlab->Initialize() || not clientAddressSlab->Initialize())
+			{
+				LOG_ERROR("Worker buffer pool initialization failed");
+				result = false;
+				break;
+			}
+		}
 	} while (false);
 	
 	return result;
@@ -519,11 +736,14 @@ bool MultiSocketRUDPCore::CreateWorkerEventHandles()
 bool MultiSocketRUDPCore::InitializeWorkerResources()
 {
 	recvIOCompletedContexts.reserve(numOfWorkerThread);
+	delayedAckQueues.resize(numOfWorkerThread);
+	pacedSendQueues.reserve(numOfWorkerThread);
 
 	Ticker::GetInstance().Start(timerTickMs);
 	for (unsigned char id = 0; id < numOfWorkerThread; ++id)
 	{
-		recvIOCompletedContexts.emplace_back(std::make_unique<RecvIOCompletedQueue>());
+		recvIOCompletedContexts.emplace_back(std::make_unique<RecvIOCompletedRing>(RECV_IO_COMPLETED_RING_CAPACITY));
+		pacedSendQueues.emplace_back(std::make_unique<PacedSendQueue>());
 
 		const HANDLE recvLogicEventHandle = CreateEvent(nullptr, FALSE, FALSE, nullptr);
 		if (recvLogicEventHandle == NULL)
@@ -714,7 +934,7 @@ CONNECT_RESULT_CODE MultiSocketRUDPCore::InitReserveSession(OUT RUDPSession& ses
 		session.AbortReservedSession();
 	});
 
-	session.socketContext.SetSocket(CreateRUDPSocket());
+	session.socketContext.SetSocket(CreateRUDPSocket(maxProbeDatagramSize > datagramSizeBudget));
 	const SOCKET sock = session.GetSocket();
 	if (sock == INVALID_SOCKET)
 	{
@@ -755,21 +975,190 @@ void MultiSocketRUDPCore::StopAllThreads() const
 
 void MultiSocketRUDPCore::OnRecvPacket(const BYTE threadId)
 {
-	while (true)
+	// 수신 패킷 처리 중 보낸 응답과 ACK는 큐를 비운 뒤 세션마다 한 번씩 커밋합니다.
+	ioHandler->BeginDeferredSendCommit();
+	auto& recvQueue = *recvIOCompletedContexts[threadId];
+	std::array<RecvIOCompletedContext*, RECV_LOGIC_DEQUEUE_BATCH_SIZE> contexts{};
+	while (const size_t count = recvQueue.DequeueBatch(contexts))
 	{
-		RecvIOCompletedContext* context = nullptr;
-		if (not recvIOCompletedContexts[threadId]->Dequeue(&context))
+		for (size_t i = 0; i < count; ++i)
 		{
-			break;
+			ProcessRecvIOCompletedContext(contexts[i]);
+		}
+	}
+	ioHandler->CommitDeferredSends();
+}
+
+bool MultiSocketRUDPCore::ScheduleDelayedAck(RUDPSession& session, const unsigned long long ackDeadline)
+{
+	const ThreadIdType threadId = session.GetThreadId();
+	if (threadId >= delayedAckQueues.size())
+	{
+		return false;
+	}
+
+	delayedAckQueues[threadId].push_back({ &session, session.GetSessionGeneration(), ackDeadline });
+	return true;
+}
+
+bool MultiSocketRUDPCore::SchedulePacedSend(RUDPSession& session, const std::chrono::steady_clock::time_point departureTime)
+{
+	const ThreadIdType threadId = session.GetThreadId();
+	if (threadId >= pacedSendQueues.size())
+	{
+		return false;
+	}
+
+	auto& pacedSendQueue = *pacedSendQueues[threadId];
+	std::scoped_lock lock(pacedSendQueue.lock);
+	pacedSendQueue.entries.push({ departureTime, &session, session.GetSessionGeneration() });
+	return true;
+}
+
+bool MultiSocketRUDPCore::Broadcast(IPacket& packet, const std::span<const SessionIdType> sessionIds)
+{
+	if (not RUDPSession::IsSendablePacketBodySize(packet))
+	{
+		return false;
+	}
+
+	NetBuffer* sharedBody = NetBuffer::Alloc();
+	if (sharedBody == nullptr)
+	{
+		LOG_ERROR("Buffer is nullptr in MultiSocketRUDPCore::Broadcast()");
+		return false;
+	}
+	auto freeSharedBody = Util::MakeScopeExit([sharedBody]() {
+		NetBuffer::Free(sharedBody);
+	});
+
+	const PacketId packetId = packet.GetPacketId();
+	*sharedBody << packetId;
+	packet.PacketToBuffer(*sharedBody);
+
+	// 세션을 IO worker별로 모아 두었다가 worker마다 예약 큐 잠금을 한 번만 잡습니다.
+	// 목록은 스레드마다 재사용하며, 세션 콜백 안에서 다시 불려도 서로 덮어쓰지 않도록 호출 동안은 꺼내 둡니다.
+	thread_local std::vector<std::vector<PacedSendEntry>> reusableFlushTargetsByThread;
+	auto flushTargetsByThread = std::move(reusableFlushTargetsByThread);
+	if (flushTargetsByThread.size() < pacedSendQueues.size())
+	{
+		flushTargetsByThread.resize(pacedSendQueues.size());
+	}
+
+	for (const SessionIdType sessionId : sessionIds)
+	{
+		RUDPSession* session = GetUsingSession(sessionId);
+		if (session == nullptr)
+		{
+			continue;
+		}
+
+		const uint32_t sessionGeneration = session->GetSessionGeneration();
+		if (not session->IsConnected())
+		{
+			continue;
 		}
 
-		if (context == nullptr)
+		bool needsFlushSchedule = false;
+		std::chrono::steady_clock::time_point flushTime{};
+		if (not session->EnqueueBroadcastBody(*sharedBody, needsFlushSchedule, flushTime) || not needsFlushSchedule)
 		{
 			continue;
 		}
 
-		ProcessRecvIOCompletedContext(context);
+		if (const ThreadIdType threadId = session->GetThreadId(); threadId < pacedSendQueues.size())
+		{
+			flushTargetsByThread[threadId].push_back({ flushTime, session, sessionGeneration });
+		}
+		else
+		{
+			// 맡길 IO worker가 없으면 SchedulePacedFlush처럼 다음 ACK가 보류 큐를 비울 때까지 기다립니다.
+			session->ClearPacedFlushSchedule();
+		}
 	}
+
+	for (size_t threadId = 0; threadId < pacedSendQueues.size(); ++threadId)
+	{
+		auto& flushTargets = flushTargetsByThread[threadId];
+		if (flushTargets.empty())
+		{
+			continue;
+		}
+
+		auto& pacedSendQueue = *pacedSendQueues[threadId];
+		{
+			std::scoped_lock lock(pacedSendQueue.lock);
+			for (const PacedSendEntry& entry : flushTargets)
+			{
+				// 넣은 뒤 세션이 해제되어 재사용되었으면 새 연결에 flush를 걸지 않습니다.
+				if (entry.session->GetSessionGeneration() != entry.sessionGeneration)
+				{
+					continue;
+				}
+
+				pacedSendQueue.entries.push(entry);
+			}
+		}
+		flushTargets.clear();
+	}
+
+	reusableFlushTargetsByThread = std::move(flushTargetsByThread);
+	return true;
+}
+
+void MultiSocketRUDPCore::FlushDuePacedSends(const ThreadIdType threadId)
+{
+	auto& pacedSendQueue = *pacedSendQueues[threadId];
+	const auto now = std::chrono::steady_clock::now();
+	while (true)
+	{
+		PacedSendEntry entry;
+		{
+			std::scoped_lock lock(pacedSendQueue.lock);
+			if (pacedSendQueue.entries.empty() || pacedSendQueue.entries.top().departureTime > now)
+			{
+				return;
+			}
+
+			entry = pacedSendQueue.entries.top();
+			pacedSendQueue.entries.pop();
+		}
+
+		// 완료 처리 카운터를 먼저 올려 두어야 검증 이후 세션이 최종 해제되지 않습니다.
+		RUDPSession* session = entry.session;
+		session->BeginIOCompletion();
+		if (session->GetSessionGeneration() == entry.sessionGeneration && session->IsConnected())
+		{
+			session->OnPacedSendDue();
+		}
+		session->CompleteIOCompletion();
+	}
+}
+
+DWORD MultiSocketRUDPCore::FlushDueDelayedAcks(const BYTE threadId)
+{
+	auto& delayedAckQueue = delayedAckQueues[threadId];
+	const unsigned long long now = GetTickCount64();
+	while (not delayedAckQueue.empty())
+	{
+		const DelayedAckEntry& entry = delayedAckQueue.front();
+		if (entry.ackDeadline > now)
+		{
+			return static_cast<DWORD>(entry.ackDeadline - now);
+		}
+
+		// 처리 중 표시를 먼저 세워 두어야 검증 이후 세션이 최종 해제되지 않습니다.
+		RUDPSession* session = entry.session;
+		session->nowInProcessingRecvPacket.store(true, std::memory_order_release);
+		if (session->GetSessionGeneration() == entry.sessionGeneration && session->IsConnected())
+		{
+			session->FlushDelayedAck(now);
+		}
+		session->nowInProcessingRecvPacket.store(false, std::memory_order_release);
+		delayedAckQueue.pop_front();
+	}
+
+	return INFINITE;
 }
 
 void MultiSocketRUDPCore::ProcessRecvIOCompletedContext(RecvIOCompletedContext* const context)
@@ -791,6 +1180,7 @@ bool MultiSocketRUDPCore::TryDispatchRecvPacket(RecvIOCompletedContext* const co
 	}
 
 	context->session->nowInProcessingRecvPacket.store(true, std::memory_order_release);
+	const RecvPacketView::DispatchScope dispatchScope(context->borrowedRecvContext != nullptr ? context->buffer : nullptr);
 	packetProcessor->OnRecvPacket(*context->session
 		, *context->buffer
 		, std::span(reinterpret_cast<const unsigned char*>(context->clientAddrBuffer)
@@ -802,7 +1192,14 @@ void MultiSocketRUDPCore::CompleteRecvIOCompletedContext(
 	RecvIOCompletedContext* const context,
 	const bool processingStarted)
 {
-	if (context->buffer != nullptr)
+	if (context->borrowedRecvContext != nullptr)
+	{
+		// 슬롯이 다시 게시되기 전에 뷰를 떼어 놓아야 합니다.
+		context->recvPacketView.Detach();
+		context->ownerRecvBuffer->ReleaseRecvSlot(context->borrowedRecvContext);
+		context->borrowedRecvContext = nullptr;
+	}
+	else if (context->buffer != nullptr)
 	{
 		NetBuffer::Free(context->buffer);
 	}
@@ -8,13 +8,17 @@
 #include "../Common/TLS/TLSHelper.h"
 #include "RUDPSession.h"
 #include <queue>
+#include <deque>
 #include <vector>
 #include "RUDPSessionFunctionDelegate.h"
 #include "IOContext.h"
+#include "RecvIOCompletedRing.h"
 #include "RUDPSessionManager.h"
 #include <functional>
 #include <mutex>
+#include <atomic>
 #include <optional>
+#include <span>
 
 #pragma comment(lib, "ws2_32.lib")
 
@@ -51,18 +55,30 @@ class MultiSocketRUDPCore : public ICore
 	friend MultiSocketRUDPCoreTestAccess;
 
 private:
-	// Receives are produced by an I/O worker and consumed by its paired logic worker.
-	// Owning synchronization here also gives the queue a deterministic, cycle-free teardown.
-	class RecvIOCompletedQueue final
+	// A session schedules at most one entry per delayed window and only from its own logic worker,
+	// so each queue is touched by a single thread and stays sorted by deadline.
+	struct DelayedAckEntry
 	{
-	public:
-		void Enqueue(RecvIOCompletedContext* inContext);
+		RUDPSession* session{};
+		uint32_t sessionGeneration{};
+		unsigned long long ackDeadline{};
+	};
+
+	// Any sender thread may schedule, so each queue has its own lock; the owning IO worker pops due entries.
+	struct PacedSendEntry
+	{
+		std::chrono::steady_clock::time_point departureTime{};
+		RUDPSession* session{};
+		uint32_t sessionGeneration{};
+
 		[[nodiscard]]
-		bool Dequeue(RecvIOCompletedContext** outContext);
+		bool operator>(const PacedSendEntry& other) const noexcept { return departureTime > other.departureTime; }
+	};
 
-	private:
-		std::mutex queueLock;
-		std::queue<RecvIOCompletedContext*> contexts;
+	struct PacedSendQueue
+	{
+		std::mutex lock;
+		std::priority_queue<PacedSendEntry, std::vector<PacedSendEntry>, std::greater<>> entries;
 	};
 
 public:
@@ -106,11 +122,67 @@ public:
 	unsigned int GetAllDisconnectedCount() const;
 	[[nodiscard]]
 	unsigned int GetAllDisconnectedByRetransmissionCount() const;
+	// ----------------------------------------
+	// @brief 재전송 기한이 지나 다시 보낸 패킷 수를 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	unsigned int GetTimeoutRetransmissionCount() const;
+	// ----------------------------------------
+	// @brief SACK으로 손실을 감지해 기한 전에 다시 보낸 패킷 수를 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	unsigned int GetFastRetransmissionCount() const;
 
 public:
 	bool SendPacket(SendPacketInfo* sendPacketInfo) const override;
+	// ----------------------------------------
+	// @brief 한 세션의 패킷들을 송신 큐에 모두 넣고 송신 패스를 한 번만 시작합니다.
+	// @details 중간에 실패하면 그때까지 넣은 패킷은 큐에 남고 false를 반환합니다. 호출자는 SendPacket이 실패했을 때처럼 정리해야 합니다.
+	// @param owner 모든 패킷의 소유 세션
+	// @param sendPacketInfos 순서대로 보낼 패킷 정보
+	// @return 모두 큐에 넣고 송신 패스 시작에 성공하면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool SendPackets(RUDPSession& owner, std::span<SendPacketInfo* const> sendPacketInfos) const;
+	// ----------------------------------------
+	// @brief 같은 패킷을 여러 세션에 보냅니다. 본문은 한 번만 직렬화합니다.
+	// @details 세션마다 헤더와 시퀀스만 새로 쓰고 공유 본문을 붙여 보류 큐에 넣습니다. 호출한 스레드에서는 암호화하거나 보내지 않고,
+	//          소유 IO worker별로 묶어 flush를 예약해 각 worker가 자기 세션을 암호화하고 보냅니다. cwnd에 막힌 세션은 다음 ACK가 비웁니다.
+	//          이 호출 뒤에 같은 세션으로 보낸 패킷은 이 패킷 뒤에 나갑니다.
+	//          연결되지 않은 세션 id와 보류 큐가 가득 찬 세션은 연결을 유지한 채 건너뜁니다.
+	// @param packet 보낼 패킷
+	// @param sessionIds 받을 세션 id 목록
+	// @return 본문이 너무 크거나 공유 버퍼를 할당하지 못하면 false
+	// ----------------------------------------
+	bool Broadcast(IPacket& packet, std::span<const SessionIdType> sessionIds);
 	void MarkSendPacketInfoErased(OUT SendPacketInfo* eraseTarget, ThreadIdType threadId) override;
 	RIO_EXTENSION_FUNCTION_TABLE GetRIOFunctionTable() const override;
+	// ----------------------------------------
+	// @brief 세션의 미룬 응답을 해당 세션의 logic worker 큐에 등록합니다.
+	// @details 세션의 logic worker에서만 호출해야 합니다.
+	// @param session 응답을 미룬 세션
+	// @param ackDeadline 응답을 보내야 하는 시간 (밀리초)
+	// @return logic worker가 준비되지 않아 등록하지 못했으면 false이며, 호출자는 즉시 응답해야 합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	bool ScheduleDelayedAck(RUDPSession& session, unsigned long long ackDeadline);
+	// ----------------------------------------
+	// @brief 페이서가 막은 보류 패킷을 출발 시각에 내보내도록 세션의 IO worker 큐에 등록합니다.
+	// @details 세션의 보류 큐 잠금을 잡은 상태에서 호출되며, 어느 스레드에서 호출해도 됩니다.
+	// @param session 보류 패킷이 남은 세션
+	// @param departureTime 다음 패킷을 보낼 수 있는 시각
+	// @return IO worker가 준비되지 않아 등록하지 못했으면 false
+	// ----------------------------------------
+	[[nodiscard]]
+	bool SchedulePacedSend(RUDPSession& session, std::chrono::steady_clock::time_point departureTime);
+	// ----------------------------------------
+	// @brief 손실로 판단된 패킷을 재전송 기한을 기다리지 않고 바로 다시 보냅니다.
+	// @details 다시 보내면서 재전송 기한도 새로 잡힙니다. 재전송 한도에 닿는 패킷은 보내지 않고 기한 만료 처리에 맡깁니다.
+	// @param sendPacketInfo 다시 보낼 패킷 정보
+	// @param threadId 세션의 thread id
+	// @return 다시 보냈으면 true
+	// ----------------------------------------
+	bool FastRetransmit(OUT SendPacketInfo* sendPacketInfo, ThreadIdType threadId);
 
 	// ----------------------------------------
 	// @brief NetBuffer에서 페이로드 길이를 추출합니다.
@@ -139,6 +211,70 @@ public:
 	// @brief Returns upper bound for dynamic retransmission timeout and backoff.
 	// ----------------------------------------
 	unsigned int GetMaxRetransmissionMs() const;
+	// ----------------------------------------
+	// @brief 세션이 프로브 없이 사용하는 데이터그램 크기 예산을 반환합니다.
+	// ----------------------------------------
+	unsigned int GetDatagramSizeBudget() const;
+	// ----------------------------------------
+	// @brief PLPMTUD 프로브가 탐색할 최대 데이터그램 크기를 반환합니다.
+	// ----------------------------------------
+	unsigned int GetMaxProbeDatagramSize() const;
+	// ----------------------------------------
+	// @brief 지연 ACK를 보내기 전에 모을 수 있는 최대 패킷 수를 반환합니다. 1이면 지연하지 않습니다.
+	// ----------------------------------------
+	BYTE GetDelayedAckPacketCount() const;
+	// ----------------------------------------
+	// @brief 지연 ACK를 미룰 수 있는 최대 시간을 반환합니다. 0이면 지연하지 않습니다.
+	// ----------------------------------------
+	unsigned int GetDelayedAckTimeoutMs() const;
+	// ----------------------------------------
+	// @brief CONGESTION_CONTROL 옵션으로 선택된 세션 혼잡 제어 종류를 반환합니다.
+	// ----------------------------------------
+	CONGESTION_CONTROL_TYPE GetCongestionControlType() const;
+	// ----------------------------------------
+	// @brief USE_SEND_PACING 옵션으로 세션 송신 페이싱이 켜졌는지 반환합니다.
+	// ----------------------------------------
+	bool IsSendPacingEnabled() const;
+	// ----------------------------------------
+	// @brief USE_ZERO_COPY_RECV 옵션으로 수신 슬롯을 복사 없이 logic worker에 넘기는지 반환합니다.
+	// ----------------------------------------
+	bool IsZeroCopyRecvEnabled() const;
+	// ----------------------------------------
+	// @brief IO worker가 자기 세션들에 나눠 주는 수신 슬롯 풀을 반환합니다.
+	// @param threadId 세션이 속한 worker thread ID
+	// @return 수신 슬롯 풀, 잘못된 threadId이거나 RIO 초기화 전이면 nullptr
+	// ----------------------------------------
+	[[nodiscard]]
+	RecvSlotPool* GetRecvSlotPool(ThreadIdType threadId) const;
+	// ----------------------------------------
+	// @brief IO worker가 자기 세션들의 송신 패스에 빌려 주는 송신 버퍼 슬랩을 반환합니다.
+	// @param threadId 세션이 속한 worker thread ID
+	// @return 송신 버퍼 슬랩, 잘못된 threadId이거나 RIO 초기화 전이면 nullptr
+	// ----------------------------------------
+	[[nodiscard]]
+	RegisteredBufferSlab* GetSendBufferSlab(ThreadIdType threadId) const;
+	// ----------------------------------------
+	// @brief IO worker가 자기 세션들에 하나씩 나눠 주는 클라이언트 주소 슬롯 슬랩을 반환합니다.
+	// @param threadId 세션이 속한 worker thread ID
+	// @return 주소 슬롯 슬랩, 잘못된 threadId이거나 RIO 초기화 전이면 nullptr
+	// ----------------------------------------
+	[[nodiscard]]
+	RegisteredBufferSlab* GetClientAddressSlab(ThreadIdType threadId) const;
+	// ----------------------------------------
+	// @brief 모든 worker가 동시에 빌려 준 송신 버퍼 수의 최댓값을 더해 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	size_t GetSendBufferHighWaterMark() const;
+	// ----------------------------------------
+	// @brief 모든 worker가 동시에 빌려 준 수신 슬롯 수의 최댓값을 더해 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	size_t GetRecvSlotHighWaterMark() const;
+	// ----------------------------------------
+	// @brief 모든 worker의 수신 완료 링이 가득 차 버린 패킷 수를 더해 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	size_t GetRecvIOCompletedDroppedCount() const;
 
 private:
 	void DisconnectSession(SessionIdType disconnectTargetSessionId) const override;
@@ -156,11 +292,24 @@ private:
 
 private:
 	// ----------------------------------------
-	// @brief 완료된 수신 정보를 해당 logic worker의 큐에 전달합니다.
-	// @details 큐 소유권 이전에 성공한 경우에만 true를 반환합니다.
+	// @brief 완료된 수신 정보를 해당 logic worker의 링에 전달합니다.
+	// @details 링으로 소유권을 넘겼거나, 링이 가득 차 수신 손실로 보고 버퍼를 버린 경우 true를 반환합니다.
+	//          logic worker가 잠들어 있을 때만 event를 신호합니다.
 	// ----------------------------------------
 	[[nodiscard]]
 	bool EnqueueContextResult(const IOContext* contextResult, NetBuffer* buffer, BYTE threadId);
+	// ----------------------------------------
+	// @brief 수신 슬롯 안의 패킷을 복사하지 않고 뷰로 해당 logic worker의 큐에 전달합니다.
+	// @details 성공하면 슬롯 참조 하나를 가져가며, 패킷 처리가 끝날 때 CompleteRecvIOCompletedContext에서 반환합니다.
+	//          링이 가득 차면 패킷을 버리고 참조를 바로 돌려줍니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	bool EnqueueBorrowedContextResult(IOContext* contextResult, char* packet, unsigned int packetSize, BYTE threadId);
+	// ----------------------------------------
+	// @brief 패킷 정보를 검증하고 참조를 하나 더해 소유 세션의 송신 큐에 넣습니다. 송신 패스는 시작하지 않습니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	bool EnqueueSendPacketInfo(SendPacketInfo* sendPacketInfo) const;
 
 private:
 	[[nodiscard]]
@@ -249,6 +398,8 @@ private:
 
 private:
 	std::vector<std::unique_ptr<RetransmissionScheduler>> retransmissionSchedulers;
+	std::atomic_uint32_t timeoutRetransmissionCount{};
+	std::atomic_uint32_t fastRetransmissionCount{};
 
 private:
 	[[nodiscard]]
@@ -294,6 +445,13 @@ private:
 	unsigned int retransmissionMs{};
 	unsigned int minRetransmissionMs{};
 	unsigned int maxRetransmissionMs{};
+	unsigned int datagramSizeBudget{ DEFAULT_DATAGRAM_SIZE_BUDGET };
+	unsigned int maxProbeDatagramSize{ DEFAULT_DATAGRAM_SIZE_BUDGET };
+	BYTE delayedAckPacketCount{ 1 };
+	unsigned int delayedAckTimeoutMs{};
+	CONGESTION_CONTROL_TYPE congestionControlType{ CONGESTION_CONTROL_TYPE::NEW_RENO };
+	bool useSendPacing{};
+	bool useZeroCopyRecv{};
 	unsigned int heartbeatThreadSleepMs{};
 	unsigned int timerTickMs{};
 	BYTE maxHoldingPacketQueueSize{};
@@ -310,7 +468,12 @@ private:
 	HANDLE retransmissionStopEventHandle{};
 
 	// objects
-	std::vector<std::unique_ptr<RecvIOCompletedQueue>> recvIOCompletedContexts;
+	std::vector<std::unique_ptr<RecvIOCompletedRing>> recvIOCompletedContexts;
+	std::vector<std::deque<DelayedAckEntry>> delayedAckQueues;
+	std::vector<std::unique_ptr<PacedSendQueue>> pacedSendQueues;
+	std::vector<std::unique_ptr<RecvSlotPool>> recvSlotPools;
+	std::vector<std::unique_ptr<RegisteredBufferSlab>> sendBufferSlabs;
+	std::vector<std::unique_ptr<RegisteredBufferSlab>> clientAddressSlabs;
 	std::list<SessionIdType> releaseSessionIdList;
 	std::mutex releaseSessionIdListLock;
 	CTLSMemoryPool<RecvIOCompletedContext> recvIOCompletedContextPool;
@@ -335,9 +498,24 @@ private:
 	// ----------------------------------------
 	void CompleteRecvIOCompletedContext(RecvIOCompletedContext* context, bool processingStarted);
 	// ----------------------------------------
+	// @brief 채운 수신 컨텍스트를 logic worker의 링에 넣고, 잠든 logic worker만 깨웁니다.
+	// @details 링이 가득 차면 컨텍스트를 바로 정리해 수신 손실로 처리합니다.
+	// ----------------------------------------
+	void PushRecvIOCompletedContext(RecvIOCompletedContext* recvIOContext, BYTE threadId);
+	// ----------------------------------------
 	// @brief 지정한 logic worker의 event를 신호하고 실패 시 치명 오류로 보고합니다.
 	// ----------------------------------------
 	void SignalRecvLogicThread(BYTE threadId);
+	// ----------------------------------------
+	// @brief 기한이 지난 지연 ACK를 모두 보내고 다음 기한까지 남은 시간을 반환합니다.
+	// @return 다음 대기 시간 (밀리초). 남은 지연 ACK가 없으면 INFINITE
+	// ----------------------------------------
+	[[nodiscard]]
+	DWORD FlushDueDelayedAcks(BYTE threadId);
+	// ----------------------------------------
+	// @brief 출발 시각이 지난 페이싱 예약을 꺼내 각 세션의 보류 큐를 비웁니다. 해당 IO worker에서만 호출합니다.
+	// ----------------------------------------
+	void FlushDuePacedSends(ThreadIdType threadId);
 
 private:
 	// Dependencies below retain references to this delegate, so it must outlive them.
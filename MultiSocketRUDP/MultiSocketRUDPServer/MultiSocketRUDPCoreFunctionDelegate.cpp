@@ -10,6 +10,14 @@ bool MultiSocketRUDPCoreFunctionDelegate::EnqueueContextResult(const IOContext*
     return inst.core->EnqueueContextResult(contextResult, buffer, threadId);
 }
 
+bool MultiSocketRUDPCoreFunctionDelegate::EnqueueBorrowedContextResult(IOContext* contextResult, char* packet, const unsigned int packetSize, const BYTE threadId)
+{
+    const auto& inst = Instance();
+    assert(inst.core != nullptr);
+
+    return inst.core->EnqueueBorrowedContextResult(contextResult, packet, packetSize, threadId);
+}
+
 RUDPSession* MultiSocketRUDPCoreFunctionDelegate::AcquireSession()
 {
 	const auto& inst = Instance();
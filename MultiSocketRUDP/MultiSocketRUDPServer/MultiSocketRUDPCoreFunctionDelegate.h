@@ -50,6 +50,8 @@ private:
 private:
     [[nodiscard]]
     static bool EnqueueContextResult(const IOContext* contextResult, NetBuffer* buffer, BYTE threadId);
+    [[nodiscard]]
+    static bool EnqueueBorrowedContextResult(IOContext* contextResult, char* packet, unsigned int packetSize, BYTE threadId);
 	static RUDPSession* AcquireSession();
 	static CONNECT_RESULT_CODE InitReserveSession(OUT RUDPSession& session);
     static void DisconnectSession(SessionIdType sessionId);
@@ -2,9 +2,15 @@
 #include <functional>
 #include <any>
 #include <unordered_map>
+#include <cstdint>
+#include <limits>
 #include "NetServerSerializeBuffer.h"
 
 using PacketId = unsigned int;
+// NetBuffer가 std::string 앞에 쓰는 길이 필드 타입입니다.
+using PacketStringLengthType = uint16_t;
+// 본문 크기를 미리 계산하지 않는 패킷이 GetSerializedSize()에서 반환하는 값입니다.
+constexpr size_t UNKNOWN_SERIALIZED_SIZE = std::numeric_limits<size_t>::max();
 
 class RUDPSession;
 
@@ -16,6 +22,12 @@ public:
 
 	[[nodiscard]]
 	virtual PacketId GetPacketId() const = 0;
+	// ----------------------------------------
+	// @brief PacketToBuffer가 쓰는 본문 크기를 반환합니다.
+	// @details PacketGenerator가 만든 패킷은 필드 타입으로 계산한 값을 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	virtual size_t GetSerializedSize() const { return UNKNOWN_SERIALIZED_SIZE; }
 
 public:
 	virtual void BufferToPacket([[maybe_unused]] NetBuffer& buffer) { UNREFERENCED_PARAMETER(buffer); }
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include "NetServerSerializeBuffer.h"
+#include "PacketManager.h"
+
+// ----------------------------------------
+// @brief 패킷 뷰가 수신 버퍼를 복사하지 않고 필드를 읽을 때 쓰는 함수들입니다.
+// @details 필드를 읽을 때마다 남은 길이를 먼저 확인하므로, 길이가 모자라거나 문자열 길이가 버퍼를 넘는 패킷은 false로 거부됩니다.
+//          문자열은 NetBuffer의 std::string 직렬화와 같이 PacketStringLengthType 길이 뒤에 내용이 오는 형식으로 읽고, 내용은 수신 버퍼를 가리키는 std::string_view로 돌려줍니다.
+//          읽은 std::string_view는 수신 버퍼가 살아 있는 핸들러 호출 동안에만 유효합니다.
+// ----------------------------------------
+template <typename T>
+[[nodiscard]]
+bool ReadViewParameter(const char*& cursor, const char* end, T& param)
+{
+	static_assert(std::is_trivially_copyable_v<T>, "View parameter must be trivially copyable or std::string_view");
+
+	if (static_cast<size_t>(end - cursor) < sizeof(T))
+	{
+		return false;
+	}
+
+	std::memcpy(&param, cursor, sizeof(T));
+	cursor += sizeof(T);
+	return true;
+}
+
+[[nodiscard]]
+inline bool ReadViewParameter(const char*& cursor, const char* end, std::string_view& param)
+{
+	PacketStringLengthType length = 0;
+	if (not ReadViewParameter(cursor, end, length))
+	{
+		return false;
+	}
+
+	if (static_cast<size_t>(end - cursor) < length)
+	{
+		return false;
+	}
+
+	param = std::string_view(cursor, length);
+	cursor += length;
+	return true;
+}
+
+// ----------------------------------------
+// @brief 수신 버퍼의 읽기 위치부터 정의된 순서대로 뷰 필드를 채웁니다.
+// @details 읽기 위치는 옮기지 않으므로, 같은 버퍼를 다시 읽거나 복사 경로로 넘겨도 됩니다.
+// @param recvBuffer 패킷 ID까지 읽은 수신 버퍼
+// @return 모든 필드가 버퍼 안에 들어 있으면 true
+// ----------------------------------------
+template <typename... Args>
+[[nodiscard]]
+bool SetBufferToViewParameters(NetBuffer& recvBuffer, Args&... argList)
+{
+	const int useSize = recvBuffer.GetUseSize();
+	if (useSize < 0)
+	{
+		return false;
+	}
+
+	const char* cursor = recvBuffer.GetReadBufferPtr();
+	const char* end = cursor + useSize;
+	return (ReadViewParameter(cursor, end, argList) && ...);
+}
@@ -0,0 +1,114 @@
+#include "PreCompile.h"
+#include "PathMtuProber.h"
+#include <algorithm>
+
+void PathMtuProber::Configure(const unsigned int inBaseDatagramSize, const unsigned int inMaxDatagramSize)
+{
+	std::scoped_lock scopedLock(lock);
+
+	baseDatagramSize = inBaseDatagramSize;
+	maxDatagramSize = (std::max)(inBaseDatagramSize, inMaxDatagramSize);
+	searchHigh = maxDatagramSize;
+	probeSize = 0;
+	probeAttempts = 0;
+	inFlightProbeSequence = 0;
+	probeSentTime = 0;
+	searchCompletedTime = 0;
+	isProbeInFlight = false;
+	isSearchCompleted = maxDatagramSize <= baseDatagramSize;
+
+	confirmedDatagramSize.store(baseDatagramSize, std::memory_order_relaxed);
+}
+
+unsigned int PathMtuProber::GetDatagramSizeBudget() const noexcept
+{
+	return confirmedDatagramSize.load(std::memory_order_relaxed);
+}
+
+bool PathMtuProber::TryBeginProbe(
+	const unsigned long long now,
+	const unsigned int probeTimeoutMs,
+	OUT PacketSequence& outProbeSequence,
+	OUT unsigned int& outProbeSize)
+{
+	std::scoped_lock scopedLock(lock);
+
+	const unsigned int confirmedSize = confirmedDatagramSize.load(std::memory_order_relaxed);
+	if (isProbeInFlight)
+	{
+		if (now - probeSentTime < probeTimeoutMs)
+		{
+			return false;
+		}
+
+		// 같은 크기가 연속으로 유실되면 경로가 그 크기를 통과시키지 못한다고 판단합니다.
+		isProbeInFlight = false;
+		if (++probeAttempts >= MAX_PROBE_ATTEMPTS)
+		{
+			searchHigh = probeSize - 1;
+			probeSize = 0;
+			probeAttempts = 0;
+		}
+	}
+	else if (isSearchCompleted)
+	{
+		if (maxDatagramSize - confirmedSize < PROBE_SEARCH_GRANULARITY || now - searchCompletedTime < PROBE_RAISE_INTERVAL_MS)
+		{
+			return false;
+		}
+
+		// 경로가 바뀌어 더 큰 MTU를 쓸 수 있게 되었는지 주기적으로 다시 확인합니다.
+		searchHigh = maxDatagramSize;
+		isSearchCompleted = false;
+	}
+
+	if (probeSize == 0)
+	{
+		if (searchHigh <= confirmedSize || searchHigh - confirmedSize < PROBE_SEARCH_GRANULARITY)
+		{
+			isSearchCompleted = true;
+			searchCompletedTime = now;
+			return false;
+		}
+
+		probeSize = confirmedSize + (searchHigh - confirmedSize + 1) / 2;
+	}
+
+	inFlightProbeSequence = PROBE_SEQUENCE_FLAG | ++probeCounter;
+	probeSentTime = now;
+	isProbeInFlight = true;
+
+	outProbeSequence = inFlightProbeSequence;
+	outProbeSize = probeSize;
+	return true;
+}
+
+bool PathMtuProber::OnProbeAcked(const PacketSequence probeSequence, const unsigned int inProbeSize)
+{
+	std::scoped_lock scopedLock(lock);
+	if (not isProbeInFlight || probeSequence != inFlightProbeSequence || inProbeSize != probeSize)
+	{
+		return false;
+	}
+
+	isProbeInFlight = false;
+	probeSize = 0;
+	probeAttempts = 0;
+	if (inProbeSize > confirmedDatagramSize.load(std::memory_order_relaxed))
+	{
+		confirmedDatagramSize.store(inProbeSize, std::memory_order_relaxed);
+	}
+
+	return true;
+}
+
+void PathMtuProber::CancelProbe()
+{
+	std::scoped_lock scopedLock(lock);
+	isProbeInFlight = false;
+}
+
+bool PathMtuProber::IsProbeSequence(const PacketSequence sequence) noexcept
+{
+	return (sequence & PROBE_SEQUENCE_FLAG) != 0;
+}
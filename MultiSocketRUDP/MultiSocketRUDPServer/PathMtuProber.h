@@ -0,0 +1,76 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include "../Common/etc/CoreType.h"
+
+// ----------------------------------------
+// @brief 세션별 데이터그램 크기 예산을 PLPMTUD(RFC 8899) 방식으로 탐색합니다.
+// @details 확인된 크기와 상한 사이를 이진 탐색하며 한 번에 하나의 프로브만 보냅니다.
+//          같은 크기의 프로브가 MAX_PROBE_ATTEMPTS번 연속 응답받지 못하면 그 크기 이상은 통과하지 못한다고 보고 상한을 낮춥니다.
+//          프로브에 응답하지 않는 피어는 설정된 기본 예산에 그대로 머무릅니다.
+// ----------------------------------------
+class PathMtuProber
+{
+public:
+	// ----------------------------------------
+	// @brief 기본 예산과 탐색 상한을 설정하고 탐색 상태를 초기화합니다.
+	// @param inBaseDatagramSize 프로브 없이 항상 사용할 수 있는 데이터그램 크기
+	// @param inMaxDatagramSize 탐색할 최대 데이터그램 크기. 기본 예산 이하이면 탐색하지 않습니다.
+	// ----------------------------------------
+	void Configure(unsigned int inBaseDatagramSize, unsigned int inMaxDatagramSize);
+
+	// ----------------------------------------
+	// @brief 현재 확인된 데이터그램 크기 예산을 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	unsigned int GetDatagramSizeBudget() const noexcept;
+
+	// ----------------------------------------
+	// @brief 지금 보내야 할 프로브가 있으면 시퀀스와 크기를 발급합니다.
+	// @details 응답 대기 중인 프로브가 probeTimeoutMs를 넘기면 실패로 처리한 뒤 다음 프로브를 결정합니다.
+	// @param now 현재 시간 (밀리초)
+	// @param probeTimeoutMs 프로브 응답 대기 시간
+	// @param outProbeSequence 프로브에 사용할 시퀀스. 데이터 시퀀스와 겹치지 않도록 최상위 비트가 설정됩니다.
+	// @param outProbeSize 프로브 데이터그램 전체 크기
+	// @return 프로브를 보내야 하면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool TryBeginProbe(unsigned long long now, unsigned int probeTimeoutMs, OUT PacketSequence& outProbeSequence, OUT unsigned int& outProbeSize);
+
+	// ----------------------------------------
+	// @brief 프로브 응답을 반영합니다.
+	// @param probeSequence 응답에 담긴 프로브 시퀀스
+	// @param probeSize 응답에 담긴 프로브 크기
+	// @return 대기 중인 프로브에 대한 응답이면 true
+	// ----------------------------------------
+	bool OnProbeAcked(PacketSequence probeSequence, unsigned int probeSize);
+
+	// ----------------------------------------
+	// @brief 발급된 프로브를 보내지 못했을 때 대기 상태를 해제합니다.
+	// ----------------------------------------
+	void CancelProbe();
+
+	[[nodiscard]]
+	static bool IsProbeSequence(PacketSequence sequence) noexcept;
+
+public:
+	static constexpr unsigned int MAX_PROBE_ATTEMPTS = 3;
+	static constexpr unsigned int PROBE_SEARCH_GRANULARITY = 16;
+	static constexpr unsigned long long PROBE_RAISE_INTERVAL_MS = 600000;
+	static constexpr PacketSequence PROBE_SEQUENCE_FLAG = 1ull << 63;
+
+private:
+	mutable std::mutex lock;
+	unsigned int baseDatagramSize{ DEFAULT_DATAGRAM_SIZE_BUDGET };
+	unsigned int maxDatagramSize{ DEFAULT_DATAGRAM_SIZE_BUDGET };
+	unsigned int searchHigh{ DEFAULT_DATAGRAM_SIZE_BUDGET };
+	unsigned int probeSize{};
+	unsigned int probeAttempts{};
+	PacketSequence probeCounter{};
+	PacketSequence inFlightProbeSequence{};
+	unsigned long long probeSentTime{};
+	unsigned long long searchCompletedTime{};
+	bool isProbeInFlight{};
+	bool isSearchCompleted{ true };
+	std::atomic_uint confirmedDatagramSize{ DEFAULT_DATAGRAM_SIZE_BUDGET };
+};
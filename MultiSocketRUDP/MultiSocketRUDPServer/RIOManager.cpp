@@ -40,7 +40,7 @@ bool RIOManager::Initialize(const size_t numOfSockets, const size_t inNumOfWorke
 	rioCompletionQueues.reserve(numOfWorkerThreads);
 	const size_t sessionsPerWorker =
 		numOfSockets / numOfWorkerThreads + (numOfSockets % numOfWorkerThreads != 0);
-	constexpr size_t MAX_COMPLETIONS_PER_SESSION = RECV_OUTSTANDING_COUNT + 1;
+	constexpr size_t MAX_COMPLETIONS_PER_SESSION = RECV_OUTSTANDING_COUNT + MAX_DATAGRAM_BATCH_SIZE;
 	if (sessionsPerWorker > (std::numeric_limits<ULONG>::max)() / MAX_COMPLETIONS_PER_SESSION)
 	{
 		LOG_ERROR("RIO completion queue size exceeds ULONG capacity");
@@ -56,6 +56,69 @@ bool MultiSocketRUDPCore::ReadOptionFile(const std::wstring& coreOptionFilePath,
 		return false;
 	}
 
+	if (g_Paser.GetValue_Int(buffer, L"CORE", L"DATAGRAM_SIZE_BUDGET", reinterpret_cast<int*>(&datagramSizeBudget)) == false)
+	{
+		datagramSizeBudget = DEFAULT_DATAGRAM_SIZE_BUDGET;
+	}
+	if (g_Paser.GetValue_Int(buffer, L"CORE", L"MAX_PROBE_DATAGRAM_SIZE", reinterpret_cast<int*>(&maxProbeDatagramSize)) == false)
+	{
+		maxProbeDatagramSize = datagramSizeBudget;
+	}
+	if (datagramSizeBudget < MIN_DATAGRAM_SIZE_BUDGET || datagramSizeBudget > maxProbeDatagramSize || maxProbeDatagramSize > MAX_DATAGRAM_SIZE_BUDGET)
+	{
+		return false;
+	}
+
+	int useSendPacingOption = 0;
+	if (g_Paser.GetValue_Int(buffer, L"CORE", L"USE_SEND_PACING", &useSendPacingOption) == false)
+	{
+		useSendPacingOption = 0;
+	}
+	useSendPacing = useSendPacingOption != 0;
+
+	int useZeroCopyRecvOption = 0;
+	if (g_Paser.GetValue_Int(buffer, L"CORE", L"USE_ZERO_COPY_RECV", &useZeroCopyRecvOption) == false)
+	{
+		useZeroCopyRecvOption = 0;
+	}
+	useZeroCopyRecv = useZeroCopyRecvOption != 0;
+
+	if (g_Paser.GetValue_Byte(buffer, L"CORE", L"DELAYED_ACK_PACKET_COUNT", &delayedAckPacketCount) == false)
+	{
+		delayedAckPacketCount = 1;
+	}
+	if (g_Paser.GetValue_Int(buffer, L"CORE", L"DELAYED_ACK_TIMEOUT_MS", reinterpret_cast<int*>(&delayedAckTimeoutMs)) == false)
+	{
+		delayedAckTimeoutMs = 0;
+	}
+	// 지연 ACK가 최소 RTO를 넘기면 피어가 응답을 기다리다 불필요한 재전송을 하게 됩니다.
+	if (delayedAckPacketCount == 0 || delayedAckTimeoutMs >= minRetransmissionMs)
+	{
+		return false;
+	}
+
+	WCHAR congestionControlName[64];
+	if (g_Paser.GetValue_String(buffer, L"CORE", L"CONGESTION_CONTROL", congestionControlName) == false)
+	{
+		congestionControlType = CONGESTION_CONTROL_TYPE::NEW_RENO;
+	}
+	else if (wcscmp(congestionControlName, L"NEW_RENO") == 0)
+	{
+		congestionControlType = CONGESTION_CONTROL_TYPE::NEW_RENO;
+	}
+	else if (wcscmp(congestionControlName, L"CUBIC") == 0)
+	{
+		congestionControlType = CONGESTION_CONTROL_TYPE::CUBIC;
+	}
+	else if (wcscmp(congestionControlName, L"BBR_LITE") == 0)
+	{
+		congestionControlType = CONGESTION_CONTROL_TYPE::BBR_LITE;
+	}
+	else
+	{
+		return false;
+	}
+
 	if (g_Paser.GetValue_Int(buffer, L"CORE", L"SIMULATED_PACKET_LOSS_PERCENT", reinterpret_cast<int*>(&simulatedPacketLossPercent)) == false)
 	{
 		simulatedPacketLossPercent = 0;
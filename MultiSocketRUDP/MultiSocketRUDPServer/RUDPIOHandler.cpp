@@ -11,6 +11,18 @@
 #include "SendPacketInfo.h"
 #include "../Common/etc/UtilFunc.h"
 
+namespace
+{
+	// 지연 커밋 구간에서 RIO_MSG_DEFER로 게시한 세션들입니다. 구간이 끝날 때 세션마다 한 번씩 커밋합니다.
+	struct DeferredSendCommitBatch
+	{
+		bool isActive{};
+		std::vector<RUDPSession*> sessions;
+	};
+
+	thread_local DeferredSendCommitBatch deferredSendCommitBatch;
+}
+
 RUDPIOHandler::RUDPIOHandler(IRIOManager& inRioManager
 	, ISessionDelegate& inSessionDelegate
 	, CTLSMemoryPool<IOContext>& contextPool
@@ -18,12 +30,14 @@ RUDPIOHandler::RUDPIOHandler(IRIOManager& inRioManager
 	, const BYTE inMaxHoldingPacketQueueSize
 	, const unsigned int inRetransmissionMs
 	, const unsigned int inSimulatedPacketLossPercent
-	, const int inSimulatedPacketLossSeed)
+	, const int inSimulatedPacketLossSeed
+	, const bool inUseZeroCopyRecv)
 	: rioManager(inRioManager)
 	, sessionDelegate(inSessionDelegate)
 	, contextPool(contextPool)
 	, retransmissionSchedulers(retransmissionSchedulers)
 	, retransmissionMs(inRetransmissionMs)
+	, useZeroCopyRecv(inUseZeroCopyRecv)
 {
 	if (inSimulatedPacketLossPercent > 0)
 	{
@@ -98,8 +112,14 @@ bool RUDPIOHandler::HandleFailedCompletion(IOContext* context, RUDPSession& sess
 	}
 	else if (context->ioType == RIO_OPERATION_TYPE::OP_SEND)
 	{
-		sessionDelegate.GetSendIOMode(session).store(IO_MODE::IO_NONE_SENDING, std::memory_order_release);
+		std::ignore = CompleteSendDatagrams(session, 1);
 		contextPool.Free(context);
+
+		// DF가 설정된 소켓에서 경로 MTU보다 큰 데이터그램은 거부되므로, 유실로 보고 재전송에 맡깁니다.
+		if (status == WSAEMSGSIZE)
+		{
+			return true;
+		}
 	}
 	else
 	{
@@ -206,6 +226,7 @@ bool RUDPIOHandler::DoSend(RUDPSession& session, const ThreadIdType threadId) co
 
 	const auto releaseIOSending = [&]()
 	{
+		sessionDelegate.ReleaseSendBuffer(session);
 		sessionDelegate.GetSendIOMode(session).store(IO_MODE::IO_NONE_SENDING);
 	};
 
@@ -234,26 +255,88 @@ bool RUDPIOHandler::DoSend(RUDPSession& session, const ThreadIdType threadId) co
 			break;
 		}
 
-		const auto [succeeded, sendContext] = MakeSendContext(session, threadId);
-		if (sendContext == nullptr)
+		// 패스 동안만 worker 슬랩의 송신 버퍼를 빌리고, 패스가 끝나면 돌려줍니다.
+		if (not sessionDelegate.AcquireSendBuffer(session))
 		{
+			LOG_ERROR(std::format("AcquireSendBuffer() failed. sessionId {}", session.GetSessionId()));
 			releaseIOSending();
-			return succeeded;
+			return false;
 		}
 
-		if (lossSimulator != nullptr && lossSimulator->ShouldDropSendingDatagram())
+		SendDatagramPacker packer(sessionDelegate.GetDatagramSizeBudget(session));
+		if (not MakeSendStream(session, threadId, packer))
+		{
+			releaseIOSending();
+			return false;
+		}
+
+		if (packer.GetDatagramCount() == 0)
 		{
-			contextPool.Free(sendContext);
 			releaseIOSending();
+			// 송신 큐는 lock 없이 채워지므로, 꺼내는 동안 들어와 DoSend의 CAS에 실패한 패킷이 남아 있을 수 있습니다.
+			if (sessionDelegate.GetSendPacketInfoQueueSize(session) != 0)
+			{
+				continue;
+			}
+
+			return true;
+		}
+
+		bool isSendModeReleased = false;
+		if (not PostSendDatagrams(session, packer, isSendModeReleased))
+		{
+			return false;
+		}
+
+		if (isSendModeReleased)
+		{
 			continue;
 		}
 
-		return TryRIOSend(session, sendContext);
+		return true;
 	}
 
 	return true;
 }
 
+void RUDPIOHandler::BeginDeferredSendCommit() const
+{
+	deferredSendCommitBatch.isActive = true;
+}
+
+void RUDPIOHandler::CommitDeferredSends() const
+{
+	deferredSendCommitBatch.isActive = false;
+	for (RUDPSession* session : deferredSendCommitBatch.sessions)
+	{
+		bool isCommitted = true;
+		{
+			std::shared_lock lock(sessionDelegate.GetSocketMutex(*session));
+			if (sessionDelegate.GetSocket(*session) != INVALID_SOCKET)
+			{
+				isCommitted = rioManager.RIOSendEx(sessionDelegate.GetSendRIORQ(*session)
+					, nullptr
+					, 0
+					, nullptr
+					, nullptr
+					, nullptr
+					, nullptr
+					, RIO_MSG_COMMIT_ONLY
+					, nullptr);
+			}
+		}
+
+		if (not isCommitted)
+		{
+			LOG_ERROR(std::format("RIOSendEx() commit failed with error code {}. sessionId {}", WSAGetLastError(), session->GetSessionId()));
+			session->DoDisconnect(DISCONNECT_REASON::BY_ERROR);
+		}
+		sessionDelegate.GetDeferredSendCommitPending(*session).store(false, std::memory_order_relaxed);
+		session->CompleteIOCompletion();
+	}
+	deferredSendCommitBatch.sessions.clear();
+}
+
 bool RUDPIOHandler::RecvIOCompleted(OUT IOContext* contextResult, const ULONG transferred, const BYTE threadId) const
 {
 	if (contextResult == nullptr || contextResult->session == nullptr)
@@ -262,39 +345,55 @@ bool RUDPIOHandler::RecvIOCompleted(OUT IOContext* contextResult, const ULONG tr
 		return false;
 	}
 
+	// 완료 빈도를 게시 깊이에 반영한 뒤 슬롯을 돌려줘야, 줄어든 깊이를 넘는 슬롯이 바로 풀로 돌아갑니다.
+	contextResult->ownerRecvBuffer->depthController.OnRecvCompleted(GetTickCount64());
+
 	if (lossSimulator != nullptr && lossSimulator->ShouldDropReceivedDatagram())
 	{
 		ReleaseRecvContext(contextResult);
 		return DoRecv(*contextResult->session);
 	}
-	
+
+	// 다른 수신이 충분히 게시되어 있을 때만 슬롯을 빌려주고, 아니면 복사해서 슬롯을 바로 다시 게시합니다.
+	const bool borrowRecvSlot = useZeroCopyRecv && contextResult->ownerRecvBuffer->TryLendRecvSlot(contextResult);
+	if (not EnqueueRecvPacket(contextResult, contextResult->recvDataBuffer, transferred, threadId, borrowRecvSlot))
+	{
+		ReleaseRecvContext(contextResult);
+		return false;
+	}
+
+	ReleaseRecvContext(contextResult);
+	return DoRecv(*contextResult->session);
+}
+
+bool RUDPIOHandler::EnqueueRecvPacket(IOContext* contextResult, char* packet, const unsigned int packetSize, const BYTE threadId, const bool borrowRecvSlot) const
+{
+	if (borrowRecvSlot)
+	{
+		return MultiSocketRUDPCoreFunctionDelegate::EnqueueBorrowedContextResult(contextResult, packet, packetSize, threadId);
+	}
+
 	const auto buffer = NetBuffer::Alloc();
 	if (buffer == nullptr)
 	{
 		LOG_ERROR("RecvIOCompleted NetBuffer::Allock() failed");
-		ReleaseRecvContext(contextResult);
-		
 		return false;
 	}
 	
-	if (memcpy_s(buffer->m_pSerializeBuffer, RECV_BUFFER_SIZE, contextResult->recvDataBuffer, transferred) != 0)
+	if (memcpy_s(buffer->m_pSerializeBuffer, RECV_BUFFER_SIZE, packet, packetSize) != 0)
 	{
 		NetBuffer::Free(buffer);
-		ReleaseRecvContext(contextResult);
-
 		return false;
 	}
-	buffer->m_iWrite = static_cast<WORD>(transferred);
+	buffer->m_iWrite = static_cast<WORD>(packetSize);
 
 	if (not MultiSocketRUDPCoreFunctionDelegate::EnqueueContextResult(contextResult, buffer, threadId))
 	{
 		NetBuffer::Free(buffer);
-		ReleaseRecvContext(contextResult);
 		return false;
 	}
 
-	ReleaseRecvContext(contextResult);
-	return DoRecv(*contextResult->session);
+	return true;
 }
 
 void RUDPIOHandler::ReleaseRecvContext(IOContext* context) const
@@ -303,7 +402,7 @@ void RUDPIOHandler::ReleaseRecvContext(IOContext* context) const
 	assert(context->ownerRecvBuffer != nullptr);
 
 	RecvBuffer* recvBuffer = context->ownerRecvBuffer;
-	recvBuffer->ReleaseRecvContext(context);
+	recvBuffer->ReleaseRecvSlot(context);
 	recvBuffer->CompleteRecvIo();
 }
 
@@ -315,7 +414,12 @@ bool RUDPIOHandler::SendIOCompleted(IOContext* context, const BYTE threadId) con
 		return false;
 	}
 
-	sessionDelegate.GetSendIOMode(*context->session).store(IO_MODE::IO_NONE_SENDING);
+	if (not CompleteSendDatagrams(*context->session, 1))
+	{
+		contextPool.Free(context);
+		return true;
+	}
+
 	if (context->session->IsReleasing())
 	{
 		contextPool.Free(context);
@@ -327,25 +431,47 @@ bool RUDPIOHandler::SendIOCompleted(IOContext* context, const BYTE threadId) con
 	return result;
 }
 
-bool RUDPIOHandler::TryRIOSend(RUDPSession& session, IOContext* context) const
+bool RUDPIOHandler::PostSendDatagrams(RUDPSession& session, const SendDatagramPacker& packer, bool& outIsSendModeReleased) const
 {
-	const auto releaseIOSending = [&]()
+	const unsigned int datagramCount = packer.GetDatagramCount();
+	sessionDelegate.GetSendDatagramsInFlight(session).store(datagramCount, std::memory_order_release);
+
+	std::shared_lock lock(sessionDelegate.GetSocketMutex(session));
+	if (sessionDelegate.GetSocket(session) == INVALID_SOCKET)
 	{
-		sessionDelegate.GetSendIOMode(session).store(IO_MODE::IO_NONE_SENDING);
-	};
+		outIsSendModeReleased = CompleteSendDatagrams(session, datagramCount);
+		return false;
+	}
 
-	context->session = &session;
-	context->ownerSessionGeneration = session.GetSessionGeneration();
+	const ULONG sendFlags = deferredSendCommitBatch.isActive ? RIO_MSG_DEFER : 0;
+	bool hasDeferredSend = false;
+	// 미뤄 둔 요청이 커밋될 때까지 세션이 정리되지 않도록 drain barrier에 등록해 둡니다.
+	auto deferGuard = Util::MakeScopeExit([this, &session, &hasDeferredSend]()
+		{
+			if (hasDeferredSend && not sessionDelegate.GetDeferredSendCommitPending(session).exchange(true, std::memory_order_relaxed))
+			{
+				session.BeginIOCompletion();
+				deferredSendCommitBatch.sessions.push_back(&session);
+			}
+		});
 
+	for (unsigned int datagramIndex = 0; datagramIndex < datagramCount; ++datagramIndex)
 	{
-		std::shared_lock lock(sessionDelegate.GetSocketMutex(session));
-		if (sessionDelegate.GetSocket(session) == INVALID_SOCKET)
+		const auto& datagram = packer.GetDatagram(datagramIndex);
+		IOContext* context = MakeSendContext(session, datagram);
+		if (context == nullptr)
 		{
-			releaseIOSending();
-			contextPool.Free(context);
+			outIsSendModeReleased = CompleteSendDatagrams(session, datagramCount - datagramIndex);
 			return false;
 		}
 
+		if (lossSimulator != nullptr && lossSimulator->ShouldDropSendingDatagram())
+		{
+			contextPool.Free(context);
+			outIsSendModeReleased = CompleteSendDatagrams(session, 1);
+			continue;
+		}
+
 		if (not rioManager.RIOSendEx(sessionDelegate.GetSendRIORQ(session)
 			, context
 			, 1
@@ -353,101 +479,99 @@ bool RUDPIOHandler::TryRIOSend(RUDPSession& session, IOContext* context) const
 			, &context->clientAddrRIOBuffer
 			, nullptr
 			, nullptr
-			, 0
+			, sendFlags
 			, context))
 		{
 			LOG_ERROR(std::format("RIOSendEx() failed with error code {}", WSAGetLastError()));
-			releaseIOSending();
 			contextPool.Free(context);
+			outIsSendModeReleased = CompleteSendDatagrams(session, datagramCount - datagramIndex);
 			return false;
 		}
+		hasDeferredSend |= sendFlags != 0;
 	}
 
 	return true;
 }
 
-std::pair<bool, IOContext*> RUDPIOHandler::MakeSendContext(RUDPSession& session, const ThreadIdType threadId) const
+bool RUDPIOHandler::CompleteSendDatagrams(RUDPSession& session, const unsigned int count) const
+{
+	auto& sendDatagramsInFlight = sessionDelegate.GetSendDatagramsInFlight(session);
+	unsigned int inFlight = sendDatagramsInFlight.load(std::memory_order_acquire);
+	unsigned int remaining = 0;
+	do
+	{
+		remaining = inFlight > count ? inFlight - count : 0;
+	} while (not sendDatagramsInFlight.compare_exchange_weak(inFlight, remaining, std::memory_order_acq_rel));
+
+	if (remaining != 0)
+	{
+		return false;
+	}
+
+	// 패스의 마지막 송신까지 끝났으므로 커널이 더 이상 송신 버퍼를 읽지 않습니다.
+	sessionDelegate.ReleaseSendBuffer(session);
+	sessionDelegate.GetSendIOMode(session).store(IO_MODE::IO_NONE_SENDING);
+	return true;
+}
+
+IOContext* RUDPIOHandler::MakeSendContext(RUDPSession& session, const SendDatagramPacker::Datagram& datagram) const
 {
 	IOContext* context = contextPool.Alloc();
 	if (context == nullptr)
 	{
 		LOG_ERROR("MakeSendContext contextPool.Alloc() failed");
-		return { false, nullptr };
+		return nullptr;
 	}
 
 	context->InitContext(session.GetSessionId(), RIO_OPERATION_TYPE::OP_SEND);
+	context->session = &session;
+	context->ownerSessionGeneration = session.GetSessionGeneration();
 	context->BufferId = sessionDelegate.GetSendBufferId(session);
-	context->Offset = 0;
-	const auto [succeeded, length] = MakeSendStream(session, threadId);
-	if (not succeeded)
-	{
-		contextPool.Free(context);
-		return { false, nullptr };
-	}
-
-	if (length == 0)
-	{
-		contextPool.Free(context);
-		return { true, nullptr };
-	}
-	context->Length = length;
+	context->Offset = sessionDelegate.GetSendBufferOffset(session) + datagram.offset;
+	context->Length = datagram.length;
 
+	// 주소는 연결 시점에 세션의 등록된 주소 슬롯에 기록되어 있으므로 가리키기만 합니다.
+	context->clientAddrRIOBuffer = sessionDelegate.GetClientAddressRIOBuffer(session);
 	if (context->clientAddrRIOBuffer.BufferId == RIO_INVALID_BUFFERID)
 	{
-		if (context->clientAddrRIOBuffer.BufferId = rioManager.RegisterRIOBuffer(context->clientAddrBuffer, sizeof(SOCKADDR_INET)); context->clientAddrRIOBuffer.BufferId == RIO_INVALID_BUFFERID)
-		{
-			LOG_ERROR("MakeSendContext clientAddrBufferId is RIO_INVALID_BUFFERID");
-			contextPool.Free(context);
-			return { false, nullptr };
-		}
-	}
-
-	if (memcpy_s(context->clientAddrBuffer, sizeof(context->clientAddrBuffer), &session.GetSocketAddressInetRef(), sizeof(SOCKADDR_INET)) != NOERROR)
-	{
-		LOG_ERROR("MakeSendContext memcpy_s failed");
+		LOG_ERROR("MakeSendContext clientAddrBufferId is RIO_INVALID_BUFFERID");
 		contextPool.Free(context);
-		return { false, nullptr };
+		return nullptr;
 	}
 
-	context->clientAddrRIOBuffer.Length = sizeof(context->clientAddrBuffer);
-	context->clientAddrRIOBuffer.Offset = 0;
-
-	return { true, context };
+	return context;
 }
 
-std::pair<bool, unsigned int> RUDPIOHandler::MakeSendStream(RUDPSession& session, const ThreadIdType threadId) const
+bool RUDPIOHandler::MakeSendStream(RUDPSession& session, const ThreadIdType threadId, SendDatagramPacker& packer) const
 {
-	auto& packetSequenceSet = sessionDelegate.GetCachedSequenceSet(session);
-	packetSequenceSet.clear();
+	auto& packetSequenceSet = sessionDelegate.GetSendSequenceBitmap(session);
+	packetSequenceSet.Clear();
 	
-	unsigned int totalSendSize = 0;
 	const size_t bufferCount = sessionDelegate.GetSendPacketInfoQueueSize(session);
-	if (ReservedSendPacketInfoToStream(session, packetSequenceSet, totalSendSize, threadId) == SEND_PACKET_INFO_TO_STREAM_RETURN::OCCURED_ERROR)
+	if (ReservedSendPacketInfoToStream(session, packetSequenceSet, packer, threadId) == SEND_PACKET_INFO_TO_STREAM_RETURN::OCCURED_ERROR)
 	{
-		return { false, 0 };
+		return false;
 	}
 
 	for (size_t i = 0; i < bufferCount; ++i)
 	{
-		switch (StoredSendPacketInfoToStream(session, packetSequenceSet, totalSendSize, threadId))
+		const auto result = StoredSendPacketInfoToStream(session, packetSequenceSet, packer, threadId);
+		if (result == SEND_PACKET_INFO_TO_STREAM_RETURN::OCCURED_ERROR)
 		{
-		case SEND_PACKET_INFO_TO_STREAM_RETURN::OCCURED_ERROR:
-		{
-			return { false, 0 };
+			return false;
 		}
-		case SEND_PACKET_INFO_TO_STREAM_RETURN::STREAM_IS_FULL:
+
+		if (result == SEND_PACKET_INFO_TO_STREAM_RETURN::STREAM_IS_FULL)
 		{
-			return { true, totalSendSize };
-		}
-		default:
 			break;
 		}
 	}
 
-	return { true, totalSendSize };
+	packer.Seal();
+	return true;
 }
 
-SEND_PACKET_INFO_TO_STREAM_RETURN RUDPIOHandler::ReservedSendPacketInfoToStream(RUDPSession& session, std::set<MultiSocketRUDP::PacketSequenceSetKey>& packetSequenceSet, unsigned int& totalSendSize, ThreadIdType threadId) const
+SEND_PACKET_INFO_TO_STREAM_RETURN RUDPIOHandler::ReservedSendPacketInfoToStream(RUDPSession& session, SendSequenceBitmap& packetSequenceSet, SendDatagramPacker& packer, ThreadIdType threadId) const
 {
 	SendPacketInfo* sendPacketInfo = sessionDelegate.TakeReservedSendPacketInfo(session);
 	if (sendPacketInfo == nullptr)
@@ -470,18 +594,16 @@ SEND_PACKET_INFO_TO_STREAM_RETURN RUDPIOHandler::ReservedSendPacketInfoToStream(
 		return SEND_PACKET_INFO_TO_STREAM_RETURN::IS_ERASED_PACKET;
 	}
 
-	char* bufferPositionPointer = sessionDelegate.GetRIOSendBuffer(session);
-	memcpy_s(bufferPositionPointer, MAX_SEND_BUFFER_SIZE, sendPacketInfo->buffer->GetBufferPtr(), useSize);
-	packetSequenceSet.insert(MultiSocketRUDP::PacketSequenceSetKey{ sendPacketInfo->isReplyType, sendPacketInfo->sendPacketSequence });
-
-	totalSendSize += static_cast<int>(useSize);
+	const unsigned int writeOffset = packer.Append(useSize);
+	memcpy_s(&sessionDelegate.GetRIOSendBuffer(session)[writeOffset], MAX_SEND_BUFFER_SIZE - writeOffset, sendPacketInfo->buffer->GetBufferPtr(), useSize);
+	packetSequenceSet.Insert(sendPacketInfo->isReplyType, sendPacketInfo->sendPacketSequence);
 
 	SendPacketInfo::Free(sendPacketInfo);
 
 	return SEND_PACKET_INFO_TO_STREAM_RETURN::SUCCESS;
 }
 
-SEND_PACKET_INFO_TO_STREAM_RETURN RUDPIOHandler::StoredSendPacketInfoToStream(RUDPSession& session, std::set<MultiSocketRUDP::PacketSequenceSetKey>& packetSequenceSet, unsigned int& totalSendSize, ThreadIdType threadId) const
+SEND_PACKET_INFO_TO_STREAM_RETURN RUDPIOHandler::StoredSendPacketInfoToStream(RUDPSession& session, SendSequenceBitmap& packetSequenceSet, SendDatagramPacker& packer, ThreadIdType threadId) const
 {
 	SendPacketInfo* sendPacketInfo = sessionDelegate.TryGetFrontAndPop(session);
 	if (sendPacketInfo == nullptr)
@@ -489,8 +611,7 @@ SEND_PACKET_INFO_TO_STREAM_RETURN RUDPIOHandler::StoredSendPacketInfoToStream(RU
 		return SEND_PACKET_INFO_TO_STREAM_RETURN::SUCCESS;
 	}
 
-	const MultiSocketRUDP::PacketSequenceSetKey key{ sendPacketInfo->isReplyType, sendPacketInfo->sendPacketSequence };
-	if (packetSequenceSet.contains(key) == true)
+	if (packetSequenceSet.Contains(sendPacketInfo->isReplyType, sendPacketInfo->sendPacketSequence))
 	{
 		SendPacketInfo::Free(sendPacketInfo);
 		return SEND_PACKET_INFO_TO_STREAM_RETURN::IS_SENT;
@@ -505,23 +626,22 @@ SEND_PACKET_INFO_TO_STREAM_RETURN RUDPIOHandler::StoredSendPacketInfoToStream(RU
 		return SEND_PACKET_INFO_TO_STREAM_RETURN::OCCURED_ERROR;
 	}
 
-	const unsigned int beforeSendSize = totalSendSize;
-	if (beforeSendSize + useSize > MAX_SEND_BUFFER_SIZE)
+	if (not packer.CanAppend(useSize))
 	{
 		sessionDelegate.SetReservedSendPacketInfo(session, sendPacketInfo);
 		return SEND_PACKET_INFO_TO_STREAM_RETURN::STREAM_IS_FULL;
 	}
 
-	totalSendSize += useSize;
 	if (not RefreshRetransmissionSendPacketInfo(sendPacketInfo, threadId))
 	{
 		SendPacketInfo::Free(sendPacketInfo);
 		return SEND_PACKET_INFO_TO_STREAM_RETURN::IS_ERASED_PACKET;
 	}
 
-	packetSequenceSet.insert(key);
-	memcpy_s(&sessionDelegate.GetRIOSendBuffer(session)[beforeSendSize]
-		, MAX_SEND_BUFFER_SIZE - beforeSendSize
+	packetSequenceSet.Insert(sendPacketInfo->isReplyType, sendPacketInfo->sendPacketSequence);
+	const unsigned int writeOffset = packer.Append(useSize);
+	memcpy_s(&sessionDelegate.GetRIOSendBuffer(session)[writeOffset]
+		, MAX_SEND_BUFFER_SIZE - writeOffset
 		, sendPacketInfo->buffer->GetBufferPtr()
 		, useSize);
 
@@ -1,17 +1,14 @@
 ﻿#pragma once
 #include "IIOHandler.h"
 #include "RetransmissionScheduler.h"
+#include <array>
 #include <vector>
 #include <mutex>
 #include <memory>
 #include <set>
 #include <random>
 
-namespace MultiSocketRUDP
-{
-	struct PacketSequenceSetKey;
-}
-
+class SendSequenceBitmap;
 class IRIOManager;
 class ISessionDelegate;
 class ICore;
@@ -61,6 +58,100 @@ private:
 	std::mutex sendLock;
 };
 
+// ----------------------------------------
+// @brief 한 번의 송신 패스에서 송신 버퍼에 쌓는 패킷들을 데이터그램 단위로 나눕니다.
+// @details 각 데이터그램은 패킷 경계에서 잘리며 datagramSizeBudget을 넘지 않습니다.
+//          예산보다 큰 단일 패킷은 단독으로 하나의 데이터그램이 되고,
+//          한 패스의 데이터그램 수는 MAX_DATAGRAM_BATCH_SIZE를 넘지 않습니다.
+// ----------------------------------------
+class SendDatagramPacker
+{
+public:
+	struct Datagram
+	{
+		unsigned int offset{};
+		unsigned int length{};
+	};
+
+public:
+	explicit SendDatagramPacker(const unsigned int inDatagramSizeBudget)
+		: datagramSizeBudget(inDatagramSizeBudget)
+	{
+	}
+
+	// ----------------------------------------
+	// @brief packetSize 크기의 패킷을 송신 버퍼와 데이터그램 수 제한 안에서 추가할 수 있는지 확인합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	bool CanAppend(const unsigned int packetSize) const
+	{
+		if (totalSendSize + packetSize > MAX_SEND_BUFFER_SIZE)
+		{
+			return false;
+		}
+
+		return not NeedNewDatagram(packetSize) || datagramCount + 1 < MAX_DATAGRAM_BATCH_SIZE;
+	}
+
+	// ----------------------------------------
+	// @brief 패킷을 추가하고 송신 버퍼에서 기록할 위치를 반환합니다. CanAppend가 true인 경우에만 호출해야 합니다.
+	// @param packetSize 추가할 패킷 크기
+	// @return 송신 버퍼 내 기록 오프셋
+	// ----------------------------------------
+	unsigned int Append(const unsigned int packetSize)
+	{
+		if (NeedNewDatagram(packetSize))
+		{
+			CloseOpenDatagram();
+		}
+
+		const unsigned int writeOffset = totalSendSize;
+		totalSendSize += packetSize;
+		return writeOffset;
+	}
+
+	// ----------------------------------------
+	// @brief 마지막으로 쌓던 데이터그램을 닫습니다. 송신 전에 한 번 호출합니다.
+	// ----------------------------------------
+	void Seal()
+	{
+		CloseOpenDatagram();
+	}
+
+	[[nodiscard]]
+	unsigned int GetDatagramCount() const { return datagramCount; }
+	[[nodiscard]]
+	const Datagram& GetDatagram(const unsigned int index) const { return datagrams[index]; }
+	[[nodiscard]]
+	unsigned int GetTotalSendSize() const { return totalSendSize; }
+
+private:
+	[[nodiscard]]
+	bool NeedNewDatagram(const unsigned int packetSize) const
+	{
+		const unsigned int openDatagramLength = totalSendSize - openDatagramOffset;
+		return openDatagramLength > 0 && openDatagramLength + packetSize > datagramSizeBudget;
+	}
+
+	void CloseOpenDatagram()
+	{
+		if (totalSendSize == openDatagramOffset)
+		{
+			return;
+		}
+
+		datagrams[datagramCount++] = { openDatagramOffset, totalSendSize - openDatagramOffset };
+		openDatagramOffset = totalSendSize;
+	}
+
+private:
+	std::array<Datagram, MAX_DATAGRAM_BATCH_SIZE> datagrams{};
+	unsigned int datagramCount{};
+	unsigned int totalSendSize{};
+	unsigned int openDatagramOffset{};
+	unsigned int datagramSizeBudget{};
+};
+
 // RUDPIOHandler 클래스는 RIO(Registered I/O) 기반의 네트워크 통신을 처리하는 핸들러입니다.
 // 세션 관리, 패킷 송수신, 재전송 처리 등 RUDP 프로토콜의 핵심 I/O 로직을 담당합니다.
 class RUDPIOHandler : public IIOHandler
@@ -74,6 +165,7 @@ public:
 		, unsigned int inRetransmissionMs
 		, unsigned int inSimulatedPacketLossPercent = 0
 		, int inSimulatedPacketLossSeed = 0
+		, bool inUseZeroCopyRecv = false
 	);
 	~RUDPIOHandler() override = default;
 
@@ -104,6 +196,18 @@ public:
 	[[nodiscard]]
 	bool DoSend(OUT RUDPSession& session, ThreadIdType threadId) const override;
 
+	// ----------------------------------------
+	// @brief 호출한 스레드에서 CommitDeferredSends까지의 송신을 RIO_MSG_DEFER로 게시하도록 합니다.
+	// @details worker 반복 하나 동안 여러 세션이 보낸 데이터그램을 모아 반복이 끝날 때 커밋하기 위해 사용합니다.
+	//          이 구간 밖에서 게시되는 송신은 기존처럼 즉시 커밋됩니다.
+	// ----------------------------------------
+	void BeginDeferredSendCommit() const;
+	// ----------------------------------------
+	// @brief 호출한 스레드가 미뤄 둔 송신을 세션(request queue)마다 RIO_MSG_COMMIT_ONLY 한 번으로 커밋하고 지연 구간을 끝냅니다.
+	// @details 커밋에 실패한 세션은 미뤄 둔 요청이 완료되지 않으므로 오류 종료합니다.
+	// ----------------------------------------
+	void CommitDeferredSends() const;
+
 private:
 	// ----------------------------------------
 	// @brief 재사용된 세션에서 도착한 이전 generation 완료를 현재 세션 상태에 영향 없이 정리합니다.
@@ -128,24 +232,49 @@ private:
 
 	[[nodiscard]]
 	bool RecvIOCompleted(OUT IOContext* contextResult, ULONG transferred, BYTE threadId) const;
+	// ----------------------------------------
+	// @brief 수신 버퍼의 패킷 하나를 recv logic 스레드에 넘깁니다.
+	// @param borrowRecvSlot true면 슬롯을 가리키는 뷰로 넘기고, false면 NetBuffer로 복사해 넘깁니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	bool EnqueueRecvPacket(IOContext* contextResult, char* packet, unsigned int packetSize, BYTE threadId, bool borrowRecvSlot) const;
 	[[nodiscard]]
 	bool SendIOCompleted(IOContext* context, BYTE threadId) const;
 	// ----------------------------------------
 	// @brief 컨텍스트를 원래 RecvBuffer의 자유 큐에 반환하고 수신 I/O 추적 수를 감소시킵니다.
+	// @details logic worker에 빌려준 슬롯이면 완료가 들고 있던 참조만 놓고, 마지막 뷰가 끝날 때 자유 큐로 돌아갑니다.
 	// ----------------------------------------
 	void ReleaseRecvContext(IOContext* context) const;
 
+	// ----------------------------------------
+	// @brief 데이터그램 하나를 보낼 송신 컨텍스트를 만듭니다.
+	// @param datagram 송신 버퍼 내 데이터그램 위치
+	// @return 생성된 컨텍스트, 실패하면 nullptr
+	// ----------------------------------------
 	[[nodiscard]]
-	bool TryRIOSend(OUT RUDPSession& session, IOContext* context) const;
+	IOContext* MakeSendContext(OUT RUDPSession& session, const SendDatagramPacker::Datagram& datagram) const;
+	// ----------------------------------------
+	// @brief 송신 패스의 데이터그램마다 RIOSendEx를 게시합니다.
+	// @details 게시 전에 송신 중 데이터그램 수를 전체 개수로 설정하고, 게시하지 못한 만큼은 즉시 완료 처리합니다.
+	//          지연 커밋 구간이면 RIOSendEx를 RIO_MSG_DEFER로 게시하고 세션을 커밋 대상으로 기록합니다.
+	// @param outIsSendModeReleased 이 호출에서 마지막 데이터그램까지 완료 처리되어 IO_MODE가 해제되었으면 true
+	// @return 모든 데이터그램을 게시(또는 손실 시뮬레이션으로 폐기)했으면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool PostSendDatagrams(OUT RUDPSession& session, const SendDatagramPacker& packer, OUT bool& outIsSendModeReleased) const;
+	// ----------------------------------------
+	// @brief 송신 중 데이터그램 수를 count만큼 줄이고, 0이 되면 송신 버퍼를 돌려주고 IO_MODE를 IO_NONE_SENDING으로 되돌립니다.
+	// @return 이 호출로 송신 패스가 끝났으면 true
+	// ----------------------------------------
 	[[nodiscard]]
-	std::pair<bool, IOContext*> MakeSendContext(OUT RUDPSession& session, ThreadIdType threadId) const;
+	bool CompleteSendDatagrams(OUT RUDPSession& session, unsigned int count) const;
 	[[nodiscard]]
-	std::pair<bool, unsigned int> MakeSendStream(OUT RUDPSession& session, ThreadIdType threadId) const;
+	bool MakeSendStream(OUT RUDPSession& session, ThreadIdType threadId, OUT SendDatagramPacker& packer) const;
 
 	[[nodiscard]]
-	SEND_PACKET_INFO_TO_STREAM_RETURN ReservedSendPacketInfoToStream(OUT RUDPSession& session, OUT std::set<MultiSocketRUDP::PacketSequenceSetKey>& packetSequenceSet, OUT unsigned int& totalSendSize, ThreadIdType threadId) const;
+	SEND_PACKET_INFO_TO_STREAM_RETURN ReservedSendPacketInfoToStream(OUT RUDPSession& session, OUT SendSequenceBitmap& packetSequenceSet, OUT SendDatagramPacker& packer, ThreadIdType threadId) const;
 	[[nodiscard]]
-	SEND_PACKET_INFO_TO_STREAM_RETURN StoredSendPacketInfoToStream(OUT RUDPSession& session, OUT std::set<MultiSocketRUDP::PacketSequenceSetKey>& packetSequenceSet, OUT unsigned int& totalSendSize, ThreadIdType threadId) const;
+	SEND_PACKET_INFO_TO_STREAM_RETURN StoredSendPacketInfoToStream(OUT RUDPSession& session, OUT SendSequenceBitmap& packetSequenceSet, OUT SendDatagramPacker& packer, ThreadIdType threadId) const;
 
 	[[nodiscard]]
 	bool RefreshRetransmissionSendPacketInfo(OUT SendPacketInfo* sendPacketInfo, ThreadIdType threadId) const;
@@ -157,6 +286,7 @@ private:
 	std::vector<std::unique_ptr<RetransmissionScheduler>>& retransmissionSchedulers;
 
 	unsigned int retransmissionMs {};
+	bool useZeroCopyRecv{};
 
 	std::unique_ptr<DatagramLossSimulator> lossSimulator;
 };
@@ -97,6 +97,19 @@ void RUDPPacketProcessor::ProcessByPacketType(RUDPSession& session, const sockad
 		sessionDelegate.OnSendReply(session, recvPacket);
         break;
     }
+    case PACKET_TYPE::MTU_PROBE_REPLY_TYPE:
+    {
+        if (not sessionDelegate.CanProcessPacket(session, clientAddr))
+        {
+            break;
+        }
+
+        direction = PACKET_DIRECTION::CLIENT_TO_SERVER_REPLY;
+        DECODE_PACKET()
+
+        sessionDelegate.OnPathMtuProbeReply(session, recvPacket);
+        break;
+    }
     default:
         LOG_ERROR(std::format("Invalid packet type received: {}", static_cast<int>(packetType)));
         break;
@@ -9,6 +9,24 @@
 #include "MultiSocketRUDPCoreFunctionDelegate.h"
 #include "SendPacketInfo.h"
 #include "../Common/PacketCrypto/PacketCryptoHelper.h"
+#include <algorithm>
+#include <array>
+
+namespace
+{
+	// 수신 윈도우는 세션의 수신 로직 스레드만 다루므로, 그 안에서 호출된 송신에만 ACK를 실을 수 있습니다.
+	thread_local const RUDPSession* sessionInRecvLogic = nullptr;
+
+	void WriteSendPacket(OUT NetBuffer& buffer, IPacket& packet, const PacketSequence packetSequence, const RUDPAckFrame* ackFrame)
+	{
+		PACKET_TYPE packetType = PACKET_TYPE::SEND_TYPE;
+		const PacketId packetId = packet.GetPacketId();
+		buffer << packetType << packetSequence;
+		RUDPAckFrame::WritePiggybackField(buffer, ackFrame);
+		buffer << packetId;
+		packet.PacketToBuffer(buffer);
+	}
+}
 
 BYTE RUDPSession::maximumHoldingPacketQueueSize = 0;
 unsigned long long RUDPSession::reservedSessionTimeoutMs = 30000;
@@ -23,8 +41,20 @@ RUDPSession::RUDPSession(MultiSocketRUDPCore& inCore)
 
 bool RUDPSession::InitializeRIO(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable, const RIO_CQ& rioRecvCQ, const RIO_CQ& rioSendCQ)
 {
+	RecvSlotPool* recvSlotPool = core.GetRecvSlotPool(threadId);
+	RegisteredBufferSlab* sendBufferSlab = core.GetSendBufferSlab(threadId);
+	RegisteredBufferSlab* clientAddressSlab = core.GetClientAddressSlab(threadId);
+	if (recvSlotPool == nullptr || sendBufferSlab == nullptr || clientAddressSlab == nullptr)
+	{
+		LOG_ERROR(std::format("Worker buffer pool not found. threadId {}", threadId));
+		return false;
+	}
+
 	return rioContext.Initialize(
 		rioFunctionTable, 
+		*recvSlotPool,
+		*sendBufferSlab,
+		*clientAddressSlab,
 		rioRecvCQ, 
 		rioSendCQ, 
 		socketContext.GetSocket(), 
@@ -53,8 +83,14 @@ void RUDPSession::InitializeSession()
 		core.GetInitialRetransmissionMs(),
 		core.GetMinRetransmissionMs(),
 		core.GetMaxRetransmissionMs());
-	flowManager.Initialize(maximumHoldingPacketQueueSize);
+	pathMtuProber.Configure(core.GetDatagramSizeBudget(), core.GetMaxProbeDatagramSize());
+	delayedAckTracker.Configure(core.GetDelayedAckPacketCount(), core.GetDelayedAckTimeoutMs());
+	flowManager.Initialize(maximumHoldingPacketQueueSize, core.GetCongestionControlType());
 	rioContext.GetSendContext().Reset();
+	{
+		std::scoped_lock lock(rioContext.GetSendContext().GetPendingQueueLock());
+		sendPacer.Configure(core.IsSendPacingEnabled());
+	}
 	sessionPacketOrderer.Initialize(maximumHoldingPacketQueueSize);
 	disconnectedReason = DISCONNECT_REASON::NOT_DISCONNECTED;
 
@@ -120,6 +156,11 @@ bool RUDPSession::SendPacket(IPacket& packet)
 		return false;
 	}
 
+	if (not IsSendablePacketBodySize(packet))
+	{
+		return false;
+	}
+
 	NetBuffer* buffer = NetBuffer::Alloc();
 	if (buffer == nullptr)
 	{
@@ -128,18 +169,178 @@ bool RUDPSession::SendPacket(IPacket& packet)
 		return false;
 	}
 
-	PACKET_TYPE packetType = PACKET_TYPE::SEND_TYPE;
+	RUDPAckFrame ackFrame;
+	const bool piggybackAck = sessionInRecvLogic == this;
+	if (piggybackAck)
+	{
+		flowManager.FillAckFrame(ackFrame);
+	}
+
 	const PacketSequence packetSequence = rioContext.GetSendContext().IncrementLastSendPacketSequence();
-	const PacketId packetId = packet.GetPacketId();
-	*buffer << packetType << packetSequence << packetId;
-	packet.PacketToBuffer(*buffer);
+	WriteSendPacket(*buffer, packet, packetSequence, piggybackAck ? &ackFrame : nullptr);
 
-	if (not SendPacket(*buffer, packetSequence, false, false))
+	bool isPushedToPendingQueue = false;
+	if (not SendPacket(*buffer, packetSequence, false, false, isPushedToPendingQueue))
 	{
 		DoDisconnect(DISCONNECT_REASON::BY_ERROR);
 		return false;
 	}
 
+	// 보류 큐에 들어간 패킷은 언제 나갈지 모르므로 별도 응답을 대신하지 못합니다.
+	if (piggybackAck && not isPushedToPendingQueue)
+	{
+		delayedAckTracker.OnAckSent(ackFrame.cumulativeSequence);
+	}
+
+	return true;
+}
+
+bool RUDPSession::IsSendablePacketBodySize(const IPacket& packet)
+{
+	// 크기를 아는 패킷은 버퍼와 시퀀스를 쓰기 전에 걸러, 너무 큰 패킷이 세션을 끊지 않고 송신만 거부되게 합니다.
+	const size_t serializedSize = packet.GetSerializedSize();
+	if (serializedSize != UNKNOWN_SERIALIZED_SIZE && serializedSize > PacketCryptoHelper::MAX_PACKET_BODY_SIZE)
+	{
+		LOG_ERROR(std::format("Packet body is too large. packetId: {}, size: {}, max: {}", packet.GetPacketId(), serializedSize, PacketCryptoHelper::MAX_PACKET_BODY_SIZE));
+		return false;
+	}
+
+	return true;
+}
+
+bool RUDPSession::SendPackets(const std::span<IPacket* const> packets)
+{
+	if (not IsConnected())
+	{
+		return false;
+	}
+
+	for (const IPacket* packet : packets)
+	{
+		if (packet == nullptr)
+		{
+			LOG_ERROR("Packet is nullptr in RUDPSession::SendPackets()");
+			return false;
+		}
+
+		if (not IsSendablePacketBodySize(*packet))
+		{
+			return false;
+		}
+	}
+
+	if (packets.empty())
+	{
+		return true;
+	}
+
+	RUDPAckFrame ackFrame;
+	const bool piggybackAck = sessionInRecvLogic == this;
+	if (piggybackAck)
+	{
+		flowManager.FillAckFrame(ackFrame);
+	}
+
+	// 스택 배열에 담을 수 있는 만큼씩 나누어 보냅니다. ACK는 첫 패킷에만 실어도 충분합니다.
+	for (size_t batchBegin = 0; batchBegin < packets.size(); batchBegin += MAX_SEND_PACKET_BATCH_SIZE)
+	{
+		const size_t batchSize = std::min<size_t>(MAX_SEND_PACKET_BATCH_SIZE, packets.size() - batchBegin);
+		const RUDPAckFrame* batchAckFrame = (piggybackAck && batchBegin == 0) ? &ackFrame : nullptr;
+		bool isAckSent = false;
+		if (not SendPacketBatch(packets.subspan(batchBegin, batchSize), batchAckFrame, isAckSent))
+		{
+			DoDisconnect(DISCONNECT_REASON::BY_ERROR);
+			return false;
+		}
+
+		if (isAckSent)
+		{
+			delayedAckTracker.OnAckSent(ackFrame.cumulativeSequence);
+		}
+	}
+
+	return true;
+}
+
+bool RUDPSession::SendPacketBatch(const std::span<IPacket* const> packets, const RUDPAckFrame* ackFrame, OUT bool& isAckSent)
+{
+	isAckSent = false;
+
+	// 시퀀스를 예약한 뒤에 실패하면 빈 번호가 생기므로 버퍼를 먼저 모두 잡습니다.
+	std::array<std::pair<PacketSequence, NetBuffer*>, MAX_SEND_PACKET_BATCH_SIZE> sendBuffers;
+	for (size_t i = 0; i < packets.size(); ++i)
+	{
+		NetBuffer* buffer = NetBuffer::Alloc();
+		if (buffer == nullptr)
+		{
+			LOG_ERROR("Buffer is nullptr in RUDPSession::SendPacketBatch()");
+			for (size_t freeIndex = 0; freeIndex < i; ++freeIndex)
+			{
+				NetBuffer::Free(sendBuffers[freeIndex].second);
+			}
+
+			return false;
+		}
+
+		sendBuffers[i] = { 0, buffer };
+	}
+
+	const PacketSequence firstSequence = rioContext.GetSendContext().ReserveSendPacketSequences(packets.size());
+	for (size_t i = 0; i < packets.size(); ++i)
+	{
+		auto& [packetSequence, buffer] = sendBuffers[i];
+		packetSequence = firstSequence + i;
+		WriteSendPacket(*buffer, *packets[i], packetSequence, i == 0 ? ackFrame : nullptr);
+	}
+
+	size_t immediateCount = 0;
+	{
+		std::scoped_lock lock(rioContext.GetSendContext().GetPendingQueueLock());
+		const auto now = std::chrono::steady_clock::now();
+		const auto pacingInterval = flowManager.GetPacingInterval();
+		for (; immediateCount < packets.size(); ++immediateCount)
+		{
+			if (not rioContext.GetSendContext().IsPendingQueueEmpty()
+				|| not flowManager.CanSend(sendBuffers[immediateCount].first)
+				|| not sendPacer.CanSendNow(now))
+			{
+				break;
+			}
+
+			sendPacer.OnPacketReleased(now, pacingInterval);
+		}
+
+		// 한 패킷이라도 보류되면 순서를 지키기 위해 뒤따르는 패킷도 모두 보류 큐로 보냅니다.
+		for (size_t i = immediateCount; i < packets.size(); ++i)
+		{
+			if (not rioContext.GetSendContext().PushToPendingQueue(sendBuffers[i].first, sendBuffers[i].second))
+			{
+				LOG_ERROR("Pending queue is full in RUDPSession::SendPacketBatch()");
+				for (size_t freeIndex = 0; freeIndex < immediateCount; ++freeIndex)
+				{
+					NetBuffer::Free(sendBuffers[freeIndex].second);
+				}
+				for (size_t freeIndex = i; freeIndex < packets.size(); ++freeIndex)
+				{
+					NetBuffer::Free(sendBuffers[freeIndex].second);
+				}
+
+				return false;
+			}
+		}
+
+		if (immediateCount < packets.size())
+		{
+			SchedulePacedFlush(now);
+		}
+	}
+
+	if (immediateCount > 0 && not SendPacketsImmediate(std::span(sendBuffers).first(immediateCount)))
+	{
+		return false;
+	}
+
+	isAckSent = ackFrame != nullptr && immediateCount > 0;
 	return true;
 }
 
@@ -157,11 +358,26 @@ void RUDPSession::OnConnected(const SessionIdType inSessionId)
 
 bool RUDPSession::SendPacket(NetBuffer& buffer, const PacketSequence inSendPacketSequence, const bool isReplyType, const bool isCorePacket)
 {
+	bool isPushedToPendingQueue = false;
+	return SendPacket(buffer, inSendPacketSequence, isReplyType, isCorePacket, isPushedToPendingQueue);
+}
+
+bool RUDPSession::SendPacket(
+	NetBuffer& buffer,
+	const PacketSequence inSendPacketSequence,
+	const bool isReplyType,
+	const bool isCorePacket,
+	OUT bool& isPushedToPendingQueue)
+{
+	isPushedToPendingQueue = false;
 	if (not isReplyType)
 	{
 		std::scoped_lock lock(rioContext.GetSendContext().GetPendingQueueLock());
 
-		if (not rioContext.GetSendContext().IsPendingQueueEmpty() || not flowManager.CanSend(inSendPacketSequence))
+		const auto now = std::chrono::steady_clock::now();
+		if (not rioContext.GetSendContext().IsPendingQueueEmpty()
+			|| not flowManager.CanSend(inSendPacketSequence)
+			|| not sendPacer.CanSendNow(now))
 		{
 			if (not rioContext.GetSendContext().PushToPendingQueue(inSendPacketSequence, &buffer))
 			{
@@ -170,8 +386,12 @@ bool RUDPSession::SendPacket(NetBuffer& buffer, const PacketSequence inSendPacke
 				return false;
 			}
 
+			SchedulePacedFlush(now);
+			isPushedToPendingQueue = true;
 			return true;
 		}
+
+		sendPacer.OnPacketReleased(now, flowManager.GetPacingInterval());
 	}
 
 	return SendPacketImmediate(buffer, inSendPacketSequence, isReplyType, isCorePacket);
@@ -182,13 +402,82 @@ bool RUDPSession::SendPacketImmediate(
 	const PacketSequence inSendPacketSequence,
 	const bool isReplyType, 
 	const bool isCorePacket)
+{
+	SendPacketInfo* sendPacketInfo = PrepareSendPacketInfo(buffer, inSendPacketSequence, isReplyType, isCorePacket);
+	if (sendPacketInfo == nullptr)
+	{
+		return false;
+	}
+
+	if (not core.SendPacket(sendPacketInfo))
+	{
+		DiscardSendPacketInfo(sendPacketInfo, inSendPacketSequence, isReplyType);
+		return false;
+	}
+
+	SendPacketInfo::Free(sendPacketInfo);
+	return true;
+}
+
+bool RUDPSession::SendPacketsImmediate(const std::span<const std::pair<PacketSequence, NetBuffer*>> sendBuffers)
+{
+	const auto freeBuffersFrom = [&sendBuffers](const size_t firstIndex)
+		{
+			for (size_t freeIndex = firstIndex; freeIndex < sendBuffers.size(); ++freeIndex)
+			{
+				NetBuffer::Free(sendBuffers[freeIndex].second);
+			}
+		};
+
+	assert(sendBuffers.size() <= MAX_SEND_PACKET_BATCH_SIZE);
+
+	std::array<SendPacketInfo*, MAX_SEND_PACKET_BATCH_SIZE> sendPacketInfos{};
+	for (size_t bufferIndex = 0; bufferIndex < sendBuffers.size(); ++bufferIndex)
+	{
+		const auto& [packetSequence, buffer] = sendBuffers[bufferIndex];
+		SendPacketInfo* sendPacketInfo = PrepareSendPacketInfo(*buffer, packetSequence, false, false);
+		if (sendPacketInfo == nullptr)
+		{
+			freeBuffersFrom(bufferIndex + 1);
+			for (size_t infoIndex = 0; infoIndex < bufferIndex; ++infoIndex)
+			{
+				DiscardSendPacketInfo(sendPacketInfos[infoIndex], sendBuffers[infoIndex].first, false);
+			}
+
+			return false;
+		}
+
+		sendPacketInfos[bufferIndex] = sendPacketInfo;
+	}
+
+	const bool sent = core.SendPackets(*this, std::span(sendPacketInfos).first(sendBuffers.size()));
+	for (size_t infoIndex = 0; infoIndex < sendBuffers.size(); ++infoIndex)
+	{
+		if (sent)
+		{
+			SendPacketInfo::Free(sendPacketInfos[infoIndex]);
+		}
+		else
+		{
+			DiscardSendPacketInfo(sendPacketInfos[infoIndex], sendBuffers[infoIndex].first, false);
+		}
+	}
+
+	return sent;
+}
+
+SendPacketInfo* RUDPSession::PrepareSendPacketInfo(
+	NetBuffer& buffer,
+	const PacketSequence inSendPacketSequence,
+	const bool isReplyType,
+	const bool isCorePacket)
 {
 	const auto sendPacketInfo = sendPacketInfoPool->Alloc();
 	if (sendPacketInfo == nullptr)
 	{
-		LOG_ERROR("SendPacketInfo is nullptr in RUDPSession::SendPacketImmediate()");
+		LOG_ERROR("SendPacketInfo is nullptr in RUDPSession::PrepareSendPacketInfo()");
 		NetBuffer::Free(&buffer);
-		return false;
+		return nullptr;
 	}
 
 	sendPacketInfo->Initialize(this, sessionGeneration.load(std::memory_order_acquire), &buffer, inSendPacketSequence, isReplyType);
@@ -211,66 +500,139 @@ bool RUDPSession::SendPacketImmediate(
 		);
 	}
 
-	if (not core.SendPacket(sendPacketInfo))
-	{
-		if (not isReplyType)
-		{
-			core.MarkSendPacketInfoErased(sendPacketInfo, threadId);
-			rioContext.GetSendContext().EraseSendPacketInfo(inSendPacketSequence);
-			SendPacketInfo::Free(sendPacketInfo);
-		}
-		else
-		{
-			sendPacketInfo->isErasedPacketInfo.store(true, std::memory_order_release);
-			SendPacketInfo::Free(sendPacketInfo);
-		}
+	return sendPacketInfo;
+}
 
-		return false;
+void RUDPSession::DiscardSendPacketInfo(SendPacketInfo* sendPacketInfo, const PacketSequence inSendPacketSequence, const bool isReplyType)
+{
+	if (not isReplyType)
+	{
+		core.MarkSendPacketInfoErased(sendPacketInfo, threadId);
+		rioContext.GetSendContext().EraseSendPacketInfo(inSendPacketSequence);
+		SendPacketInfo::Free(sendPacketInfo);
+	}
+	else
+	{
+		sendPacketInfo->isErasedPacketInfo.store(true, std::memory_order_release);
+		SendPacketInfo::Free(sendPacketInfo);
 	}
-
-	SendPacketInfo::Free(sendPacketInfo);
-	return true;
 }
 
 void RUDPSession::TryFlushPendingQueue()
 {
-	std::vector<std::pair<PacketSequence, NetBuffer*>> sendBuffers;
+	std::array<std::pair<PacketSequence, NetBuffer*>, MAX_SEND_PACKET_BATCH_SIZE> sendBuffers;
+	size_t bufferCount = 0;
+	do
 	{
-		std::scoped_lock lock(rioContext.GetSendContext().GetPendingQueueLock());
-		while (not rioContext.GetSendContext().IsPendingQueueEmpty())
+		bufferCount = 0;
 		{
-			if (const auto& [sequence, _] = rioContext.GetSendContext().PendingQueueFront(); not flowManager.CanSend(sequence))
+			std::scoped_lock lock(rioContext.GetSendContext().GetPendingQueueLock());
+			const auto now = std::chrono::steady_clock::now();
+			const auto pacingInterval = flowManager.GetPacingInterval();
+			while (bufferCount < sendBuffers.size() && not rioContext.GetSendContext().IsPendingQueueEmpty())
 			{
-				break;
+				if (const auto& [sequence, _] = rioContext.GetSendContext().PendingQueueFront(); not flowManager.CanSend(sequence))
+				{
+					break;
+				}
+
+				if (not sendPacer.CanSendNow(now))
+				{
+					SchedulePacedFlush(now);
+					break;
+				}
+
+				rioContext.GetSendContext().PopFromPendingQueue(sendBuffers[bufferCount]);
+				++bufferCount;
+				sendPacer.OnPacketReleased(now, pacingInterval);
 			}
-
-			std::pair<PacketSequence, NetBuffer*> item;
-			rioContext.GetSendContext().PopFromPendingQueue(item);
-			sendBuffers.push_back(item);
 		}
-	}
 
-	size_t bufferIndex = 0;
-	const size_t sendBuffersSize = sendBuffers.size();
-	for (; bufferIndex < sendBuffersSize; ++bufferIndex)
-	{
-		auto& [packetSequence, buffer] = sendBuffers[bufferIndex];
-		if (not SendPacketImmediate(*buffer, packetSequence, false, false))
+		// 풀려난 패킷을 한 번에 큐에 넣고 송신 패스를 한 번만 돌려 같은 데이터그램으로 묶이게 합니다.
+		if (bufferCount > 0 && not SendPacketsImmediate(std::span(sendBuffers).first(bufferCount)))
 		{
 			DoDisconnect(DISCONNECT_REASON::BY_ERROR);
-			++bufferIndex;
-			break;
+			return;
 		}
+	} while (bufferCount == sendBuffers.size());
+}
+
+void RUDPSession::SchedulePacedFlush(const std::chrono::steady_clock::time_point now)
+{
+	if (sendPacer.CanSendNow(now) || not sendPacer.TryMarkScheduled())
+	{
+		return;
 	}
 
-	for (; bufferIndex < sendBuffersSize; ++bufferIndex)
+	// 예약하지 못하면 다음 ACK가 보류 큐를 비울 때까지 기다립니다.
+	if (not core.SchedulePacedSend(*this, sendPacer.GetNextDepartureTime()))
 	{
-		NetBuffer::Free(sendBuffers[bufferIndex].second);
+		sendPacer.ClearScheduled();
 	}
 }
 
+bool RUDPSession::EnqueueBroadcastBody(NetBuffer& sharedBody, OUT bool& needsFlushSchedule, OUT std::chrono::steady_clock::time_point& flushTime)
+{
+	needsFlushSchedule = false;
+	NetBuffer* buffer = NetBuffer::Alloc();
+	if (buffer == nullptr)
+	{
+		LOG_ERROR("Buffer is nullptr in RUDPSession::EnqueueBroadcastBody()");
+		DoDisconnect(DISCONNECT_REASON::BY_ERROR);
+		return false;
+	}
+
+	{
+		auto& sendContext = rioContext.GetSendContext();
+		std::scoped_lock lock(sendContext.GetPendingQueueLock());
+		// 시퀀스를 쓰기 전에 걸러야 빈 번호가 생기지 않으므로, 이 세션만 이번 패킷을 받지 못하고 연결은 유지됩니다.
+		if (sendContext.IsPendingQueueFull())
+		{
+			LOG_ERROR(std::format("Pending queue is full in RUDPSession::EnqueueBroadcastBody(). sessionId: {}", sessionId));
+			NetBuffer::Free(buffer);
+			return false;
+		}
+
+		PACKET_TYPE packetType = PACKET_TYPE::SEND_TYPE;
+		const PacketSequence packetSequence = sendContext.IncrementLastSendPacketSequence();
+		*buffer << packetType << packetSequence;
+		RUDPAckFrame::WritePiggybackField(*buffer, nullptr);
+		buffer->WriteBuffer(sharedBody.GetReadBufferPtr(), sharedBody.GetUseSize());
+
+		// 암호화와 송신은 보류 큐를 비우는 IO worker가 맡고, 이 호출 뒤에 보낸 패킷은 보류 큐 뒤에 서므로 순서가 유지됩니다.
+		const bool wasPendingQueueEmpty = sendContext.IsPendingQueueEmpty();
+		sendContext.PushToPendingQueue(packetSequence, buffer);
+
+		// 앞선 보류 패킷이 있으면 그 패킷을 막은 ACK나 예약된 flush가 함께 비우고, cwnd에 막혔으면 다음 ACK가 비웁니다.
+		if (not wasPendingQueueEmpty || not flowManager.CanSend(packetSequence))
+		{
+			return true;
+		}
+
+		const auto now = std::chrono::steady_clock::now();
+		flushTime = sendPacer.CanSendNow(now) ? now : sendPacer.GetNextDepartureTime();
+		needsFlushSchedule = sendPacer.TryMarkScheduled();
+	}
+
+	return true;
+}
+
+void RUDPSession::ClearPacedFlushSchedule()
+{
+	std::scoped_lock lock(rioContext.GetSendContext().GetPendingQueueLock());
+	sendPacer.ClearScheduled();
+}
+
+void RUDPSession::OnPacedSendDue()
+{
+	ClearPacedFlushSchedule();
+	TryFlushPendingQueue();
+}
+
 void RUDPSession::SendHeartbeatPacket(const unsigned long long now)
 {
+	TrySendPathMtuProbe(now);
+
 	if (not NeedToSendHeartbeat(now))
 	{
 		return;
@@ -299,6 +661,58 @@ void RUDPSession::SendHeartbeatPacket(const unsigned long long now)
 	}
 }
 
+void RUDPSession::TrySendPathMtuProbe(const unsigned long long now)
+{
+	if (nowInReleaseThread.load(std::memory_order_acquire) || not IsConnected())
+	{
+		return;
+	}
+
+	PacketSequence probeSequence{};
+	unsigned int probeSize{};
+	if (not pathMtuProber.TryBeginProbe(now, GetRetransmissionTimeoutMs(), probeSequence, probeSize))
+	{
+		return;
+	}
+
+	constexpr unsigned int probeFixedSize = df_HEADER_SIZE + sizeof(PACKET_TYPE) + sizeof(PacketSequence) + sizeof(WORD) + AUTH_TAG_SIZE;
+	static char probePadding[MAX_DATAGRAM_SIZE_BUDGET]{};
+	if (probeSize <= probeFixedSize)
+	{
+		pathMtuProber.CancelProbe();
+		return;
+	}
+
+	NetBuffer* buffer = NetBuffer::Alloc();
+	if (buffer == nullptr)
+	{
+		LOG_ERROR("Buffer is nullptr in RUDPSession::TrySendPathMtuProbe()");
+		pathMtuProber.CancelProbe();
+		return;
+	}
+
+	auto packetType = PACKET_TYPE::MTU_PROBE_TYPE;
+	const WORD probeSizeField = static_cast<WORD>(probeSize);
+	*buffer << packetType << probeSequence << probeSizeField;
+	buffer->WriteBuffer(probePadding, static_cast<int>(probeSize - probeFixedSize));
+
+	// 프로브 시퀀스는 최상위 비트가 설정되어 있어 데이터 패킷의 nonce와 겹치지 않습니다.
+	PacketCryptoHelper::EncodePacket(
+		*buffer,
+		probeSequence,
+		PACKET_DIRECTION::SERVER_TO_CLIENT,
+		cryptoContext.GetSessionSalt(),
+		SESSION_SALT_SIZE,
+		cryptoContext.GetSessionKeyHandle(),
+		true
+	);
+
+	if (not SendPacket(*buffer, probeSequence, true, true))
+	{
+		DoDisconnect(DISCONNECT_REASON::BY_ERROR);
+	}
+}
+
 void RUDPSession::RefreshLastReceivedPacketTime(unsigned long long now)
 {
 	lastReceivedPacketTime.store(now, std::memory_order_relaxed);
@@ -378,7 +792,7 @@ void RUDPSession::CompleteIOCompletion()
 void RUDPSession::FinalizeRIOCleanup()
 {
 	assert(CanFinalizeIO());
-	rioContext.Cleanup(core.GetRIOFunctionTable());
+	rioContext.Cleanup();
 }
 
 bool RUDPSession::CanFinalizeIO()
@@ -398,11 +812,6 @@ RecvBuffer& RUDPSession::GetRecvBuffer()
 	return rioContext.GetRecvBuffer();
 }
 
-std::shared_ptr<IOContext> RUDPSession::GetRecvBufferContext() const
-{
-	return rioContext.GetRecvBufferContext();
-}
-
 void RUDPSession::RecvContextReset()
 {
 	rioContext.RecvContextReset();
@@ -418,6 +827,11 @@ RIO_RQ RUDPSession::GetSendRIORQ() const
 	return rioContext.GetRIORQ();
 }
 
+const RIO_BUF& RUDPSession::GetClientAddressRIOBuffer() const
+{
+	return rioContext.GetClientAddressRIOBuffer();
+}
+
 bool RUDPSession::TryConnect(NetBuffer& recvPacket, const sockaddr_in& inClientAddr)
 {
 	PacketSequence packetSequence;
@@ -437,13 +851,14 @@ bool RUDPSession::TryConnect(NetBuffer& recvPacket, const sockaddr_in& inClientA
 	clientAddr = inClientAddr;
 	memset(&clientSockAddrInet, 0, sizeof(clientSockAddrInet));
 	clientSockAddrInet.Ipv4 = inClientAddr;
+	rioContext.SetClientAddress(clientSockAddrInet);
 
 	constexpr PacketSequence startSequence = LOGIN_PACKET_SEQUENCE + 1;
 	sessionPacketOrderer.Reset(startSequence);
 	flowManager.Reset(startSequence);
 
 	OnConnected(sessionId);
-	SendReplyToClient(packetSequence);
+	SendReplyToClient();
 
 	return true;
 }
@@ -459,10 +874,23 @@ bool RUDPSession::OnRecvPacket(NetBuffer& recvPacket)
 	PacketSequence packetSequence;
 	recvPacket >> packetSequence;
 
+	RUDPAckFrame piggybackedAckFrame;
+	bool hasPiggybackedAck = false;
+	if (not RUDPAckFrame::ReadPiggybackField(recvPacket, piggybackedAckFrame, hasPiggybackedAck))
+	{
+		LOG_ERROR(std::format("Invalid piggyback ack field. sequence: {}", packetSequence));
+		return false;
+	}
+
+	if (hasPiggybackedAck)
+	{
+		OnAckFrameReceived(piggybackedAckFrame);
+	}
+
 	const PacketSequence nextExpectedSequence = sessionPacketOrderer.GetNextExpected();
 	if (IsOlderRecvSequence(packetSequence, nextExpectedSequence))
 	{
-		SendReplyToClient(packetSequence);
+		SendReplyToClient();
 		return true;
 	}
 
@@ -471,6 +899,7 @@ bool RUDPSession::OnRecvPacket(NetBuffer& recvPacket)
 		return true;
 	}
 
+	sessionInRecvLogic = this;
 	const auto packetProcessResult = sessionPacketOrderer.OnReceive(
 		packetSequence,
 		recvPacket,
@@ -478,17 +907,40 @@ bool RUDPSession::OnRecvPacket(NetBuffer& recvPacket)
 		{
 			return ProcessPacket(buffer, sequence);
 		});
+	sessionInRecvLogic = nullptr;
 
 	switch (packetProcessResult)
 	{
-	case ON_RECV_RESULT::DUPLICATED_RECV:
+	case ON_RECV_RESULT::PACKET_HELD:
 	{
-		SendReplyToClient(packetSequence);
+		// 보류된 패킷도 수신 윈도우에 표시해 두어야 SACK 구간으로 알려 재전송을 막을 수 있습니다.
+		flowManager.MarkReceived(packetSequence);
 		[[fallthrough]];
 	}
+	case ON_RECV_RESULT::DUPLICATED_RECV:
+	{
+		// 순서가 어긋났거나 중복된 수신은 송신 측이 손실을 빨리 알 수 있도록 지연 없이 응답합니다.
+		SendReplyToClient();
+		return true;
+	}
 	case ON_RECV_RESULT::PROCESSED:
-	case ON_RECV_RESULT::PACKET_HELD:
 	{
+		const PacketSequence processedThrough = sessionPacketOrderer.GetNextExpected() - 1;
+		if (delayedAckTracker.IsAckedThrough(processedThrough))
+		{
+			// 핸들러가 보낸 응답 패킷에 이 패킷까지의 ACK가 이미 실렸습니다.
+			return true;
+		}
+
+		// 보류되어 있던 패킷까지 함께 처리되었다면 빈 구간이 메워진 것이므로 바로 알립니다.
+		if (processedThrough != nextExpectedSequence)
+		{
+			SendReplyToClient();
+		}
+		else
+		{
+			SendOrDelayReplyToClient();
+		}
 		return true;
 	}
 	case ON_RECV_RESULT::ERROR_OCCURED:
@@ -512,26 +964,27 @@ bool RUDPSession::ProcessPacket(NetBuffer& recvPacket, const PacketSequence recv
 	PacketId packetId;
 	recvPacket >> packetId;
 
-	auto const itor = packetFactoryMap.find(packetId);
-	if (itor == packetFactoryMap.end())
+	if (packetId >= packetHandlerTable.size() || packetHandlerTable[packetId].invoker == nullptr)
 	{
 		LOG_ERROR(std::format("Received unknown packet. packetId: {}", packetId));
 		return false;
 	}
 
-	if (not itor->second(this, &recvPacket)())
+	// 핸들러가 보내는 응답 패킷에 이 패킷까지의 ACK가 실리도록 먼저 수신 윈도우에 표시합니다.
+	// 핸들러가 실패하면 세션이 끊기므로 표시를 되돌릴 필요는 없습니다.
+	flowManager.MarkReceived(recvPacketSequence);
+
+	const PacketHandlerEntry& entry = packetHandlerTable[packetId];
+	if (not entry.invoker(*this, recvPacket, entry))
 	{
-		LOG_ERROR(std::format("Failed to process received packet. packetId: {}", packetId));
+		LOG_ERROR(std::format("Received malformed packet. packetId: {}", packetId));
 		return false;
 	}
 
-	flowManager.MarkReceived(recvPacketSequence);
-	SendReplyToClient(recvPacketSequence);
-
 	return true;
 }
 
-void RUDPSession::SendReplyToClient(const PacketSequence recvPacketSequence)
+void RUDPSession::SendReplyToClient()
 {
 	NetBuffer* buffer = NetBuffer::Alloc();
 	if (buffer == nullptr)
@@ -541,43 +994,138 @@ void RUDPSession::SendReplyToClient(const PacketSequence recvPacketSequence)
 		return;
 	}
 
+	RUDPAckFrame ackFrame;
+	flowManager.FillAckFrame(ackFrame);
+	delayedAckTracker.OnAckSent(ackFrame.cumulativeSequence);
+
 	auto packetType = PACKET_TYPE::SEND_REPLY_TYPE;
-	const BYTE advertiseWindow = flowManager.GetAdvertisableWindow();
-	*buffer << packetType << recvPacketSequence << advertiseWindow;
+	const PacketSequence replySequence = RUDPAckFrame::REPLY_SEQUENCE_FLAG | rioContext.GetSendContext().IncrementLastReplyPacketSequence();
+	*buffer << packetType << replySequence;
+	ackFrame.WriteTo(*buffer);
 
-	if (not SendPacket(*buffer, recvPacketSequence, true, true))
+	if (not SendPacket(*buffer, replySequence, true, true))
 	{
 		DoDisconnect(DISCONNECT_REASON::BY_ERROR);
 	}
 }
 
+void RUDPSession::SendOrDelayReplyToClient()
+{
+	const unsigned long long now = GetTickCount64();
+	switch (delayedAckTracker.OnInOrderPacket(now))
+	{
+	case DELAYED_ACK_ACTION::SEND_NOW:
+	{
+		SendReplyToClient();
+		break;
+	}
+	case DELAYED_ACK_ACTION::SCHEDULE:
+	{
+		if (not core.ScheduleDelayedAck(*this, delayedAckTracker.GetAckDeadline()))
+		{
+			SendReplyToClient();
+		}
+		break;
+	}
+	case DELAYED_ACK_ACTION::ALREADY_SCHEDULED:
+	{
+		break;
+	}
+	}
+}
+
+void RUDPSession::FlushDelayedAck(const unsigned long long now)
+{
+	if (delayedAckTracker.IsAckDue(now))
+	{
+		SendReplyToClient();
+	}
+}
+
 void RUDPSession::OnSendReply(NetBuffer& recvPacket)
 {
-	PacketSequence packetSequence;
-	recvPacket >> packetSequence;
+	PacketSequence replySequence;
+	recvPacket >> replySequence;
 
-	if (rioContext.GetSendContext().GetLastSendPacketSequence() < packetSequence)
+	RUDPAckFrame ackFrame;
+	if (not ackFrame.ReadFrom(recvPacket))
 	{
 		return;
 	}
 
-	SendPacketInfo* sendPacketInfo = rioContext.GetSendContext().FindAndEraseSendPacketInfo(packetSequence);
-	if (sendPacketInfo == nullptr)
+	OnAckFrameReceived(ackFrame);
+}
+
+void RUDPSession::OnAckFrameReceived(const RUDPAckFrame& ackFrame)
+{
+	if (rioContext.GetSendContext().GetLastSendPacketSequence() < ackFrame.cumulativeSequence)
 	{
 		return;
 	}
 
-	flowManager.OnAckReceived(packetSequence);
-	core.MarkSendPacketInfoErased(sendPacketInfo, threadId);
+	const auto now = std::chrono::steady_clock::now();
 	std::chrono::steady_clock::duration rttSample{};
-	if (sendPacketInfo->TryGetRttSample(std::chrono::steady_clock::now(), rttSample))
+	bool hasRttSample = false;
+
+	// 콜백은 시퀀스 오름차순으로 불리므로, RTT 샘플은 가장 최근에 보낸 패킷의 것이 남습니다.
+	const size_t ackedCount = rioContext.GetSendContext().EraseAckedSendPacketInfos(ackFrame, [&](SendPacketInfo* sendPacketInfo)
+	{
+		core.MarkSendPacketInfoErased(sendPacketInfo, threadId);
+		if (std::chrono::steady_clock::duration sample{}; sendPacketInfo->TryGetRttSample(now, sample))
+		{
+			rttSample = sample;
+			hasRttSample = true;
+		}
+		SendPacketInfo::Free(sendPacketInfo);
+	});
+
+	if (ackedCount == 0)
+	{
+		return;
+	}
+
+	// SACK 구간은 아직 빈 시퀀스 뒤에 있으므로, 혼잡 제어의 마지막 ACK 시퀀스는 누적 시퀀스로만 옮깁니다.
+	flowManager.OnAckReceived(ackFrame.cumulativeSequence);
+	if (hasRttSample)
 	{
 		OnRttSample(rttSample);
 	}
-	SendPacketInfo::Free(sendPacketInfo);
+
+	FastRetransmitLostPackets(ackFrame);
 	TryFlushPendingQueue();
 }
 
+void RUDPSession::FastRetransmitLostPackets(const RUDPAckFrame& ackFrame)
+{
+	std::array<SendPacketInfo*, MAX_FAST_RETRANSMIT_PER_ACK> lostInfos;
+	const size_t lostCount = rioContext.GetSendContext().CollectFastRetransmitTargets(ackFrame, lostInfos);
+	if (lostCount == 0)
+	{
+		return;
+	}
+
+	flowManager.OnFastRetransmit();
+	for (SendPacketInfo* lostInfo : std::span(lostInfos.data(), lostCount))
+	{
+		std::ignore = core.FastRetransmit(lostInfo, threadId);
+		SendPacketInfo::Free(lostInfo);
+	}
+}
+
+void RUDPSession::OnPathMtuProbeReply(NetBuffer& recvPacket)
+{
+	PacketSequence probeSequence;
+	WORD probeSize;
+	recvPacket >> probeSequence >> probeSize;
+
+	if (not PathMtuProber::IsProbeSequence(probeSequence))
+	{
+		return;
+	}
+
+	pathMtuProber.OnProbeAcked(probeSequence, probeSize);
+}
+
 void RUDPSession::OnRetransmissionTimeout() noexcept
 {
 	if (retransmissionTimeoutEstimator.OnTimeout(std::chrono::steady_clock::now()))
@@ -589,6 +1137,7 @@ void RUDPSession::OnRetransmissionTimeout() noexcept
 void RUDPSession::OnRttSample(const std::chrono::steady_clock::duration sample)
 {
 	retransmissionTimeoutEstimator.OnRttSample(sample);
+	flowManager.OnRttSample(sample);
 }
 
 std::shared_mutex& RUDPSession::GetSocketMutex() const
@@ -641,6 +1190,11 @@ unsigned int RUDPSession::GetRetransmissionTimeoutMs() const noexcept
 	return retransmissionTimeoutEstimator.GetRtoMs();
 }
 
+unsigned int RUDPSession::GetDatagramSizeBudget() const noexcept
+{
+	return pathMtuProber.GetDatagramSizeBudget();
+}
+
 SESSION_STATE RUDPSession::GetSessionState() const
 {
 	return stateMachine.GetSessionState();
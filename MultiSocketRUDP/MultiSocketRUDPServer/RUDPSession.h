@@ -2,6 +2,11 @@
 #include <functional>
 #include "../Common/etc/CoreType.h"
 #include <shared_mutex>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <vector>
 #include "PacketManager.h"
 #include "../Common/FlowController/RUDPFlowManager.h"
 #include "SessionCryptoContext.h"
@@ -10,6 +15,9 @@
 #include "SessionRIOContext.h"
 #include "SessionStateMachine.h"
 #include "RetransmissionTimeoutEstimator.h"
+#include "PathMtuProber.h"
+#include "DelayedAckTracker.h"
+#include "SessionPacer.h"
 
 namespace MultiSocketRUDP
 {
@@ -52,7 +60,20 @@ public:
 	// @details 예약 상태 또는 연결 상태에서만 RELEASING 상태로 전이할 수 있습니다.
 	// ----------------------------------------
 	void DoDisconnect(const DISCONNECT_REASON disconnectSession);
+	// ----------------------------------------
+	// @brief 패킷을 직렬화해 전송합니다.
+	// @details GetSerializedSize()로 본문 크기를 알 수 있는 패킷이 PacketCryptoHelper::MAX_PACKET_BODY_SIZE를 넘으면 연결을 유지한 채 false를 반환합니다.
+	// ----------------------------------------
 	bool SendPacket(IPacket& packet);
+	// ----------------------------------------
+	// @brief 여러 패킷을 연속된 시퀀스로 직렬화해 한 번에 전송합니다.
+	// @details MAX_SEND_PACKET_BATCH_SIZE개씩 묶어 묶음마다 시퀀스를 한 번에 예약하고, 바로 보낼 수 있는 패킷을 모두 송신 큐에 넣은 뒤 송신 패스를 한 번만 돌려 적은 데이터그램으로 묶이게 합니다.
+	//          흐름 제어나 페이서에 막힌 패킷부터는 순서대로 보류 큐에 들어갑니다.
+	//          nullptr이거나 본문이 너무 큰 패킷이 하나라도 있으면 아무것도 보내지 않고 시퀀스도 쓰지 않은 채 false를 반환합니다.
+	// @param packets 보낼 순서대로 놓인 패킷들
+	// @return 모든 패킷을 전송 또는 보류했으면 true
+	// ----------------------------------------
+	bool SendPackets(std::span<IPacket* const> packets);
 
 	ThreadIdType GetThreadId() const;
 
@@ -64,6 +85,13 @@ private:
 	[[nodiscard]]
 	bool SendPacket(NetBuffer& buffer, PacketSequence inSendPacketSequence, bool isReplyType, bool isCorePacket);
 	// ----------------------------------------
+	// @brief 패킷을 전송하거나 흐름 제어에 의해 보류 큐에 넣습니다.
+	// @param isPushedToPendingQueue 즉시 전송되지 않고 보류 큐에 들어갔으면 true
+	// @return 전송 또는 보류에 성공하면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool SendPacket(NetBuffer& buffer, PacketSequence inSendPacketSequence, bool isReplyType, bool isCorePacket, OUT bool& isPushedToPendingQueue);
+	// ----------------------------------------
 	// @brief 보류 큐를 거치지 않고 패킷을 즉시 전송합니다.직접 RIO Send 작업을 예약합니다.
 	// @param buffer 전송할 NetBuffer.
 	// @param inSendPacketSequence 전송할 패킷의 시퀀스 번호.
@@ -74,11 +102,79 @@ private:
 	[[nodiscard]]
 	bool SendPacketImmediate(NetBuffer& buffer, PacketSequence inSendPacketSequence, bool isReplyType, bool isCorePacket);
 	// ----------------------------------------
+	// @brief GetSerializedSize()로 본문 크기를 알 수 있는 패킷이 PacketCryptoHelper::MAX_PACKET_BODY_SIZE를 넘는지 확인합니다.
+	// @return 크기를 모르거나 한도 안이면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	static bool IsSendablePacketBodySize(const IPacket& packet);
+	// ----------------------------------------
+	// @brief SendPackets를 MAX_SEND_PACKET_BATCH_SIZE개 이하씩 나눈 묶음 하나를 직렬화해 전송하거나 보류 큐에 넣습니다.
+	// @details 버퍼를 모두 잡은 뒤 시퀀스를 한 번에 예약하므로, 실패해도 시퀀스에 빈 번호가 생기지 않습니다. 실패 시 세션은 호출자가 끊습니다.
+	// @param packets MAX_SEND_PACKET_BATCH_SIZE개 이하의 패킷
+	// @param ackFrame 첫 패킷에 실을 ACK 프레임. 없으면 nullptr
+	// @param isAckSent ackFrame을 실은 패킷이 보류되지 않고 송신되었으면 true
+	// @return 모든 패킷을 전송 또는 보류했으면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool SendPacketBatch(std::span<IPacket* const> packets, const RUDPAckFrame* ackFrame, OUT bool& isAckSent);
+	// ----------------------------------------
+	// @brief 브로드캐스트로 한 번 직렬화한 본문에 이 세션의 헤더와 시퀀스를 붙여 암호화하지 않은 채 보류 큐에 넣습니다.
+	// @details 호출한 스레드에서는 암호화하거나 보내지 않습니다. 보류 큐가 비어 있었고 cwnd가 허용하면 needsFlushSchedule을 세우고,
+	//          호출자는 flushTime에 소유 IO worker가 보류 큐를 비우도록 예약해야 합니다. cwnd에 막혔으면 다음 ACK가 비우므로 예약하지 않습니다.
+	//          보류 큐가 가득 차 있으면 시퀀스를 쓰지 않고 연결을 유지한 채 false를 반환합니다. 버퍼를 할당하지 못하면 세션을 끊습니다.
+	// @param sharedBody 패킷 ID와 본문이 들어 있는 공유 버퍼. 읽기 위치는 옮기지 않습니다.
+	// @param needsFlushSchedule 이미 예약된 flush가 없어 새로 예약해야 하면 true
+	// @param flushTime needsFlushSchedule이 true일 때 flush할 시각. 페이서가 허용하면 지금, 아니면 다음 출발 시각입니다.
+	// @return 보류 큐에 넣었으면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool EnqueueBroadcastBody(NetBuffer& sharedBody, OUT bool& needsFlushSchedule, OUT std::chrono::steady_clock::time_point& flushTime);
+	// ----------------------------------------
+	// @brief 보류 큐를 거치지 않는 일반 패킷 여러 개를 송신 큐에 넣고 송신 패스를 돌립니다.
+	// @details 송신 정보를 스택 배열에 모아 송신 패스를 한 번 돌립니다.
+	//          실패하면 아직 넘기지 못한 버퍼는 모두 정리됩니다.
+	// @param sendBuffers 시퀀스 순서대로 놓인 시퀀스와 버퍼 쌍. MAX_SEND_PACKET_BATCH_SIZE개 이하여야 합니다.
+	// @return 모든 패킷이 송신 큐에 들어가고 송신 패스가 성공하면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool SendPacketsImmediate(std::span<const std::pair<PacketSequence, NetBuffer*>> sendBuffers);
+	// ----------------------------------------
+	// @brief 송신 정보를 할당해 재전송 목록에 등록하고 패킷을 암호화합니다.
+	// @return 할당에 실패하면 버퍼를 해제하고 nullptr
+	// ----------------------------------------
+	[[nodiscard]]
+	SendPacketInfo* PrepareSendPacketInfo(NetBuffer& buffer, PacketSequence inSendPacketSequence, bool isReplyType, bool isCorePacket);
+	// ----------------------------------------
+	// @brief 코어에 넘기지 못한 송신 정보를 재전송 목록에서 지우고 해제합니다.
+	// ----------------------------------------
+	void DiscardSendPacketInfo(SendPacketInfo* sendPacketInfo, PacketSequence inSendPacketSequence, bool isReplyType);
+	// ----------------------------------------
 	// @brief 플로우 제어에 의해 보류된 패킷들을 전송 가능한지 확인하고 전송을 시도합니다.
+	// @details 페이서가 막은 패킷이 남으면 다음 출발 시각에 IO worker가 다시 호출하도록 예약합니다.
 	// ----------------------------------------
 	void TryFlushPendingQueue();
+	// ----------------------------------------
+	// @brief 페이서가 막은 보류 패킷이 있으면 다음 출발 시각에 깨워 달라고 IO worker에 예약합니다.
+	// @details 보류 큐 잠금을 잡은 상태에서 호출해야 합니다.
+	// @param now 현재 시각
+	// ----------------------------------------
+	void SchedulePacedFlush(std::chrono::steady_clock::time_point now);
+	// ----------------------------------------
+	// @brief flush 예약 표시를 지웁니다. 예약을 걸지 못했을 때도 호출해 다음 예약을 막지 않게 합니다.
+	// ----------------------------------------
+	void ClearPacedFlushSchedule();
+	// ----------------------------------------
+	// @brief 예약한 출발 시각이 되어 IO worker가 호출합니다. 예약 표시를 지우고 보류 큐를 다시 비웁니다.
+	// ----------------------------------------
+	void OnPacedSendDue();
 
 	void SendHeartbeatPacket(const unsigned long long now);
+	// ----------------------------------------
+	// @brief 탐색 중인 경로 MTU가 있으면 패딩을 채운 MTU_PROBE_TYPE 패킷을 보냅니다.
+	// @details 프로브는 재전송 대상이 아니며, 응답이 없으면 PathMtuProber가 타임아웃으로 실패 처리합니다.
+	// @param now 현재 시간 (밀리초)
+	// ----------------------------------------
+	void TrySendPathMtuProbe(unsigned long long now);
 	void RefreshLastReceivedPacketTime(unsigned long long now);
 	[[nodiscard]]
 	bool NeedToSendHeartbeat(unsigned long long now) const;
@@ -123,10 +219,11 @@ private:
 	RecvBuffer& GetRecvBuffer();
 
 	void RecvContextReset();
-	std::shared_ptr<IOContext> GetRecvBufferContext() const;
 
 	RIO_RQ GetRecvRIORQ() const;
 	RIO_RQ GetSendRIORQ() const;
+	[[nodiscard]]
+	const RIO_BUF& GetClientAddressRIOBuffer() const;
 
 private:
 	bool TryConnect(NetBuffer& recvPacket, const sockaddr_in& inClientAddr);
@@ -143,8 +240,35 @@ private:
 	bool ProcessPacket(NetBuffer& recvPacket, PacketSequence recvPacketSequence);
 	[[nodiscard]]
 	static bool IsOlderRecvSequence(PacketSequence sequence, PacketSequence expectedSequence) noexcept;
-	void SendReplyToClient(PacketSequence recvPacketSequence);
+	// ----------------------------------------
+	// @brief 현재 수신 윈도우 상태로 누적 ACK와 SACK 구간을 담은 응답을 클라이언트에 보냅니다.
+	// ----------------------------------------
+	void SendReplyToClient();
+	// ----------------------------------------
+	// @brief 순서대로 처리된 패킷에 대한 응답을 지연 ACK 정책에 따라 보내거나 수신 로직 스레드에 예약합니다.
+	// ----------------------------------------
+	void SendOrDelayReplyToClient();
+	// ----------------------------------------
+	// @brief 미룬 응답의 기한이 지났으면 응답을 보냅니다. 세션의 수신 로직 스레드에서만 호출해야 합니다.
+	// @param now 현재 시간 (밀리초)
+	// ----------------------------------------
+	void FlushDelayedAck(unsigned long long now);
+	// ----------------------------------------
+	// @brief 클라이언트의 ACK 프레임이 덮는 송신 패킷 정보를 한 번에 제거합니다.
+	// @param recvPacket 복호화된 응답 패킷 (응답 시퀀스부터 읽습니다)
+	// ----------------------------------------
 	void OnSendReply(NetBuffer& recvPacket);
+	// ----------------------------------------
+	// @brief 응답 패킷이나 SEND_TYPE 헤더에 실려 온 ACK 프레임을 송신 상태에 반영합니다.
+	// @param ackFrame 검증된 ACK 프레임
+	// ----------------------------------------
+	void OnAckFrameReceived(const RUDPAckFrame& ackFrame);
+	// ----------------------------------------
+	// @brief ACK 프레임 기준으로 손실로 판단된 패킷을 재전송 기한 전에 다시 보냅니다.
+	// @param ackFrame 덮는 항목이 이미 제거된 ACK 프레임
+	// ----------------------------------------
+	void FastRetransmitLostPackets(const RUDPAckFrame& ackFrame);
+	void OnPathMtuProbeReply(NetBuffer& recvPacket);
 	void OnRetransmissionTimeout() noexcept;
 	void OnRttSample(std::chrono::steady_clock::duration sample);
 
@@ -193,6 +317,12 @@ public:
 	[[nodiscard]]
 	unsigned int GetRetransmissionTimeoutMs() const noexcept;
 	// ----------------------------------------
+	// @brief 송신 스트림을 나눌 때 사용할 데이터그램 크기 예산을 반환합니다.
+	// @return PLPMTUD로 확인된 데이터그램 크기 (바이트)
+	// ----------------------------------------
+	[[nodiscard]]
+	unsigned int GetDatagramSizeBudget() const noexcept;
+	// ----------------------------------------
 	// @brief 현재 세션의 상태를 반환합니다.
 	// @return 현재 세션의 SESSION_STATE 값
 	// ----------------------------------------
@@ -204,43 +334,102 @@ public:
 	uint32_t GetSessionGeneration() const;
 
 protected:
-	using PacketFactory = std::function<std::function<bool()>(RUDPSession*, NetBuffer*)>;
+	// ----------------------------------------
+	// @brief 패킷 ID를 인덱스로 바로 찾는 핸들러 항목입니다.
+	// @details 등록한 멤버 함수 포인터를 그대로 담아 두고, 패킷 타입별로 만들어진 invoker가 꺼내 호출합니다.
+	//          invoker는 패킷을 읽지 못해 핸들러를 부르지 못했을 때 false를 반환합니다.
+	// ----------------------------------------
+	struct PacketHandlerEntry
+	{
+		static constexpr size_t HANDLER_STORAGE_SIZE = 4 * sizeof(void*);
+		using Invoker = bool (*)(RUDPSession& session, NetBuffer& buffer, const PacketHandlerEntry& entry);
 
-	[[nodiscard]]
-	static std::shared_ptr<IPacket> BufferToPacket(NetBuffer& buffer, const PacketId packetId)
+		Invoker invoker{};
+		alignas(std::max_align_t) std::byte handlerStorage[HANDLER_STORAGE_SIZE]{};
+	};
+
+	// ----------------------------------------
+	// @brief 패킷을 스레드별 재사용 객체에 풀어 등록된 멤버 함수를 직접 호출합니다.
+	// @details 패킷 객체를 매번 할당하지 않으므로, 문자열 같은 가변 필드도 이전에 잡은 용량을 다시 씁니다.
+	//          핸들러는 호출 동안에만 패킷을 참조해야 합니다.
+	// ----------------------------------------
+	template <typename DerivedType, typename PacketType>
+	static bool InvokePacketHandler(RUDPSession& session, NetBuffer& buffer, const PacketHandlerEntry& entry)
 	{
-		std::shared_ptr<IPacket> packet = PacketManager::GetInst().MakePacket(packetId);
-		if (packet != nullptr)
+		void (DerivedType::* func)(const PacketType&) = nullptr;
+		std::memcpy(&func, entry.handlerStorage, sizeof(func));
+
+		thread_local PacketType packet;
+		packet.BufferToPacket(buffer);
+		(static_cast<DerivedType&>(session).*func)(packet);
+		return true;
+	}
+
+	// ----------------------------------------
+	// @brief 수신 버퍼를 가리키는 패킷 뷰를 만들어 등록된 멤버 함수를 호출합니다.
+	// @details 뷰는 필드 길이를 한 번 확인한 뒤 문자열을 복사하지 않고 수신 버퍼를 가리킵니다.
+	//          길이가 맞지 않으면 핸들러를 부르지 않고 false를 반환합니다.
+	// ----------------------------------------
+	template <typename DerivedType, typename ViewType>
+	static bool InvokePacketViewHandler(RUDPSession& session, NetBuffer& buffer, const PacketHandlerEntry& entry)
+	{
+		void (DerivedType::* func)(const ViewType&) = nullptr;
+		std::memcpy(&func, entry.handlerStorage, sizeof(func));
+
+		ViewType view;
+		if (not view.Parse(buffer))
 		{
-			packet->BufferToPacket(buffer);
+			return false;
 		}
 
-		return packet;
+		(static_cast<DerivedType&>(session).*func)(view);
+		return true;
 	}
 
 	template <typename DerivedType, typename PacketType>
 	void RegisterPacketHandler(const PacketId packetId, void (DerivedType::* func)(const PacketType&))
 	{
 		static_assert(std::is_base_of_v<IPacket, PacketType>, "PacketType must be derived from IPacket");
-		packetFactoryMap[packetId] = [func, packetId](RUDPSession* session, NetBuffer* buffer)
-			-> std::function<bool()>
-			{
-				DerivedType* derived = static_cast<DerivedType*>(session);
-				if (auto packet = BufferToPacket(*buffer, packetId); packet != nullptr)
-				{
-					return [derived, func, packet]()
-						{
-							(derived->*func)(static_cast<PacketType&>(*packet));
-							return true;
-						};
-				}
-
-				return []() { return false; };
-			};
+		static_assert(std::is_base_of_v<RUDPSession, DerivedType>, "DerivedType must be derived from RUDPSession");
+		static_assert(sizeof(func) <= PacketHandlerEntry::HANDLER_STORAGE_SIZE, "Member function pointer does not fit in PacketHandlerEntry");
+
+		if (packetId >= packetHandlerTable.size())
+		{
+			packetHandlerTable.resize(static_cast<size_t>(packetId) + 1);
+		}
+
+		PacketHandlerEntry& entry = packetHandlerTable[packetId];
+		entry.invoker = &InvokePacketHandler<DerivedType, PacketType>;
+		std::memcpy(entry.handlerStorage, &func, sizeof(func));
+	}
+
+	// ----------------------------------------
+	// @brief 패킷 객체 대신 생성기가 만든 뷰 타입(XxxView)을 받는 핸들러를 등록합니다.
+	// @details 문자열이 큰 패킷처럼 복사 비용이 큰 패킷에 선택해서 씁니다.
+	//          핸들러가 받은 뷰는 호출이 끝나면 가리키던 수신 버퍼가 반환되므로, 보관하려면 필요한 필드를 복사해야 합니다.
+	// @param packetId 등록할 패킷 ID
+	// @param func 뷰를 받는 멤버 함수
+	// ----------------------------------------
+	template <typename DerivedType, typename ViewType>
+	void RegisterPacketViewHandler(const PacketId packetId, void (DerivedType::* func)(const ViewType&))
+	{
+		static_assert(requires(ViewType view, NetBuffer& buffer) { { view.Parse(buffer) } -> std::same_as<bool>; }, "ViewType must provide bool Parse(NetBuffer&)");
+		static_assert(std::is_base_of_v<RUDPSession, DerivedType>, "DerivedType must be derived from RUDPSession");
+		static_assert(sizeof(func) <= PacketHandlerEntry::HANDLER_STORAGE_SIZE, "Member function pointer does not fit in PacketHandlerEntry");
+
+		if (packetId >= packetHandlerTable.size())
+		{
+			packetHandlerTable.resize(static_cast<size_t>(packetId) + 1);
+		}
+
+		PacketHandlerEntry& entry = packetHandlerTable[packetId];
+		entry.invoker = &InvokePacketViewHandler<DerivedType, ViewType>;
+		std::memcpy(entry.handlerStorage, &func, sizeof(func));
 	}
 
 private:
-	std::unordered_map<PacketId, PacketFactory> packetFactoryMap;
+	// 패킷 ID는 생성기가 0부터 차례로 매기므로 ID를 그대로 인덱스로 씁니다.
+	std::vector<PacketHandlerEntry> packetHandlerTable;
 
 private:
 	SessionIdType sessionId = INVALID_SESSION_ID;
@@ -282,6 +471,10 @@ private:
 private:
 	RUDPFlowManager flowManager;
 	RetransmissionTimeoutEstimator retransmissionTimeoutEstimator;
+	PathMtuProber pathMtuProber;
+	DelayedAckTracker delayedAckTracker;
+	// 보류 큐 잠금 안에서만 접근합니다.
+	SessionPacer sendPacer;
 	SessionCryptoContext cryptoContext;
 	SessionPacketOrderer sessionPacketOrderer;
 	SessionSocketContext socketContext;
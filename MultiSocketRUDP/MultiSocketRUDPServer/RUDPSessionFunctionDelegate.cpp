@@ -58,6 +58,11 @@ void RUDPSessionFunctionDelegate::OnSendReply(RUDPSession& session, NetBuffer& r
 	session.OnSendReply(recvPacket);
 }
 
+void RUDPSessionFunctionDelegate::OnPathMtuProbeReply(RUDPSession& session, NetBuffer& recvPacket)
+{
+	session.OnPathMtuProbeReply(recvPacket);
+}
+
 bool RUDPSessionFunctionDelegate::OnRecvPacket(RUDPSession& session, NetBuffer& recvPacket)
 {
 	return session.OnRecvPacket(recvPacket);
@@ -68,14 +73,24 @@ void RUDPSessionFunctionDelegate::RefreshLastRecvPacketTime(RUDPSession& session
 	session.RefreshLastReceivedPacketTime(now);
 }
 
-std::shared_ptr<IOContext> RUDPSessionFunctionDelegate::GetRecvBufferContext(const RUDPSession& session)
+RIO_BUFFERID RUDPSessionFunctionDelegate::GetSendBufferId(const RUDPSession& session)
 {
-	return session.GetRecvBufferContext();
+	return session.GetSendContext().GetSendBufferId();
 }
 
-RIO_BUFFERID RUDPSessionFunctionDelegate::GetSendBufferId(const RUDPSession& session)
+ULONG RUDPSessionFunctionDelegate::GetSendBufferOffset(const RUDPSession& session)
 {
-	return session.GetSendContext().GetSendBufferId();
+	return session.GetSendContext().GetSendBufferOffset();
+}
+
+bool RUDPSessionFunctionDelegate::AcquireSendBuffer(RUDPSession& session)
+{
+	return session.GetSendContext().AcquireSendBuffer();
+}
+
+void RUDPSessionFunctionDelegate::ReleaseSendBuffer(RUDPSession& session)
+{
+	session.GetSendContext().ReleaseSendBuffer();
 }
 
 std::atomic<IO_MODE>& RUDPSessionFunctionDelegate::GetSendIOMode(RUDPSession& session)
@@ -83,6 +98,21 @@ std::atomic<IO_MODE>& RUDPSessionFunctionDelegate::GetSendIOMode(RUDPSession& se
 	return session.GetSendContext().GetIOMode();
 }
 
+std::atomic_uint& RUDPSessionFunctionDelegate::GetSendDatagramsInFlight(RUDPSession& session)
+{
+	return session.GetSendContext().GetSendDatagramsInFlight();
+}
+
+std::atomic_bool& RUDPSessionFunctionDelegate::GetDeferredSendCommitPending(RUDPSession& session)
+{
+	return session.GetSendContext().GetDeferredSendCommitPending();
+}
+
+unsigned int RUDPSessionFunctionDelegate::GetDatagramSizeBudget(const RUDPSession& session)
+{
+	return session.GetDatagramSizeBudget();
+}
+
 bool RUDPSessionFunctionDelegate::IsSendPacketInfoQueueEmpty(RUDPSession& session)
 {
 	return session.GetSendContext().IsSendPacketInfoQueueEmpty();
@@ -106,9 +136,9 @@ bool RUDPSessionFunctionDelegate::IsNothingToSend(RUDPSession& session)
 	return session.GetSendContext().IsNothingToSend();
 }
 
-std::set<MultiSocketRUDP::PacketSequenceSetKey>& RUDPSessionFunctionDelegate::GetCachedSequenceSet(RUDPSession& session)
+SendSequenceBitmap& RUDPSessionFunctionDelegate::GetSendSequenceBitmap(RUDPSession& session)
 {
-	return session.GetSendContext().GetCachedSequenceSet();
+	return session.GetSendContext().GetSendSequenceBitmap();
 }
 
 size_t RUDPSessionFunctionDelegate::GetSendPacketInfoQueueSize(RUDPSession& session)
@@ -181,6 +211,11 @@ RIO_RQ RUDPSessionFunctionDelegate::GetSendRIORQ(const RUDPSession& session)
 	return session.GetSendRIORQ();
 }
 
+const RIO_BUF& RUDPSessionFunctionDelegate::GetClientAddressRIOBuffer(const RUDPSession& session)
+{
+	return session.GetClientAddressRIOBuffer();
+}
+
 const unsigned char* RUDPSessionFunctionDelegate::GetSessionKey(const RUDPSession& session)
 {
 	return session.GetCryptoContext().GetSessionKey();
@@ -3,11 +3,7 @@
 #include <shared_mutex>
 #include "NetServerSerializeBuffer.h"
 
-namespace MultiSocketRUDP
-{
-	struct PacketSequenceSetKey;
-}
-
+class SendSequenceBitmap;
 struct RecvBuffer;
 struct SendPacketInfo;
 enum class IO_MODE : unsigned int;
@@ -54,20 +50,26 @@ private:
 	bool TryConnect(RUDPSession& session, NetBuffer& recvPacket, const sockaddr_in& clientAddr) override;
 	bool CanProcessPacket(const RUDPSession& session, const sockaddr_in& clientAddr) override;
 	void OnSendReply(RUDPSession& session, NetBuffer& recvPacket) override;
+	void OnPathMtuProbeReply(RUDPSession& session, NetBuffer& recvPacket) override;
 	bool OnRecvPacket(RUDPSession& session, NetBuffer& recvPacket) override;
 	void RefreshLastRecvPacketTime(RUDPSession& session, unsigned long long now) override;
 #pragma endregion For RUDPPacketProcessor
 
 #pragma region For RUDPIOHandler
-	std::shared_ptr<IOContext> GetRecvBufferContext(const RUDPSession& session) override;
 	RIO_BUFFERID GetSendBufferId(const RUDPSession& session) override;
+	ULONG GetSendBufferOffset(const RUDPSession& session) override;
+	bool AcquireSendBuffer(RUDPSession& session) override;
+	void ReleaseSendBuffer(RUDPSession& session) override;
 	std::atomic<IO_MODE>& GetSendIOMode(RUDPSession& session) override;
+	std::atomic_uint& GetSendDatagramsInFlight(RUDPSession& session) override;
+	std::atomic_bool& GetDeferredSendCommitPending(RUDPSession& session) override;
+	unsigned int GetDatagramSizeBudget(const RUDPSession& session) override;
 	bool IsSendPacketInfoQueueEmpty(RUDPSession& session) override;
 	SendPacketInfo* TryGetFrontAndPop(RUDPSession& session) override;
 	SendPacketInfo* GetReservedSendPacketInfo(RUDPSession& session) override;
 	SendPacketInfo* TakeReservedSendPacketInfo(RUDPSession& session) override;
 	bool IsNothingToSend(RUDPSession& session) override;
-	std::set<MultiSocketRUDP::PacketSequenceSetKey>& GetCachedSequenceSet(RUDPSession& session) override;
+	SendSequenceBitmap& GetSendSequenceBitmap(RUDPSession& session) override;
 	size_t GetSendPacketInfoQueueSize(RUDPSession& session) override;
 	char* GetRIOSendBuffer(RUDPSession& session) override;
 	void SetReservedSendPacketInfo(RUDPSession& session, SendPacketInfo* reserveSendPacketInfo) override;
@@ -88,6 +90,7 @@ private:
 	SOCKET GetSocket(const RUDPSession& session) override;
 	RIO_RQ GetRecvRIORQ(const RUDPSession& session) override;
 	RIO_RQ GetSendRIORQ(const RUDPSession& session) override;
+	const RIO_BUF& GetClientAddressRIOBuffer(const RUDPSession& session) override;
 	const unsigned char* GetSessionKey(const RUDPSession& session) override;
 	void SetSessionKey(RUDPSession& session, const unsigned char* inSessionKey) override;
 	const unsigned char* GetSessionSalt(const RUDPSession& session) override;
@@ -2,46 +2,150 @@
 #include "IOContext.h"
 #include "Queue.h"
 #include "NetServerSerializeBuffer.h"
+#include "RecvDepthController.h"
+#include "RecvSlotPool.h"
 #include "../Common/etc/CoreType.h"
-#include <array>
 #include <atomic>
 #include <cassert>
 
-struct RecvBufferSlot
-{
-    std::shared_ptr<IOContext> recvContext{};
-    char buffer[RECV_BUFFER_SIZE];
-};
+class RUDPSession;
 
 struct RecvBuffer
 {
-    std::array<RecvBufferSlot, RECV_OUTSTANDING_COUNT> slots{};
+    RecvSlotPool* slotPool{};
+    SessionIdType ownerSessionId{ INVALID_SESSION_ID };
+    RUDPSession* ownerSession{};
     CListBaseQueue<IOContext*> freeRecvContexts;
     std::atomic_uint32_t outstandingRecvIo{};
     std::atomic_uint32_t pendingRecvLogic{};
+    std::atomic_uint32_t lentRecvSlotCount{};
+    std::atomic_uint32_t heldRecvSlotCount{};
+    RecvDepthController depthController;
 
+    // ----------------------------------------
+    // @brief Returns a receive context to post while fewer receives than the target depth are outstanding.
+    // @details Slots this buffer already holds are reused first. Otherwise a slot is taken from the
+    //          worker's RecvSlotPool and bound to the owning session. Slots that are not lent never exceed
+    //          RECV_OUTSTANDING_COUNT, so the request queue cannot overflow when DoRecv() races itself.
+    // @return nullptr when the target depth is reached or no slot is available.
+    // ----------------------------------------
     IOContext* AcquireFreeRecvContext()
     {
+        if (outstandingRecvIo.load(std::memory_order_acquire) >= depthController.GetTargetDepth())
+        {
+            return nullptr;
+        }
+
         IOContext* context = nullptr;
-        if (not freeRecvContexts.Dequeue(&context))
+        if (freeRecvContexts.Dequeue(&context))
+        {
+            return context;
+        }
+
+        if (slotPool == nullptr)
         {
             return nullptr;
         }
 
+        if (heldRecvSlotCount.fetch_add(1, std::memory_order_acq_rel) >=
+            RECV_OUTSTANDING_COUNT + lentRecvSlotCount.load(std::memory_order_acquire) ||
+            (context = slotPool->Acquire()) == nullptr)
+        {
+            heldRecvSlotCount.fetch_sub(1, std::memory_order_acq_rel);
+            return nullptr;
+        }
+
+        context->InitContext(ownerSessionId, RIO_OPERATION_TYPE::OP_RECV);
+        context->session = ownerSession;
+        context->ownerRecvBuffer = this;
         return context;
     }
 
+    // ----------------------------------------
+    // @brief Keeps an idle receive context for the next post, or gives it back to the pool
+    //        when this buffer holds more slots than its target depth needs.
+    // ----------------------------------------
     void ReleaseRecvContext(IOContext* context)
     {
+        if (slotPool != nullptr &&
+            heldRecvSlotCount.load(std::memory_order_acquire) >
+            depthController.GetTargetDepth() + lentRecvSlotCount.load(std::memory_order_acquire))
+        {
+            ReturnRecvSlotToPool(context);
+            return;
+        }
+
         freeRecvContexts.Enqueue(context);
     }
 
+    // ----------------------------------------
+    // @brief Drops every idle slot, giving pool-backed slots back to the pool. Called once the buffer is drained.
+    // ----------------------------------------
     void ClearFreeRecvContexts()
     {
-        IOContext* drained = nullptr;
-        while (freeRecvContexts.Dequeue(&drained))
+        IOContext* context = nullptr;
+        while (freeRecvContexts.Dequeue(&context))
         {
+            if (slotPool != nullptr)
+            {
+                ReturnRecvSlotToPool(context);
+            }
         }
+        assert(slotPool == nullptr || heldRecvSlotCount.load(std::memory_order_acquire) == 0);
+    }
+
+    void ReturnRecvSlotToPool(IOContext* context)
+    {
+        heldRecvSlotCount.fetch_sub(1, std::memory_order_acq_rel);
+        slotPool->Release(context);
+    }
+
+    // ----------------------------------------
+    // @brief Lends a completed receive slot to the logic workers unless too many are lent already.
+    // @details On success the completion itself holds the first reference, released by ReleaseRecvSlot().
+    //          DoRecv() takes replacement slots from the pool, so lent slots do not lower the posted depth;
+    //          the cap only bounds how many pool slots one session can pin.
+    // @return true when the slot was lent, false when the packets must be copied instead.
+    // ----------------------------------------
+    [[nodiscard]]
+    bool TryLendRecvSlot(IOContext* context)
+    {
+        const auto previous = lentRecvSlotCount.fetch_add(1, std::memory_order_acq_rel);
+        if (previous >= RECV_OUTSTANDING_COUNT - RECV_MIN_POSTED_SLOT_COUNT)
+        {
+            lentRecvSlotCount.fetch_sub(1, std::memory_order_acq_rel);
+            return false;
+        }
+
+        context->recvSlotBorrowCount.store(1, std::memory_order_release);
+        return true;
+    }
+
+    // ----------------------------------------
+    // @brief Adds one packet view that points into a lent receive slot.
+    // ----------------------------------------
+    void BorrowRecvSlot(IOContext* context)
+    {
+        const auto previous = context->recvSlotBorrowCount.fetch_add(1, std::memory_order_acq_rel);
+        assert(previous > 0);
+    }
+
+    // ----------------------------------------
+    // @brief Drops one reference to a receive slot and returns it to the free queue with the last one.
+    // @details A slot that was never lent is returned immediately.
+    // ----------------------------------------
+    void ReleaseRecvSlot(IOContext* context)
+    {
+        if (context->recvSlotBorrowCount.load(std::memory_order_acquire) != 0)
+        {
+            if (context->recvSlotBorrowCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return;
+            }
+            lentRecvSlotCount.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        ReleaseRecvContext(context);
     }
 
     // ----------------------------------------
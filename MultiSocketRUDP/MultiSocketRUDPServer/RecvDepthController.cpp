@@ -0,0 +1,46 @@
+#include "PreCompile.h"
+#include "RecvDepthController.h"
+#include <algorithm>
+
+void RecvDepthController::Reset(const unsigned int initialDepth) noexcept
+{
+	targetDepth.store(std::clamp<unsigned int>(initialDepth, RECV_MIN_POSTED_SLOT_COUNT, RECV_OUTSTANDING_COUNT), std::memory_order_relaxed);
+	completionsInInterval = 0;
+	intervalStartTime = 0;
+}
+
+void RecvDepthController::OnRecvCompleted(const unsigned long long now) noexcept
+{
+	if (intervalStartTime == 0)
+	{
+		intervalStartTime = now;
+	}
+
+	++completionsInInterval;
+	const unsigned long long elapsed = now - intervalStartTime;
+	if (elapsed < RECV_DEPTH_ADJUST_INTERVAL_MS)
+	{
+		return;
+	}
+
+	// 오래 쉬다 온 완료는 지난 구간 전체에 나누어 셈하므로, 유휴 세션은 다음 완료에서 바로 줄어듭니다.
+	const unsigned long long completionsPerInterval = completionsInInterval / (elapsed / RECV_DEPTH_ADJUST_INTERVAL_MS);
+	unsigned int depth = targetDepth.load(std::memory_order_relaxed);
+	if (completionsPerInterval >= static_cast<unsigned long long>(depth) * RECV_DEPTH_GROW_COMPLETIONS_PER_SLOT)
+	{
+		depth = std::min<unsigned int>(depth * 2, RECV_OUTSTANDING_COUNT);
+	}
+	else if (completionsPerInterval < depth)
+	{
+		depth = std::max<unsigned int>(depth / 2, RECV_MIN_POSTED_SLOT_COUNT);
+	}
+	targetDepth.store(depth, std::memory_order_relaxed);
+
+	completionsInInterval = 0;
+	intervalStartTime = now;
+}
+
+unsigned int RecvDepthController::GetTargetDepth() const noexcept
+{
+	return targetDepth.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <atomic>
+#include "../Common/etc/CoreType.h"
+
+// ----------------------------------------
+// @brief 세션이 동시에 게시해 둘 수신 개수를 수신 완료 빈도에 맞춰 조절합니다.
+// @details RECV_DEPTH_ADJUST_INTERVAL_MS마다 구간의 완료 수를 보고, 게시한 슬롯 하나가 구간 안에
+//          RECV_DEPTH_GROW_COMPLETIONS_PER_SLOT번 이상 돌았으면 두 배로 늘리고, 한 번도 돌지 않았으면 반으로 줄입니다.
+//          깊이는 [RECV_MIN_POSTED_SLOT_COUNT, RECV_OUTSTANDING_COUNT] 범위를 벗어나지 않습니다.
+//          완료 기록은 세션의 IO worker에서만 하며, 목표 깊이는 다른 스레드의 DoRecv에서도 읽습니다.
+// ----------------------------------------
+class RecvDepthController
+{
+public:
+	// ----------------------------------------
+	// @brief 구간 집계를 비우고 목표 깊이를 initialDepth로 되돌립니다.
+	// ----------------------------------------
+	void Reset(unsigned int initialDepth) noexcept;
+
+	// ----------------------------------------
+	// @brief 수신 완료 하나를 기록하고, 구간이 끝났으면 목표 깊이를 다시 정합니다.
+	// @param now 현재 시간 (밀리초)
+	// ----------------------------------------
+	void OnRecvCompleted(unsigned long long now) noexcept;
+
+	[[nodiscard]]
+	unsigned int GetTargetDepth() const noexcept;
+
+private:
+	std::atomic_uint32_t targetDepth{ RECV_OUTSTANDING_COUNT };
+	unsigned int completionsInInterval{};
+	unsigned long long intervalStartTime{};
+};
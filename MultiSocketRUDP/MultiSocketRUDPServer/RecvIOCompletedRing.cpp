@@ -0,0 +1,77 @@
+#include "PreCompile.h"
+#include "RecvIOCompletedRing.h"
+#include <algorithm>
+#include <bit>
+
+RecvIOCompletedRing::RecvIOCompletedRing(const size_t inCapacity)
+	: slots(std::bit_ceil(std::max<size_t>(inCapacity, 2)))
+	, indexMask(slots.size() - 1)
+{
+}
+
+bool RecvIOCompletedRing::TryEnqueue(RecvIOCompletedContext* const context)
+{
+	const size_t currentTail = tail.load(std::memory_order_relaxed);
+	if (currentTail - cachedHead == slots.size())
+	{
+		// 소비자의 인덱스는 가득 찼다고 보일 때만 다시 읽어 캐시 라인 왕복을 줄입니다.
+		cachedHead = head.load(std::memory_order_acquire);
+		if (currentTail - cachedHead == slots.size())
+		{
+			droppedCount.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+	}
+
+	slots[currentTail & indexMask] = context;
+	tail.store(currentTail + 1, std::memory_order_release);
+	return true;
+}
+
+bool RecvIOCompletedRing::ShouldWakeConsumer()
+{
+	// tail 게시와 대기 표시 확인 사이의 순서를 PrepareWait()의 반대쪽 fence와 맞춰 깨우기를 놓치지 않습니다.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	return isConsumerWaiting.load(std::memory_order_relaxed) &&
+		isConsumerWaiting.exchange(false, std::memory_order_acq_rel);
+}
+
+size_t RecvIOCompletedRing::DequeueBatch(const std::span<RecvIOCompletedContext*> outContexts)
+{
+	const size_t currentHead = head.load(std::memory_order_relaxed);
+	if (currentHead == cachedTail)
+	{
+		cachedTail = tail.load(std::memory_order_acquire);
+		if (currentHead == cachedTail)
+		{
+			return 0;
+		}
+	}
+
+	const size_t count = std::min(cachedTail - currentHead, outContexts.size());
+	for (size_t i = 0; i < count; ++i)
+	{
+		outContexts[i] = slots[(currentHead + i) & indexMask];
+	}
+
+	head.store(currentHead + count, std::memory_order_release);
+	return count;
+}
+
+bool RecvIOCompletedRing::PrepareWait()
+{
+	isConsumerWaiting.store(true, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (tail.load(std::memory_order_relaxed) != head.load(std::memory_order_relaxed))
+	{
+		isConsumerWaiting.store(false, std::memory_order_relaxed);
+		return false;
+	}
+
+	return true;
+}
+
+void RecvIOCompletedRing::FinishWait()
+{
+	isConsumerWaiting.store(false, std::memory_order_relaxed);
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <atomic>
+#include <span>
+#include <vector>
+
+struct RecvIOCompletedContext;
+
+// ----------------------------------------
+// @brief IO worker 하나가 짝이 되는 recv logic worker 하나에 수신 완료를 넘기는 고정 크기 SPSC 링입니다.
+// @details 생산자(IO worker)와 소비자(logic worker)는 각자 자기 인덱스만 쓰므로 lock 없이 주고받습니다.
+//          소비자는 잠들기 직전에만 PrepareWait()로 알리고, 생산자는 그 표시를 본 경우에만 깨우기 신호를 보냅니다.
+//          따라서 logic worker가 이미 일하는 동안에는 패킷마다 커널 호출이 생기지 않습니다.
+// ----------------------------------------
+class RecvIOCompletedRing final
+{
+public:
+	// ----------------------------------------
+	// @param inCapacity 담을 수 있는 항목 수. 2의 거듭제곱으로 올려 잡습니다.
+	// ----------------------------------------
+	explicit RecvIOCompletedRing(size_t inCapacity);
+	~RecvIOCompletedRing() = default;
+	RecvIOCompletedRing(const RecvIOCompletedRing&) = delete;
+	RecvIOCompletedRing& operator=(const RecvIOCompletedRing&) = delete;
+	RecvIOCompletedRing(RecvIOCompletedRing&&) = delete;
+	RecvIOCompletedRing& operator=(RecvIOCompletedRing&&) = delete;
+
+public:
+	// ----------------------------------------
+	// @brief 생산자 전용. 항목 하나를 넣습니다.
+	// @return 링이 가득 차 넣지 못했으면 false
+	// ----------------------------------------
+	[[nodiscard]]
+	bool TryEnqueue(RecvIOCompletedContext* context);
+	// ----------------------------------------
+	// @brief 생산자 전용. TryEnqueue 뒤에 호출해, 소비자가 잠들었거나 잠들려는 중이면 한 번만 true를 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	bool ShouldWakeConsumer();
+
+	// ----------------------------------------
+	// @brief 소비자 전용. 쌓인 항목을 outContexts 크기까지 한 번에 꺼냅니다.
+	// @return 꺼낸 항목 수
+	// ----------------------------------------
+	[[nodiscard]]
+	size_t DequeueBatch(std::span<RecvIOCompletedContext*> outContexts);
+	// ----------------------------------------
+	// @brief 소비자 전용. 잠들겠다고 표시한 뒤 링을 다시 확인합니다.
+	// @return 비어 있어 잠들어도 되면 true. 그 사이 항목이 들어왔으면 표시를 거두고 false
+	// ----------------------------------------
+	[[nodiscard]]
+	bool PrepareWait();
+	// ----------------------------------------
+	// @brief 소비자 전용. 대기에서 깨어난 뒤 잠든 표시를 거둡니다.
+	// ----------------------------------------
+	void FinishWait();
+
+	[[nodiscard]]
+	size_t GetCapacity() const { return slots.size(); }
+	// ----------------------------------------
+	// @brief 링이 가득 차 넣지 못한 항목 수를 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	size_t GetDroppedCount() const { return droppedCount.load(std::memory_order_relaxed); }
+
+private:
+	static constexpr size_t CACHE_LINE_SIZE = 64;
+
+	std::vector<RecvIOCompletedContext*> slots;
+	size_t indexMask{};
+
+	// 생산자가 쓰는 값
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail{};
+	size_t cachedHead{};
+	std::atomic<size_t> droppedCount{};
+
+	// 소비자가 쓰는 값
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> head{};
+	size_t cachedTail{};
+
+	alignas(CACHE_LINE_SIZE) std::atomic_bool isConsumerWaiting{};
+};
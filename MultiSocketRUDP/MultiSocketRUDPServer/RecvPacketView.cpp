@@ -0,0 +1,82 @@
+#include "PreCompile.h"
+#include "RecvPacketView.h"
+#include "LogExtension.h"
+#include "Logger.h"
+#include "../Common/etc/CoreType.h"
+
+namespace
+{
+	thread_local const NetBuffer* borrowedPacketInDispatch = nullptr;
+}
+
+RecvPacketView::~RecvPacketView()
+{
+	Detach();
+}
+
+NetBuffer& RecvPacketView::Attach(char* packet, const unsigned int packetSize)
+{
+	Detach();
+
+	viewBuffer.Init();
+	ownedSerializeBuffer = viewBuffer.m_pSerializeBuffer;
+	viewBuffer.m_pSerializeBuffer = packet;
+	viewBuffer.m_iWrite = static_cast<WORD>(packetSize);
+
+	return viewBuffer;
+}
+
+void RecvPacketView::Detach() noexcept
+{
+	if (ownedSerializeBuffer == nullptr)
+	{
+		return;
+	}
+
+	viewBuffer.m_pSerializeBuffer = ownedSerializeBuffer;
+	ownedSerializeBuffer = nullptr;
+}
+
+bool RecvPacketView::IsAttached() const noexcept
+{
+	return ownedSerializeBuffer != nullptr;
+}
+
+RecvPacketView::DispatchScope::DispatchScope(const NetBuffer* borrowedPacket) noexcept
+	: previousBorrowedPacket(borrowedPacketInDispatch)
+{
+	borrowedPacketInDispatch = borrowedPacket;
+}
+
+RecvPacketView::DispatchScope::~DispatchScope()
+{
+	borrowedPacketInDispatch = previousBorrowedPacket;
+}
+
+NetBuffer* RecvPacketView::AcquireHoldingBuffer(NetBuffer& buffer)
+{
+	if (&buffer != borrowedPacketInDispatch)
+	{
+		NetBuffer::AddRefCount(&buffer);
+		return &buffer;
+	}
+
+	NetBuffer* holdingBuffer = NetBuffer::Alloc();
+	if (holdingBuffer == nullptr)
+	{
+		LOG_ERROR("RecvPacketView::AcquireHoldingBuffer() NetBuffer::Alloc() failed");
+		return nullptr;
+	}
+
+	if (memcpy_s(holdingBuffer->m_pSerializeBuffer, RECV_BUFFER_SIZE, buffer.m_pSerializeBuffer, buffer.m_iWrite) != 0)
+	{
+		NetBuffer::Free(holdingBuffer);
+		return nullptr;
+	}
+	holdingBuffer->m_iRead = buffer.m_iRead;
+	holdingBuffer->m_iWrite = buffer.m_iWrite;
+	holdingBuffer->m_iWriteLast = buffer.m_iWriteLast;
+	holdingBuffer->m_bIsEncoded = buffer.m_bIsEncoded;
+
+	return holdingBuffer;
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "NetServerSerializeBuffer.h"
+
+// ----------------------------------------
+// @brief 수신 슬롯에 들어 있는 패킷을 복사하지 않고 가리키는 NetBuffer 뷰입니다.
+// @details 뷰가 붙어 있는 동안 viewBuffer의 m_pSerializeBuffer는 수신 슬롯을 가리키며, 분리할 때 원래 버퍼로 되돌립니다.
+//          뷰는 풀에서 재사용되는 RecvIOCompletedContext에 들어 있으므로 패킷마다 할당하지 않습니다.
+//          뷰는 NetBuffer 풀에 속하지 않으므로 NetBuffer::AddRefCount/Free 대신 AcquireHoldingBuffer로 보관해야 합니다.
+// ----------------------------------------
+class RecvPacketView
+{
+public:
+	RecvPacketView() = default;
+	~RecvPacketView();
+	RecvPacketView(const RecvPacketView&) = delete;
+	RecvPacketView& operator=(const RecvPacketView&) = delete;
+
+	// ----------------------------------------
+	// @brief 수신 슬롯의 패킷 하나에 뷰를 붙입니다.
+	// @param packet 수신 슬롯 안의 패킷 시작 위치
+	// @param packetSize 헤더를 포함한 패킷 크기
+	// @return 패킷을 가리키는 NetBuffer
+	// ----------------------------------------
+	[[nodiscard]]
+	NetBuffer& Attach(char* packet, unsigned int packetSize);
+	// ----------------------------------------
+	// @brief 뷰를 수신 슬롯에서 떼고 원래 버퍼로 되돌립니다. 수신 슬롯을 반환하기 전에 호출해야 합니다.
+	// ----------------------------------------
+	void Detach() noexcept;
+	[[nodiscard]]
+	bool IsAttached() const noexcept;
+
+	// ----------------------------------------
+	// @brief 현재 logic worker가 처리 중인 패킷이 수신 슬롯을 빌린 뷰인지 표시합니다.
+	// @details 패킷 처리가 끝나면 슬롯이 반환되므로, 그 뒤에도 패킷을 보관하려는 쪽이 이 표시로 복사 여부를 정합니다.
+	// ----------------------------------------
+	class DispatchScope
+	{
+	public:
+		explicit DispatchScope(const NetBuffer* borrowedPacket) noexcept;
+		~DispatchScope();
+		DispatchScope(const DispatchScope&) = delete;
+		DispatchScope& operator=(const DispatchScope&) = delete;
+
+	private:
+		const NetBuffer* previousBorrowedPacket{};
+	};
+
+	// ----------------------------------------
+	// @brief 처리가 끝난 뒤에도 패킷을 들고 있어야 할 때 보관용 NetBuffer를 얻습니다.
+	// @details 수신 슬롯을 빌린 뷰면 새 NetBuffer로 읽기·쓰기 위치까지 복사하고, 그 외에는 참조 수를 늘려 같은 버퍼를 돌려줍니다.
+	//          어느 경우든 반환된 버퍼는 NetBuffer::Free로 해제합니다.
+	// @return 보관용 NetBuffer, 복사할 버퍼를 할당하지 못하면 nullptr
+	// ----------------------------------------
+	[[nodiscard]]
+	static NetBuffer* AcquireHoldingBuffer(NetBuffer& buffer);
+
+private:
+	NetBuffer viewBuffer;
+	char* ownedSerializeBuffer{};
+};
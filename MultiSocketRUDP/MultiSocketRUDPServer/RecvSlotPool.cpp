@@ -0,0 +1,121 @@
+#include "PreCompile.h"
+#include "RecvSlotPool.h"
+#include "LogExtension.h"
+#include "Logger.h"
+#include <algorithm>
+#include <memory>
+
+RecvSlotPool::RecvSlotPool(const RIO_EXTENSION_FUNCTION_TABLE& inRioFunctionTable)
+	: rioFunctionTable(inRioFunctionTable)
+{
+}
+
+RecvSlotPool::~RecvSlotPool()
+{
+	Cleanup();
+}
+
+bool RecvSlotPool::Initialize()
+{
+	std::scoped_lock guard(lock);
+	return chunks.empty() ? AddChunk() : true;
+}
+
+IOContext* RecvSlotPool::Acquire()
+{
+	std::scoped_lock guard(lock);
+	if (freeContexts.empty() && not AddChunk())
+	{
+		return nullptr;
+	}
+
+	IOContext* context = freeContexts.back();
+	freeContexts.pop_back();
+
+	highWaterMark = (std::max)(highWaterMark, chunks.size() * RECV_SLOT_POOL_CHUNK_SIZE - freeContexts.size());
+	return context;
+}
+
+void RecvSlotPool::Release(IOContext* context)
+{
+	context->session = nullptr;
+	context->ownerRecvBuffer = nullptr;
+
+	std::scoped_lock guard(lock);
+	freeContexts.push_back(context);
+}
+
+void RecvSlotPool::Cleanup()
+{
+	std::scoped_lock guard(lock);
+	assert(freeContexts.size() == chunks.size() * RECV_SLOT_POOL_CHUNK_SIZE);
+
+	for (auto& chunk : chunks)
+	{
+		std::destroy_n(chunk.slots, RECV_SLOT_POOL_CHUNK_SIZE);
+		chunk.region.Free(rioFunctionTable);
+	}
+	chunks.clear();
+	freeContexts.clear();
+}
+
+size_t RecvSlotPool::GetCapacity() const
+{
+	std::scoped_lock guard(lock);
+	return chunks.size() * RECV_SLOT_POOL_CHUNK_SIZE;
+}
+
+size_t RecvSlotPool::GetFreeCount() const
+{
+	std::scoped_lock guard(lock);
+	return freeContexts.size();
+}
+
+size_t RecvSlotPool::GetHighWaterMark() const
+{
+	std::scoped_lock guard(lock);
+	return highWaterMark;
+}
+
+bool RecvSlotPool::AddChunk()
+{
+	Chunk chunk;
+	if (not chunk.region.Allocate(rioFunctionTable, sizeof(RecvBufferSlot) * RECV_SLOT_POOL_CHUNK_SIZE))
+	{
+		LOG_ERROR(std::format("RecvSlotPool chunk allocation failed. capacity {}", chunks.size() * RECV_SLOT_POOL_CHUNK_SIZE));
+		return false;
+	}
+
+	char* const chunkBase = chunk.region.GetBase();
+	chunk.slots = reinterpret_cast<RecvBufferSlot*>(chunkBase);
+	std::uninitialized_default_construct_n(chunk.slots, RECV_SLOT_POOL_CHUNK_SIZE);
+
+	const auto offsetOf = [chunkBase](const char* address)
+		{
+			return static_cast<ULONG>(address - chunkBase);
+		};
+
+	freeContexts.reserve(freeContexts.size() + RECV_SLOT_POOL_CHUNK_SIZE);
+	for (unsigned int i = 0; i < RECV_SLOT_POOL_CHUNK_SIZE; ++i)
+	{
+		RecvBufferSlot& slot = chunk.slots[i];
+		IOContext& context = slot.recvContext;
+		context.InitContext(INVALID_SESSION_ID, RIO_OPERATION_TYPE::OP_RECV);
+		context.BufferId = chunk.region.GetBufferId();
+		context.Offset = offsetOf(slot.buffer);
+		context.Length = RECV_BUFFER_SIZE;
+		context.recvDataBuffer = slot.buffer;
+
+		context.clientAddrRIOBuffer.BufferId = chunk.region.GetBufferId();
+		context.clientAddrRIOBuffer.Offset = offsetOf(context.clientAddrBuffer);
+		context.clientAddrRIOBuffer.Length = sizeof(SOCKADDR_INET);
+		context.localAddrRIOBuffer.BufferId = chunk.region.GetBufferId();
+		context.localAddrRIOBuffer.Offset = offsetOf(context.localAddrBuffer);
+		context.localAddrRIOBuffer.Length = sizeof(SOCKADDR_INET);
+
+		freeContexts.push_back(&context);
+	}
+
+	chunks.push_back(chunk);
+	return true;
+}
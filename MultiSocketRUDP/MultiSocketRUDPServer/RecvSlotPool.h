@@ -0,0 +1,78 @@
+#pragma once
+#include <MSWSock.h>
+#include <mutex>
+#include <vector>
+#include "IOContext.h"
+#include "RegisteredBufferSlab.h"
+#include "../Common/etc/CoreType.h"
+
+struct RecvBufferSlot
+{
+	IOContext recvContext{};
+	char buffer[RECV_BUFFER_SIZE];
+};
+
+// ----------------------------------------
+// @brief IO worker 하나에 속한 세션들이 함께 쓰는 수신 슬롯 풀입니다.
+// @details 슬롯은 RECV_SLOT_POOL_CHUNK_SIZE개씩 묶음으로 만들고, 묶음 전체를 RegisteredBufferRegion 하나로 등록합니다.
+//          각 슬롯의 데이터·주소 RIO_BUF는 묶음 버퍼 안의 오프셋으로 미리 채워 두므로, 세션은 꺼낸 슬롯에 소유자만 기록해 바로 게시합니다.
+//          자유 슬롯이 없으면 묶음을 하나 더 만들며, 만든 묶음은 Cleanup()까지 해제하지 않습니다.
+// ----------------------------------------
+class RecvSlotPool
+{
+public:
+	explicit RecvSlotPool(const RIO_EXTENSION_FUNCTION_TABLE& inRioFunctionTable);
+	~RecvSlotPool();
+	RecvSlotPool(const RecvSlotPool&) = delete;
+	RecvSlotPool& operator=(const RecvSlotPool&) = delete;
+	RecvSlotPool(RecvSlotPool&&) = delete;
+	RecvSlotPool& operator=(RecvSlotPool&&) = delete;
+
+	// ----------------------------------------
+	// @brief 첫 묶음을 만들어 등록합니다.
+	// @return 등록에 성공하면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool Initialize();
+	// ----------------------------------------
+	// @brief 자유 슬롯 하나를 꺼냅니다. 자유 슬롯이 없으면 묶음을 하나 더 등록합니다.
+	// @return 슬롯의 수신 컨텍스트, 묶음 등록에 실패하면 nullptr
+	// ----------------------------------------
+	[[nodiscard]]
+	IOContext* Acquire();
+	// ----------------------------------------
+	// @brief 게시도 처리도 하지 않는 슬롯을 풀에 돌려줍니다.
+	// ----------------------------------------
+	void Release(IOContext* context);
+	// ----------------------------------------
+	// @brief 모든 묶음의 등록을 해제하고 메모리를 반환합니다. 모든 슬롯이 돌아온 뒤에 호출해야 합니다.
+	// ----------------------------------------
+	void Cleanup();
+
+	[[nodiscard]]
+	size_t GetCapacity() const;
+	[[nodiscard]]
+	size_t GetFreeCount() const;
+	// ----------------------------------------
+	// @brief 동시에 빌려 간 슬롯 수의 최댓값을 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	size_t GetHighWaterMark() const;
+
+private:
+	struct Chunk
+	{
+		RegisteredBufferRegion region;
+		RecvBufferSlot* slots{};
+	};
+
+	[[nodiscard]]
+	bool AddChunk();
+
+private:
+	RIO_EXTENSION_FUNCTION_TABLE rioFunctionTable{};
+	mutable std::mutex lock;
+	std::vector<Chunk> chunks;
+	std::vector<IOContext*> freeContexts;
+	size_t highWaterMark{};
+};
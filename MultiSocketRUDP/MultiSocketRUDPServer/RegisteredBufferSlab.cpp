@@ -0,0 +1,146 @@
+#include "PreCompile.h"
+#include "RegisteredBufferSlab.h"
+#include "LogExtension.h"
+#include "Logger.h"
+#include <algorithm>
+
+bool RegisteredBufferRegion::Allocate(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable, const size_t inSize)
+{
+	assert(base == nullptr);
+
+	// large page는 SeLockMemoryPrivilege가 있어야 잡히므로, 실패하면 일반 페이지로 다시 잡습니다.
+	if (const size_t largePageSize = GetLargePageMinimum(); largePageSize != 0 && inSize % largePageSize == 0)
+	{
+		base = static_cast<char*>(VirtualAlloc(nullptr, inSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE));
+		isLargePage = base != nullptr;
+	}
+
+	if (base == nullptr)
+	{
+		base = static_cast<char*>(VirtualAlloc(nullptr, inSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+		if (base == nullptr)
+		{
+			LOG_ERROR(std::format("RegisteredBufferRegion VirtualAlloc failed. size {}, error {}", inSize, GetLastError()));
+			return false;
+		}
+	}
+
+	bufferId = rioFunctionTable.RIORegisterBuffer(base, static_cast<DWORD>(inSize));
+	if (bufferId == RIO_INVALID_BUFFERID)
+	{
+		LOG_ERROR(std::format("RegisteredBufferRegion RIORegisterBuffer failed. size {}", inSize));
+		Free(rioFunctionTable);
+		return false;
+	}
+
+	return true;
+}
+
+void RegisteredBufferRegion::Free(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable)
+{
+	if (bufferId != RIO_INVALID_BUFFERID)
+	{
+		rioFunctionTable.RIODeregisterBuffer(bufferId);
+		bufferId = RIO_INVALID_BUFFERID;
+	}
+
+	if (base != nullptr)
+	{
+		VirtualFree(base, 0, MEM_RELEASE);
+		base = nullptr;
+	}
+	isLargePage = false;
+}
+
+RegisteredBufferSlab::RegisteredBufferSlab(const RIO_EXTENSION_FUNCTION_TABLE& inRioFunctionTable, const unsigned int inChunkSize, const unsigned int inChunksPerRegion)
+	: rioFunctionTable(inRioFunctionTable)
+	, chunkSize(inChunkSize)
+	, chunksPerRegion(inChunksPerRegion)
+{
+}
+
+RegisteredBufferSlab::~RegisteredBufferSlab()
+{
+	Cleanup();
+}
+
+bool RegisteredBufferSlab::Initialize()
+{
+	std::scoped_lock guard(lock);
+	return regions.empty() ? AddRegion() : true;
+}
+
+RegisteredBufferChunk RegisteredBufferSlab::Acquire()
+{
+	std::scoped_lock guard(lock);
+	if (freeChunks.empty() && not AddRegion())
+	{
+		return {};
+	}
+
+	const RegisteredBufferChunk chunk = freeChunks.back();
+	freeChunks.pop_back();
+
+	highWaterMark = (std::max)(highWaterMark, regions.size() * chunksPerRegion - freeChunks.size());
+	return chunk;
+}
+
+void RegisteredBufferSlab::Release(const RegisteredBufferChunk& chunk)
+{
+	assert(chunk.IsValid());
+
+	std::scoped_lock guard(lock);
+	freeChunks.push_back(chunk);
+}
+
+void RegisteredBufferSlab::Cleanup()
+{
+	std::scoped_lock guard(lock);
+	assert(freeChunks.size() == regions.size() * chunksPerRegion);
+
+	for (auto& region : regions)
+	{
+		region.Free(rioFunctionTable);
+	}
+	regions.clear();
+	freeChunks.clear();
+}
+
+size_t RegisteredBufferSlab::GetCapacity() const
+{
+	std::scoped_lock guard(lock);
+	return regions.size() * chunksPerRegion;
+}
+
+size_t RegisteredBufferSlab::GetInUseCount() const
+{
+	std::scoped_lock guard(lock);
+	return regions.size() * chunksPerRegion - freeChunks.size();
+}
+
+size_t RegisteredBufferSlab::GetHighWaterMark() const
+{
+	std::scoped_lock guard(lock);
+	return highWaterMark;
+}
+
+bool RegisteredBufferSlab::AddRegion()
+{
+	RegisteredBufferRegion region;
+	if (not region.Allocate(rioFunctionTable, static_cast<size_t>(chunkSize) * chunksPerRegion))
+	{
+		LOG_ERROR(std::format("RegisteredBufferSlab region allocation failed. capacity {}", regions.size() * chunksPerRegion));
+		return false;
+	}
+
+	freeChunks.reserve(freeChunks.size() + chunksPerRegion);
+	// 앞 조각부터 꺼내도록 뒤에서부터 쌓습니다.
+	for (unsigned int i = chunksPerRegion; i > 0; --i)
+	{
+		const ULONG offset = (i - 1) * chunkSize;
+		freeChunks.push_back({ region.GetBase() + offset, region.GetBufferId(), offset });
+	}
+
+	regions.push_back(region);
+	return true;
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include <MSWSock.h>
+#include <mutex>
+#include <vector>
+#include "../Common/etc/CoreType.h"
+
+// ----------------------------------------
+// @brief RIO에 한 번만 등록하는 큰 메모리 영역입니다.
+// @details 크기가 large page 최소 단위의 배수이면 large page로 먼저 잡아 보고, 권한이 없으면 일반 페이지로 잡습니다.
+//          등록 해제와 메모리 반환은 소유자가 Free()로 직접 합니다.
+// ----------------------------------------
+class RegisteredBufferRegion
+{
+public:
+	// ----------------------------------------
+	// @brief 영역을 잡아 RIO 버퍼로 등록합니다.
+	// @return 할당과 등록에 모두 성공하면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool Allocate(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable, size_t inSize);
+	// ----------------------------------------
+	// @brief 등록을 해제하고 영역을 반환합니다. 잡지 않은 영역이면 아무 일도 하지 않습니다.
+	// ----------------------------------------
+	void Free(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable);
+
+	[[nodiscard]]
+	char* GetBase() const { return base; }
+	[[nodiscard]]
+	RIO_BUFFERID GetBufferId() const { return bufferId; }
+	[[nodiscard]]
+	bool IsLargePage() const { return isLargePage; }
+
+private:
+	char* base{};
+	RIO_BUFFERID bufferId{ RIO_INVALID_BUFFERID };
+	bool isLargePage{};
+};
+
+// ----------------------------------------
+// @brief 슬랩에서 꺼낸 고정 크기 조각입니다. RIO_BUF는 bufferId와 offset으로 이 조각을 가리킵니다.
+// ----------------------------------------
+struct RegisteredBufferChunk
+{
+	char* buffer{};
+	RIO_BUFFERID bufferId{ RIO_INVALID_BUFFERID };
+	ULONG offset{};
+
+	[[nodiscard]]
+	bool IsValid() const { return buffer != nullptr; }
+};
+
+// ----------------------------------------
+// @brief IO worker 하나에 속한 세션들이 필요할 때만 빌려 쓰는 고정 크기 RIO 버퍼 슬랩입니다.
+// @details 영역 하나에 chunkSize 조각을 chunksPerRegion개 담아 한 번만 등록하고, 조각이 모자라면 영역을 하나 더 잡습니다.
+//          잡은 영역은 Cleanup()까지 유지하며, 동시에 빌려 간 조각 수의 최댓값을 high-water mark로 기록합니다.
+// ----------------------------------------
+class RegisteredBufferSlab
+{
+public:
+	RegisteredBufferSlab(const RIO_EXTENSION_FUNCTION_TABLE& inRioFunctionTable, unsigned int inChunkSize, unsigned int inChunksPerRegion);
+	~RegisteredBufferSlab();
+	RegisteredBufferSlab(const RegisteredBufferSlab&) = delete;
+	RegisteredBufferSlab& operator=(const RegisteredBufferSlab&) = delete;
+	RegisteredBufferSlab(RegisteredBufferSlab&&) = delete;
+	RegisteredBufferSlab& operator=(RegisteredBufferSlab&&) = delete;
+
+	// ----------------------------------------
+	// @brief 첫 영역을 잡아 등록합니다.
+	// @return 등록에 성공하면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool Initialize();
+	// ----------------------------------------
+	// @brief 자유 조각 하나를 꺼냅니다. 자유 조각이 없으면 영역을 하나 더 등록합니다.
+	// @return 꺼낸 조각, 영역 등록에 실패하면 IsValid()가 false인 조각
+	// ----------------------------------------
+	[[nodiscard]]
+	RegisteredBufferChunk Acquire();
+	// ----------------------------------------
+	// @brief 더 이상 RIO 요청이 읽지 않는 조각을 돌려줍니다.
+	// ----------------------------------------
+	void Release(const RegisteredBufferChunk& chunk);
+	// ----------------------------------------
+	// @brief 모든 영역의 등록을 해제하고 메모리를 반환합니다. 모든 조각이 돌아온 뒤에 호출해야 합니다.
+	// ----------------------------------------
+	void Cleanup();
+
+	[[nodiscard]]
+	unsigned int GetChunkSize() const { return chunkSize; }
+	[[nodiscard]]
+	size_t GetCapacity() const;
+	[[nodiscard]]
+	size_t GetInUseCount() const;
+	// ----------------------------------------
+	// @brief 동시에 빌려 간 조각 수의 최댓값을 반환합니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	size_t GetHighWaterMark() const;
+
+private:
+	[[nodiscard]]
+	bool AddRegion();
+
+private:
+	RIO_EXTENSION_FUNCTION_TABLE rioFunctionTable{};
+	const unsigned int chunkSize;
+	const unsigned int chunksPerRegion;
+
+	mutable std::mutex lock;
+	std::vector<RegisteredBufferRegion> regions;
+	std::vector<RegisteredBufferChunk> freeChunks;
+	size_t highWaterMark{};
+};
@@ -2,44 +2,46 @@
 
 #include <Windows.h>
 #include <chrono>
-#include <cstdint>
 #include <mutex>
-#include <queue>
-#include <vector>
 
+#include "RetransmissionTimingWheel.h"
 #include "SendPacketInfo.h"
 
-struct RetransmissionHeapEntry
-{
-	std::chrono::steady_clock::time_point deadline{};
-	uint64_t version{};
-	SendPacketInfo* info{};
-};
-
-struct RetransmissionHeapEntryGreater
-{
-	bool operator()(const RetransmissionHeapEntry& lhs, const RetransmissionHeapEntry& rhs) const noexcept
-	{
-		return lhs.deadline > rhs.deadline;
-	}
-};
-
 struct RetransmissionScheduler
 {
 	std::mutex lock;
-	std::priority_queue<RetransmissionHeapEntry, std::vector<RetransmissionHeapEntry>, RetransmissionHeapEntryGreater> heap;
+	RetransmissionTimingWheel wheel;
 	HANDLE timerHandle{};
 	HANDLE wakeEventHandle{};
 };
 
+// ----------------------------------------
+// @brief 재전송 기한을 등록합니다. 휠이 새로 참조하게 되면 참조 수를 하나 늘립니다.
+// @details scheduler.lock을 잡은 상태에서 호출해야 합니다. 이미 등록된 패킷은 새 기한으로 옮깁니다.
+// ----------------------------------------
 inline void PushRetransmissionSchedule(
 	OUT RetransmissionScheduler& scheduler,
 	OUT SendPacketInfo& sendPacketInfo,
 	const std::chrono::steady_clock::time_point deadline)
 {
-	++sendPacketInfo.scheduleVersion;
-	sendPacketInfo.AddRefCount();
-	scheduler.heap.push(RetransmissionHeapEntry{ deadline, sendPacketInfo.scheduleVersion, &sendPacketInfo });
+	if (not RetransmissionTimingWheel::IsScheduled(sendPacketInfo))
+	{
+		sendPacketInfo.AddRefCount();
+	}
+
+	scheduler.wheel.Schedule(sendPacketInfo, deadline);
+}
+
+// ----------------------------------------
+// @brief 등록된 재전송 기한을 취소하고 휠이 가진 참조를 돌려줍니다.
+// @details scheduler.lock을 잡은 상태에서 호출해야 합니다.
+// ----------------------------------------
+inline void CancelRetransmissionSchedule(OUT RetransmissionScheduler& scheduler, OUT SendPacketInfo& sendPacketInfo)
+{
+	if (scheduler.wheel.Cancel(sendPacketInfo))
+	{
+		SendPacketInfo::Free(&sendPacketInfo);
+	}
 }
 
 [[nodiscard]]
@@ -0,0 +1,167 @@
+#include "PreCompile.h"
+#include "RetransmissionTimingWheel.h"
+#include "SendPacketInfo.h"
+#include <algorithm>
+#include <bit>
+
+RetransmissionTimingWheel::RetransmissionTimingWheel(const std::chrono::milliseconds inTickDuration)
+	: tickDuration((std::max)(std::chrono::steady_clock::duration(inTickDuration), std::chrono::steady_clock::duration(1)))
+{
+}
+
+void RetransmissionTimingWheel::Schedule(SendPacketInfo& sendPacketInfo, const TimePoint deadline)
+{
+	if (IsScheduled(sendPacketInfo))
+	{
+		Unlink(sendPacketInfo);
+	}
+
+	Link(sendPacketInfo, (std::max)(ToTickCeil(deadline), currentTick + 1));
+}
+
+bool RetransmissionTimingWheel::Cancel(SendPacketInfo& sendPacketInfo) noexcept
+{
+	if (not IsScheduled(sendPacketInfo))
+	{
+		return false;
+	}
+
+	Unlink(sendPacketInfo);
+	return true;
+}
+
+void RetransmissionTimingWheel::PopExpired(const TimePoint now, OUT std::vector<SendPacketInfo*>& outExpired)
+{
+	const uint64_t nowTick = ToTickFloor(now);
+	if (nowTick <= currentTick)
+	{
+		return;
+	}
+
+	// 오래 쉬었다면 모든 슬롯을 한 번씩만 훑으면 충분합니다.
+	const uint64_t stepCount = (std::min)(nowTick - currentTick, static_cast<uint64_t>(SLOT_COUNT));
+	for (uint64_t step = 1; step <= stepCount && size > 0; ++step)
+	{
+		SendPacketInfo* node = slotHeads[(currentTick + step) & SLOT_MASK];
+		while (node != nullptr)
+		{
+			SendPacketInfo* next = node->retransmissionWheelLink.next;
+			if (node->retransmissionWheelLink.deadlineTick <= nowTick)
+			{
+				Unlink(*node);
+				outExpired.push_back(node);
+			}
+			node = next;
+		}
+	}
+
+	currentTick = nowTick;
+}
+
+bool RetransmissionTimingWheel::GetNextDeadline(OUT TimePoint& outDeadline) const noexcept
+{
+	if (size == 0)
+	{
+		return false;
+	}
+
+	uint64_t distance = 1;
+	while (distance <= SLOT_COUNT)
+	{
+		const size_t slot = (currentTick + distance) & SLOT_MASK;
+		const uint64_t bits = occupiedSlotBits[slot / BITS_PER_WORD] >> (slot % BITS_PER_WORD);
+		if (bits != 0)
+		{
+			outDeadline = ToTimePoint(currentTick + distance + std::countr_zero(bits));
+			return true;
+		}
+
+		distance += BITS_PER_WORD - slot % BITS_PER_WORD;
+	}
+
+	return false;
+}
+
+void RetransmissionTimingWheel::PopAll(OUT std::vector<SendPacketInfo*>& outItems)
+{
+	for (SendPacketInfo*& head : slotHeads)
+	{
+		while (head != nullptr)
+		{
+			SendPacketInfo* node = head;
+			Unlink(*node);
+			outItems.push_back(node);
+		}
+	}
+}
+
+bool RetransmissionTimingWheel::IsScheduled(const SendPacketInfo& sendPacketInfo) noexcept
+{
+	return sendPacketInfo.retransmissionWheelLink.isLinked;
+}
+
+size_t RetransmissionTimingWheel::GetSize() const noexcept
+{
+	return size;
+}
+
+uint64_t RetransmissionTimingWheel::ToTickFloor(const TimePoint timePoint) const noexcept
+{
+	return static_cast<uint64_t>(timePoint.time_since_epoch() / tickDuration);
+}
+
+uint64_t RetransmissionTimingWheel::ToTickCeil(const TimePoint timePoint) const noexcept
+{
+	const uint64_t tick = ToTickFloor(timePoint);
+	return timePoint.time_since_epoch() % tickDuration == std::chrono::steady_clock::duration::zero() ? tick : tick + 1;
+}
+
+RetransmissionTimingWheel::TimePoint RetransmissionTimingWheel::ToTimePoint(const uint64_t tick) const noexcept
+{
+	return TimePoint(tickDuration * tick);
+}
+
+void RetransmissionTimingWheel::Link(SendPacketInfo& sendPacketInfo, const uint64_t deadlineTick) noexcept
+{
+	const size_t slot = deadlineTick & SLOT_MASK;
+	auto& link = sendPacketInfo.retransmissionWheelLink;
+	link.deadlineTick = deadlineTick;
+	link.prev = nullptr;
+	link.next = slotHeads[slot];
+	link.isLinked = true;
+	if (link.next != nullptr)
+	{
+		link.next->retransmissionWheelLink.prev = &sendPacketInfo;
+	}
+
+	slotHeads[slot] = &sendPacketInfo;
+	occupiedSlotBits[slot / BITS_PER_WORD] |= uint64_t{ 1 } << (slot % BITS_PER_WORD);
+	++size;
+}
+
+void RetransmissionTimingWheel::Unlink(SendPacketInfo& sendPacketInfo) noexcept
+{
+	const size_t slot = sendPacketInfo.retransmissionWheelLink.deadlineTick & SLOT_MASK;
+	auto& link = sendPacketInfo.retransmissionWheelLink;
+	if (link.prev != nullptr)
+	{
+		link.prev->retransmissionWheelLink.next = link.next;
+	}
+	else
+	{
+		slotHeads[slot] = link.next;
+	}
+
+	if (link.next != nullptr)
+	{
+		link.next->retransmissionWheelLink.prev = link.prev;
+	}
+
+	if (slotHeads[slot] == nullptr)
+	{
+		occupiedSlotBits[slot / BITS_PER_WORD] &= ~(uint64_t{ 1 } << (slot % BITS_PER_WORD));
+	}
+
+	link = {};
+	--size;
+}
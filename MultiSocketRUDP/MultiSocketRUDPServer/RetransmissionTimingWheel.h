@@ -0,0 +1,95 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "../Common/etc/CoreConstants.h"
+#include "../Common/etc/CoreType.h"
+
+struct SendPacketInfo;
+
+// ----------------------------------------
+// @brief 재전송 기한을 tick 단위 슬롯에 나누어 관리하는 해시 타이밍 휠입니다.
+// @details SendPacketInfo에 내장된 RetransmissionWheelLink로 슬롯의 이중 연결 리스트에 연결하므로
+//          등록과 취소가 O(1)이며, ACK를 받은 패킷은 기한까지 남아 있지 않고 바로 빠집니다.
+//          휠 한 바퀴(SLOT_COUNT tick)보다 먼 기한은 같은 슬롯에 남아 있다가 기한 tick이 되었을 때 꺼냅니다.
+//          동기화하지 않으므로 RetransmissionScheduler::lock 아래에서만 사용해야 합니다.
+// ----------------------------------------
+class RetransmissionTimingWheel
+{
+public:
+	using TimePoint = std::chrono::steady_clock::time_point;
+
+	static constexpr size_t SLOT_COUNT = 1024;
+
+	explicit RetransmissionTimingWheel(std::chrono::milliseconds inTickDuration = std::chrono::milliseconds(RETRANSMISSION_WHEEL_TICK_MS));
+	RetransmissionTimingWheel(const RetransmissionTimingWheel&) = delete;
+	RetransmissionTimingWheel& operator=(const RetransmissionTimingWheel&) = delete;
+
+	// ----------------------------------------
+	// @brief 기한에 맞는 슬롯에 등록합니다. 이미 등록되어 있으면 새 기한으로 옮깁니다.
+	// @details 기한은 tick 단위로 올림하므로 기한보다 일찍 꺼내지지 않습니다.
+	//          이미 지나간 기한은 다음 tick 슬롯에 등록합니다.
+	// @param sendPacketInfo 등록할 패킷 정보
+	// @param deadline 재전송 기한
+	// ----------------------------------------
+	void Schedule(SendPacketInfo& sendPacketInfo, TimePoint deadline);
+
+	// ----------------------------------------
+	// @brief 등록되어 있으면 휠에서 뺍니다.
+	// @param sendPacketInfo 뺄 패킷 정보
+	// @return 휠에 등록되어 있었으면 true
+	// ----------------------------------------
+	bool Cancel(SendPacketInfo& sendPacketInfo) noexcept;
+
+	// ----------------------------------------
+	// @brief now까지 기한이 지난 항목을 모두 휠에서 빼서 outExpired 뒤에 붙입니다.
+	// @param now 현재 시간
+	// @param outExpired 기한이 지난 항목을 받을 목록
+	// ----------------------------------------
+	void PopExpired(TimePoint now, OUT std::vector<SendPacketInfo*>& outExpired);
+
+	// ----------------------------------------
+	// @brief 다음으로 확인해야 할 시간을 구합니다.
+	// @details 가장 가까운 비어 있지 않은 슬롯의 시간이므로, 그 슬롯에 다음 바퀴 항목만 있다면 실제 기한보다 이를 수 있습니다.
+	// @param outDeadline 다음 확인 시간
+	// @return 등록된 항목이 있으면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool GetNextDeadline(OUT TimePoint& outDeadline) const noexcept;
+
+	// ----------------------------------------
+	// @brief 등록된 모든 항목을 휠에서 빼서 outItems 뒤에 붙입니다.
+	// @param outItems 뺀 항목을 받을 목록
+	// ----------------------------------------
+	void PopAll(OUT std::vector<SendPacketInfo*>& outItems);
+
+	[[nodiscard]]
+	static bool IsScheduled(const SendPacketInfo& sendPacketInfo) noexcept;
+	[[nodiscard]]
+	size_t GetSize() const noexcept;
+
+private:
+	[[nodiscard]]
+	uint64_t ToTickFloor(TimePoint timePoint) const noexcept;
+	[[nodiscard]]
+	uint64_t ToTickCeil(TimePoint timePoint) const noexcept;
+	[[nodiscard]]
+	TimePoint ToTimePoint(uint64_t tick) const noexcept;
+
+	void Link(SendPacketInfo& sendPacketInfo, uint64_t deadlineTick) noexcept;
+	void Unlink(SendPacketInfo& sendPacketInfo) noexcept;
+
+private:
+	static constexpr size_t SLOT_MASK = SLOT_COUNT - 1;
+	static constexpr size_t BITS_PER_WORD = 64;
+	static_assert((SLOT_COUNT & SLOT_MASK) == 0, "SLOT_COUNT must be a power of two");
+	static_assert(SLOT_COUNT % BITS_PER_WORD == 0);
+
+	std::chrono::steady_clock::duration tickDuration;
+	std::array<SendPacketInfo*, SLOT_COUNT> slotHeads{};
+	std::array<uint64_t, SLOT_COUNT / BITS_PER_WORD> occupiedSlotBits{};
+	uint64_t currentTick{};
+	size_t size{};
+};
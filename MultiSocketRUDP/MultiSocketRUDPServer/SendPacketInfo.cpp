@@ -12,7 +12,9 @@ SendPacketInfo::~SendPacketInfo()
 	ownerGeneration = {};
 	retransmissionCount = {};
 	sendPacketSequence = {};
-	scheduleVersion = {};
+	retransmissionWheelLink = {};
+	sendQueueLink.next.store(nullptr, std::memory_order_relaxed);
+	sendQueueLink.isQueued.store(false, std::memory_order_relaxed);
 	isErasedPacketInfo = {};
 	lastSendTime = {};
 	canUseRttSample.store(false, std::memory_order_relaxed);
@@ -33,7 +35,9 @@ void SendPacketInfo::Initialize(RUDPSession* inOwner
 	isReplyType = inIsReplyType;
 
 	retransmissionCount = {};
-	scheduleVersion = {};
+	retransmissionWheelLink = {};
+	sendQueueLink.next.store(nullptr, std::memory_order_relaxed);
+	sendQueueLink.isQueued.store(false, std::memory_order_relaxed);
 	isErasedPacketInfo = {};
 	lastSendTime = {};
 	canUseRttSample.store(not inIsReplyType, std::memory_order_relaxed);
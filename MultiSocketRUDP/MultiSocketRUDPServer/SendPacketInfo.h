@@ -12,6 +12,29 @@ class RUDPSession;
 struct SendPacketInfo;
 extern CTLSMemoryPool<SendPacketInfo>* sendPacketInfoPool;
 
+// ----------------------------------------
+// @brief Intrusive slot list node used by RetransmissionTimingWheel.
+// @details Guarded by the owning RetransmissionScheduler::lock.
+// ----------------------------------------
+struct RetransmissionWheelLink
+{
+	SendPacketInfo* prev{};
+	SendPacketInfo* next{};
+	uint64_t deadlineTick{};
+	bool isLinked{};
+};
+
+// ----------------------------------------
+// @brief Intrusive node used by SendPacketInfoQueue.
+// @details next is written by producers and read by the single consumer.
+//          isQueued keeps the same SendPacketInfo from being linked twice.
+// ----------------------------------------
+struct SendQueueLink
+{
+	std::atomic<SendPacketInfo*> next{};
+	std::atomic_bool isQueued{};
+};
+
 struct SendPacketInfo
 {
 	NetBuffer* buffer{};
@@ -19,7 +42,8 @@ struct SendPacketInfo
 	uint32_t ownerGeneration{};
 	PacketRetransmissionCount retransmissionCount{};
 	PacketSequence sendPacketSequence{};
-	uint64_t scheduleVersion{};
+	RetransmissionWheelLink retransmissionWheelLink{};
+	SendQueueLink sendQueueLink{};
 	std::atomic_bool isErasedPacketInfo{};
 	bool isReplyType{};
 	std::atomic_int32_t refCount{};
@@ -0,0 +1,77 @@
+#include "PreCompile.h"
+#include "SendPacketInfoQueue.h"
+
+SendPacketInfoQueue::SendPacketInfoQueue()
+	: tail(&stub)
+	, head(&stub)
+{
+}
+
+bool SendPacketInfoQueue::Push(SendPacketInfo* sendPacketInfo) noexcept
+{
+	if (sendPacketInfo->sendQueueLink.isQueued.exchange(true, std::memory_order_acq_rel))
+	{
+		return false;
+	}
+
+	size.fetch_add(1, std::memory_order_seq_cst);
+	Link(sendPacketInfo);
+	return true;
+}
+
+SendPacketInfo* SendPacketInfoQueue::Pop() noexcept
+{
+	SendPacketInfo* front = head;
+	SendPacketInfo* next = front->sendQueueLink.next.load(std::memory_order_acquire);
+	if (front == &stub)
+	{
+		if (next == nullptr)
+		{
+			return nullptr;
+		}
+
+		head = next;
+		front = next;
+		next = next->sendQueueLink.next.load(std::memory_order_acquire);
+	}
+
+	if (next == nullptr)
+	{
+		// front가 마지막으로 보이는 노드입니다. 다른 생산자가 이미 tail을 가져갔다면 next 기록을 기다려야 합니다.
+		if (front != tail.load(std::memory_order_acquire))
+		{
+			return nullptr;
+		}
+
+		// front를 떼어낼 수 있도록 stub을 뒤에 붙여 둡니다.
+		Link(&stub);
+		next = front->sendQueueLink.next.load(std::memory_order_acquire);
+		if (next == nullptr)
+		{
+			return nullptr;
+		}
+	}
+
+	head = next;
+	front->sendQueueLink.next.store(nullptr, std::memory_order_relaxed);
+	front->sendQueueLink.isQueued.store(false, std::memory_order_release);
+	size.fetch_sub(1, std::memory_order_seq_cst);
+	return front;
+}
+
+size_t SendPacketInfoQueue::GetSize() const noexcept
+{
+	return size.load(std::memory_order_seq_cst);
+}
+
+bool SendPacketInfoQueue::IsEmpty() const noexcept
+{
+	return GetSize() == 0;
+}
+
+void SendPacketInfoQueue::Link(SendPacketInfo* node) noexcept
+{
+	node->sendQueueLink.next.store(nullptr, std::memory_order_relaxed);
+	SendPacketInfo* prev = tail.exchange(node, std::memory_order_acq_rel);
+	prev->sendQueueLink.next.store(node, std::memory_order_release);
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+#include "SendPacketInfo.h"
+
+// ----------------------------------------
+// @brief SendPacketInfo에 내장된 SendQueueLink로 연결하는 lock-free 다중 생산자/단일 소비자 큐입니다.
+// @details 생산자는 tail을 exchange로 바꾼 뒤 이전 노드의 next를 채우므로 Push마다 할당이 없습니다.
+//          빈 큐에서도 연결이 끊기지 않도록 내장 stub 노드를 둡니다.
+//          Push는 어느 스레드에서나 호출할 수 있지만 Pop은 한 번에 한 스레드(IO_SENDING을 가진 IO 경로)만 호출해야 합니다.
+//          생산자가 exchange와 next 기록 사이에 있는 동안에는 그 뒤의 노드가 아직 보이지 않으므로
+//          GetSize() > 0이어도 Pop이 nullptr를 반환할 수 있습니다.
+// ----------------------------------------
+class SendPacketInfoQueue
+{
+public:
+	SendPacketInfoQueue();
+	SendPacketInfoQueue(const SendPacketInfoQueue&) = delete;
+	SendPacketInfoQueue& operator=(const SendPacketInfoQueue&) = delete;
+
+	// ----------------------------------------
+	// @brief 큐 뒤에 연결합니다.
+	// @param sendPacketInfo 연결할 패킷 정보
+	// @return 이미 큐에 연결되어 있어 연결하지 않았으면 false
+	// ----------------------------------------
+	[[nodiscard]]
+	bool Push(SendPacketInfo* sendPacketInfo) noexcept;
+
+	// ----------------------------------------
+	// @brief 큐 앞에서 하나를 꺼냅니다. 소비자 스레드에서만 호출해야 합니다.
+	// @return 꺼낸 패킷 정보, 보이는 노드가 없으면 nullptr
+	// ----------------------------------------
+	[[nodiscard]]
+	SendPacketInfo* Pop() noexcept;
+
+	// ----------------------------------------
+	// @brief 연결 중이거나 연결된 노드 수를 반환합니다.
+	// @details Push는 연결 전에 수를 늘리므로, 0이면 Pop할 노드도 연결 중인 노드도 없습니다.
+	// ----------------------------------------
+	[[nodiscard]]
+	size_t GetSize() const noexcept;
+	[[nodiscard]]
+	bool IsEmpty() const noexcept;
+
+private:
+	void Link(SendPacketInfo* node) noexcept;
+
+private:
+	// 생산자와 소비자가 서로의 캐시 라인을 무효화하지 않도록 떨어뜨립니다.
+	alignas(64) std::atomic<SendPacketInfo*> tail;
+	alignas(64) SendPacketInfo* head;
+	std::atomic<size_t> size{};
+	SendPacketInfo stub;
+};
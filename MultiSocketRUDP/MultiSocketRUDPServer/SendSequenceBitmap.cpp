@@ -0,0 +1,100 @@
+#include "PreCompile.h"
+#include "SendSequenceBitmap.h"
+#include <algorithm>
+
+void SendSequenceBitmap::Clear() noexcept
+{
+	ClearWindow(dataWindow);
+	ClearWindow(replyWindow);
+	size = 0;
+}
+
+bool SendSequenceBitmap::Contains(const bool isReplyType, const PacketSequence sequence) const noexcept
+{
+	return ContainsInWindow(isReplyType ? replyWindow : dataWindow, sequence);
+}
+
+bool SendSequenceBitmap::Insert(const bool isReplyType, const PacketSequence sequence) noexcept
+{
+	if (not InsertInWindow(isReplyType ? replyWindow : dataWindow, sequence))
+	{
+		return false;
+	}
+
+	++size;
+	return true;
+}
+
+size_t SendSequenceBitmap::GetSize() const noexcept
+{
+	return size;
+}
+
+bool SendSequenceBitmap::IsEmpty() const noexcept
+{
+	return size == 0;
+}
+
+bool SendSequenceBitmap::IsInWindow(const SequenceWindow& window, const PacketSequence sequence) noexcept
+{
+	return window.hasBase && sequence >= window.base && sequence - window.base < WINDOW_BITS;
+}
+
+bool SendSequenceBitmap::ContainsInWindow(const SequenceWindow& window, const PacketSequence sequence) noexcept
+{
+	if (IsInWindow(window, sequence))
+	{
+		const PacketSequence offset = sequence - window.base;
+		return (window.words[offset / BITS_PER_WORD] >> (offset % BITS_PER_WORD) & 1) != 0;
+	}
+
+	const auto overflowEnd = window.overflowSequences.begin() + window.overflowCount;
+	return std::find(window.overflowSequences.begin(), overflowEnd, sequence) != overflowEnd;
+}
+
+bool SendSequenceBitmap::InsertInWindow(SequenceWindow& window, const PacketSequence sequence) noexcept
+{
+	if (not window.hasBase)
+	{
+		// 재전송은 처음 시퀀스보다 앞서고 새 송신은 뒤에 오므로 양쪽으로 같은 폭을 둡니다.
+		constexpr PacketSequence halfWindow = WINDOW_BITS / 2;
+		window.base = sequence > halfWindow ? sequence - halfWindow : 0;
+		window.hasBase = true;
+	}
+
+	if (ContainsInWindow(window, sequence))
+	{
+		return false;
+	}
+
+	if (IsInWindow(window, sequence))
+	{
+		const PacketSequence offset = sequence - window.base;
+		const size_t wordIndex = offset / BITS_PER_WORD;
+		window.words[wordIndex] |= uint64_t{ 1 } << (offset % BITS_PER_WORD);
+		window.lowestTouchedWord = (std::min)(window.lowestTouchedWord, wordIndex);
+		window.highestTouchedWord = (std::max)(window.highestTouchedWord, wordIndex);
+		return true;
+	}
+
+	if (window.overflowCount < OVERFLOW_CAPACITY)
+	{
+		window.overflowSequences[window.overflowCount++] = sequence;
+	}
+
+	return true;
+}
+
+void SendSequenceBitmap::ClearWindow(SequenceWindow& window) noexcept
+{
+	if (window.lowestTouchedWord <= window.highestTouchedWord)
+	{
+		std::fill(window.words.begin() + window.lowestTouchedWord, window.words.begin() + window.highestTouchedWord + 1, uint64_t{});
+	}
+
+	window.lowestTouchedWord = WORD_COUNT;
+	window.highestTouchedWord = 0;
+	window.hasBase = false;
+	window.base = 0;
+	window.overflowCount = 0;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../Common/etc/CoreType.h"
+
+// ----------------------------------------
+// @brief 한 번의 송신 패스에 이미 실은 (isReplyType, sequence)를 기록하는 평면 비트맵입니다.
+// @details 종류별로 처음 기록한 시퀀스를 가운데 두는 WINDOW_BITS 크기 창을 잡고 창 안은 비트 하나로 기록합니다.
+//          창 밖 시퀀스는 고정 크기 배열에 따로 두므로 어떤 경로도 힙 할당을 하지 않습니다.
+//          그 배열마저 가득 차면 기록하지 못하고 새 시퀀스로 취급하므로, 같은 패킷이 한 패스에 두 번 실릴 수는 있지만 빠지지는 않습니다.
+//          Clear는 건드린 워드만 지웁니다. 동기화하지 않으므로 IO_SENDING을 가진 송신 경로에서만 사용해야 합니다.
+// ----------------------------------------
+class SendSequenceBitmap
+{
+public:
+	static constexpr size_t WINDOW_BITS = static_cast<size_t>(MAX_CONGESTION_WINDOW) * 2;
+	static constexpr size_t OVERFLOW_CAPACITY = 32;
+
+	SendSequenceBitmap() = default;
+	SendSequenceBitmap(const SendSequenceBitmap&) = delete;
+	SendSequenceBitmap& operator=(const SendSequenceBitmap&) = delete;
+
+	// ----------------------------------------
+	// @brief 기록한 시퀀스를 모두 지우고 다음 패스의 창을 다시 잡도록 합니다.
+	// ----------------------------------------
+	void Clear() noexcept;
+
+	// ----------------------------------------
+	// @brief 이번 패스에 이미 기록한 시퀀스인지 확인합니다.
+	// @param isReplyType 응답 패킷 여부
+	// @param sequence 패킷 시퀀스
+	// @return 기록되어 있으면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool Contains(bool isReplyType, PacketSequence sequence) const noexcept;
+
+	// ----------------------------------------
+	// @brief 시퀀스를 기록합니다.
+	// @param isReplyType 응답 패킷 여부
+	// @param sequence 패킷 시퀀스
+	// @return 새로 기록했거나 기록할 자리가 없으면 true, 이미 기록되어 있으면 false
+	// ----------------------------------------
+	bool Insert(bool isReplyType, PacketSequence sequence) noexcept;
+
+	[[nodiscard]]
+	size_t GetSize() const noexcept;
+	[[nodiscard]]
+	bool IsEmpty() const noexcept;
+
+private:
+	static constexpr size_t BITS_PER_WORD = 64;
+	static constexpr size_t WORD_COUNT = WINDOW_BITS / BITS_PER_WORD;
+
+	struct SequenceWindow
+	{
+		std::array<uint64_t, WORD_COUNT> words{};
+		PacketSequence base{};
+		bool hasBase{};
+		size_t lowestTouchedWord{ WORD_COUNT };
+		size_t highestTouchedWord{};
+
+		std::array<PacketSequence, OVERFLOW_CAPACITY> overflowSequences{};
+		size_t overflowCount{};
+	};
+
+	[[nodiscard]]
+	static bool IsInWindow(const SequenceWindow& window, PacketSequence sequence) noexcept;
+	[[nodiscard]]
+	static bool ContainsInWindow(const SequenceWindow& window, PacketSequence sequence) noexcept;
+	static bool InsertInWindow(SequenceWindow& window, PacketSequence sequence) noexcept;
+	static void ClearWindow(SequenceWindow& window) noexcept;
+
+private:
+	SequenceWindow dataWindow;
+	SequenceWindow replyWindow;
+	size_t size{};
+};
@@ -0,0 +1,43 @@
+#include "PreCompile.h"
+#include "SessionPacer.h"
+#include <algorithm>
+
+void SessionPacer::Configure(const bool inEnabled) noexcept
+{
+	enabled = inEnabled;
+	scheduled = false;
+	nextDepartureTime = {};
+}
+
+bool SessionPacer::CanSendNow(const std::chrono::steady_clock::time_point now) const noexcept
+{
+	return not enabled || nextDepartureTime <= now;
+}
+
+void SessionPacer::OnPacketReleased(const std::chrono::steady_clock::time_point now, const std::chrono::steady_clock::duration interval) noexcept
+{
+	if (not enabled)
+	{
+		return;
+	}
+
+	// 한동안 보내지 않았다고 밀린 출발 시각을 한꺼번에 쓰지 않도록, 기준을 버스트 허용량 이내로 당겨 둡니다.
+	const auto earliestBase = now - interval * (PACING_BURST_PACKETS - 1);
+	nextDepartureTime = std::max(nextDepartureTime, earliestBase) + interval;
+}
+
+bool SessionPacer::TryMarkScheduled() noexcept
+{
+	if (scheduled)
+	{
+		return false;
+	}
+
+	scheduled = true;
+	return true;
+}
+
+void SessionPacer::ClearScheduled() noexcept
+{
+	scheduled = false;
+}
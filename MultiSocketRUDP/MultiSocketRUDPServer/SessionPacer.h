@@ -0,0 +1,53 @@
+#pragma once
+#include "../Common/etc/CoreType.h"
+#include <chrono>
+
+// ----------------------------------------
+// @brief 세션 송신을 RTT 구간에 고르게 나누는 earliest-departure-time 페이서입니다.
+// @details cwnd가 한 번에 열려도 보류 큐의 패킷은 혼잡 제어가 알려 준 간격마다 하나씩 나갑니다.
+//          타이머 해상도 때문에 생기는 지연을 흡수하도록 PACING_BURST_PACKETS개까지는 연달아 보낼 수 있습니다.
+//          세션의 보류 큐 잠금을 잡은 상태에서만 접근하므로 동기화하지 않습니다.
+// ----------------------------------------
+class SessionPacer
+{
+public:
+	// ----------------------------------------
+	// @brief 페이싱 사용 여부를 설정하고 출발 시각과 예약 상태를 초기화합니다.
+	// @param inEnabled false이면 CanSendNow가 항상 true를 반환합니다.
+	// ----------------------------------------
+	void Configure(bool inEnabled) noexcept;
+
+	// ----------------------------------------
+	// @brief 지금 패킷 하나를 내보낼 수 있는지 확인합니다.
+	// @param now 현재 시각
+	// @return 페이싱을 쓰지 않거나 다음 출발 시각이 지났으면 true
+	// ----------------------------------------
+	[[nodiscard]]
+	bool CanSendNow(std::chrono::steady_clock::time_point now) const noexcept;
+	// ----------------------------------------
+	// @brief 패킷 하나를 내보냈으므로 다음 출발 시각을 간격만큼 미룹니다.
+	// @param now 현재 시각
+	// @param interval 패킷 사이 간격. 0이면 페이싱하지 않습니다.
+	// ----------------------------------------
+	void OnPacketReleased(std::chrono::steady_clock::time_point now, std::chrono::steady_clock::duration interval) noexcept;
+
+	// ----------------------------------------
+	// @brief IO worker에 깨워 달라고 예약할 차례인지 확인하고 예약 중으로 표시합니다.
+	// @return 이미 예약되어 있으면 false
+	// ----------------------------------------
+	[[nodiscard]]
+	bool TryMarkScheduled() noexcept;
+	void ClearScheduled() noexcept;
+
+	[[nodiscard]]
+	bool IsEnabled() const noexcept { return enabled; }
+	[[nodiscard]]
+	std::chrono::steady_clock::time_point GetNextDepartureTime() const noexcept { return nextDepartureTime; }
+
+private:
+	static constexpr uint32_t PACING_BURST_PACKETS = 2;
+
+	bool enabled{};
+	bool scheduled{};
+	std::chrono::steady_clock::time_point nextDepartureTime{};
+};
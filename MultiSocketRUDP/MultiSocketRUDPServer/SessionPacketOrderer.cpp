@@ -2,6 +2,7 @@
 #include "SessionPacketOrderer.h"
 #include "../Logger/Logger.h"
 #include "LogExtension.h"
+#include "RecvPacketView.h"
 #include <ranges>
 
 SessionPacketOrderer::SessionPacketOrderer(const BYTE inMaxHoldingQueueSize)
@@ -64,8 +65,13 @@ ON_RECV_RESULT SessionPacketOrderer::OnReceive(const PacketSequence sequence, Ne
 			return ON_RECV_RESULT::ERROR_OCCURED;
 		}
 
-		NetBuffer::AddRefCount(&buffer);
-		recvHoldingPackets.emplace(sequence, &buffer);
+		// 수신 슬롯을 빌린 패킷은 처리가 끝나면 슬롯이 반환되므로 보류할 때 복사본을 만듭니다.
+		NetBuffer* holdingBuffer = RecvPacketView::AcquireHoldingBuffer(buffer);
+		if (holdingBuffer == nullptr)
+		{
+			return ON_RECV_RESULT::ERROR_OCCURED;
+		}
+		recvHoldingPackets.emplace(sequence, holdingBuffer);
 	}
 
 	return ON_RECV_RESULT::PACKET_HELD;
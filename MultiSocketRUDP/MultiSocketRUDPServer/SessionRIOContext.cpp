@@ -5,7 +5,12 @@
 #include "Logger.h"
 #include <MSWSock.h>
 
+static_assert(CLIENT_ADDRESS_SLOT_SIZE >= sizeof(SOCKADDR_INET));
+
 bool SessionRIOContext::Initialize(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable,
+    RecvSlotPool& recvSlotPool,
+    RegisteredBufferSlab& sendBufferSlab,
+    RegisteredBufferSlab& inClientAddressSlab,
     const RIO_CQ& rioRecvCQ,
     const RIO_CQ& rioSendCQ,
     const SOCKET sock,
@@ -14,46 +19,65 @@ bool SessionRIOContext::Initialize(const RIO_EXTENSION_FUNCTION_TABLE& rioFuncti
     unsigned short pendingQueueCapacity)
 {
     cachedSessionId = sessionId;
-    if (not recvContext.Initialize(rioFunctionTable, sessionId, ownerSession))
+    if (not recvContext.Initialize(recvSlotPool, sessionId, ownerSession))
     {
         LOG_ERROR("SessionRIOContext: recvContext.Initialize failed");
         return false;
     }
 
-    if (not sendContext.Initialize(rioFunctionTable, pendingQueueCapacity))
+    if (not sendContext.Initialize(sendBufferSlab, pendingQueueCapacity))
     {
         LOG_ERROR("SessionRIOContext: sendContext.Initialize failed");
-        recvContext.Cleanup(rioFunctionTable);
+        recvContext.Cleanup();
+        return false;
+    }
+
+    clientAddressSlot = inClientAddressSlab.Acquire();
+    if (not clientAddressSlot.IsValid())
+    {
+        LOG_ERROR("SessionRIOContext: client address slot acquire failed");
+        Cleanup();
         return false;
     }
+    clientAddressSlab = &inClientAddressSlab;
+    clientAddressRIOBuffer = { clientAddressSlot.bufferId, clientAddressSlot.offset, sizeof(SOCKADDR_INET) };
+    ZeroMemory(clientAddressSlot.buffer, sizeof(SOCKADDR_INET));
 
-    rioRQ = rioFunctionTable.RIOCreateRequestQueue(sock, RECV_OUTSTANDING_COUNT, 1, 1, 1, rioRecvCQ, rioSendCQ, &cachedSessionId);
+    rioRQ = rioFunctionTable.RIOCreateRequestQueue(sock, RECV_OUTSTANDING_COUNT, 1, MAX_DATAGRAM_BATCH_SIZE, 1, rioRecvCQ, rioSendCQ, &cachedSessionId);
     if (rioRQ == RIO_INVALID_RQ)
     {
         LOG_ERROR(std::format("RIOCreateRequestQueue failed with error {}", WSAGetLastError()));
-        Cleanup(rioFunctionTable);
+        Cleanup();
         return false;
     }
 
     return true;
 }
 
-void SessionRIOContext::Cleanup(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable)
+void SessionRIOContext::Cleanup()
 {
     assert(IsDrained());
-    recvContext.Cleanup(rioFunctionTable);
-    sendContext.Cleanup(rioFunctionTable);
+    recvContext.Cleanup();
+    sendContext.Cleanup();
+    ReleaseClientAddressSlot();
     rioRQ = RIO_INVALID_RQ;
 }
 
-RecvBuffer& SessionRIOContext::GetRecvBuffer()
+void SessionRIOContext::ReleaseClientAddressSlot()
 {
-    return recvContext.GetRecvBuffer();
+    if (clientAddressSlot.IsValid())
+    {
+        clientAddressSlab->Release(clientAddressSlot);
+    }
+
+    clientAddressSlab = nullptr;
+    clientAddressSlot = {};
+    clientAddressRIOBuffer = { RIO_INVALID_BUFFERID, };
 }
 
-std::shared_ptr<IOContext> SessionRIOContext::GetRecvBufferContext() const
+RecvBuffer& SessionRIOContext::GetRecvBuffer()
 {
-    return recvContext.GetRecvBufferContext();
+    return recvContext.GetRecvBuffer();
 }
 
 void SessionRIOContext::RecvContextReset()
@@ -81,3 +105,18 @@ RIO_RQ SessionRIOContext::GetRIORQ() const
 {
 	return rioRQ;
 }
+
+void SessionRIOContext::SetClientAddress(const SOCKADDR_INET& clientAddress)
+{
+    if (not clientAddressSlot.IsValid())
+    {
+        return;
+    }
+
+    memcpy(clientAddressSlot.buffer, &clientAddress, sizeof(SOCKADDR_INET));
+}
+
+const RIO_BUF& SessionRIOContext::GetClientAddressRIOBuffer() const
+{
+    return clientAddressRIOBuffer;
+}
@@ -21,6 +21,9 @@ public:
     // ----------------------------------------
     // @brief RIO 수신/송신 컨텍스트를 초기화하고 Request Queue를 생성합니다. 
     // @param rioFunctionTable RIO 확장 함수 테이블
+    // @param recvSlotPool 세션이 속한 IO worker의 수신 슬롯 풀
+    // @param sendBufferSlab 세션이 속한 IO worker의 송신 버퍼 슬랩
+    // @param clientAddressSlab 세션이 속한 IO worker의 클라이언트 주소 슬롯 슬랩
     // @param rioRecvCQ 수신용 Completion Queue
     // @param rioSendCQ 송신용 Completion Queue
     // @param sock RIO에 사용할 소켓
@@ -31,6 +34,9 @@ public:
     // ----------------------------------------
     [[nodiscard]]
     bool Initialize(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable,
+        RecvSlotPool& recvSlotPool,
+        RegisteredBufferSlab& sendBufferSlab,
+        RegisteredBufferSlab& clientAddressSlab,
         const RIO_CQ& rioRecvCQ,
         const RIO_CQ& rioSendCQ,
         SOCKET sock,
@@ -39,10 +45,9 @@ public:
         unsigned short pendingQueueCapacity);
 
     // ----------------------------------------
-    // @brief 내부 수신/송신 컨텍스트의 RIO 자원을 정리합니다.
-    // @param rioFunctionTable RIO 확장 함수 테이블
+    // @brief 내부 수신/송신 컨텍스트가 빌려 둔 슬롯과 버퍼를 worker에 돌려줍니다.
     // ----------------------------------------
-    void Cleanup(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable);
+    void Cleanup();
 
     // ----------------------------------------
     // @brief 내부 수신 버퍼 객체를 반환합니다.
@@ -51,12 +56,6 @@ public:
     [[nodiscard]]
 	RecvBuffer& GetRecvBuffer();
     // ----------------------------------------
-    // @brief 현재 수신 IOContext를 가리키는 shared_ptr을 반환합니다.
-    // @return 수신 IOContext shared_ptr
-    // ----------------------------------------
-    [[nodiscard]]
-	std::shared_ptr<IOContext> GetRecvBufferContext() const;
-    // ----------------------------------------
     // @brief 수신 IOContext의 소유권을 해제합니다.
     // ----------------------------------------
     void RecvContextReset();
@@ -87,10 +86,29 @@ public:
     [[nodiscard]]
 	RIO_RQ GetRIORQ() const;
 
+    // ----------------------------------------
+    // @brief 연결 시점에 클라이언트 주소를 등록된 주소 슬롯에 한 번 기록합니다.
+    // @details 송신 컨텍스트는 주소를 복사하지 않고 GetClientAddressRIOBuffer()로 이 슬롯을 가리킵니다.
+    // ----------------------------------------
+    void SetClientAddress(const SOCKADDR_INET& clientAddress);
+    // ----------------------------------------
+    // @brief 송신 요청의 원격 주소로 넘길 주소 슬롯의 RIO_BUF를 반환합니다.
+    // @return 초기화 전이면 BufferId가 RIO_INVALID_BUFFERID인 RIO_BUF
+    // ----------------------------------------
+    [[nodiscard]]
+    const RIO_BUF& GetClientAddressRIOBuffer() const;
+
+private:
+    void ReleaseClientAddressSlot();
+
 private:
     SessionIdType cachedSessionId = INVALID_SESSION_ID;
     RIO_RQ rioRQ = RIO_INVALID_RQ;
 
+    RegisteredBufferSlab* clientAddressSlab{};
+    RegisteredBufferChunk clientAddressSlot{};
+    RIO_BUF clientAddressRIOBuffer{ RIO_INVALID_BUFFERID, };
+
     SessionRecvContext recvContext;
     SessionSendContext sendContext;
 };
@@ -1,96 +1,58 @@
 #include "PreCompile.h"
 #include "SessionRecvContext.h"
 #include "RUDPSession.h"
+#include "RecvSlotPool.h"
 #include "Logger.h"
+#include <array>
 
-bool SessionRecvContext::Initialize(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable, const SessionIdType sessionId, RUDPSession* ownerSession)
+bool SessionRecvContext::Initialize(RecvSlotPool& slotPool, const SessionIdType sessionId, RUDPSession* ownerSession)
 {
     assert(recvBuffer.IsDrained());
-    recvBuffer.ClearFreeRecvContexts();
-
-    for (auto& slot : recvBuffer.slots)
-    {
-        slot.recvContext = std::make_shared<IOContext>();
-        if (slot.recvContext == nullptr)
-        {
-            return false;
-        }
-
-        const auto& context = slot.recvContext;
-        context->InitContext(sessionId, RIO_OPERATION_TYPE::OP_RECV);
-        context->Length = RECV_BUFFER_SIZE;
-        context->Offset = 0;
-        context->session = ownerSession;
-        context->ownerRecvBuffer = &recvBuffer;
-        context->recvDataBuffer = slot.buffer;
-
-        context->clientAddrRIOBuffer.Length = sizeof(SOCKADDR_INET);
-        context->clientAddrRIOBuffer.Offset = 0;
-        context->localAddrRIOBuffer.Length = sizeof(SOCKADDR_INET);
-        context->localAddrRIOBuffer.Offset = 0;
+    Cleanup();
 
-        context->BufferId = rioFunctionTable.RIORegisterBuffer(slot.buffer, RECV_BUFFER_SIZE);
-        context->clientAddrRIOBuffer.BufferId = rioFunctionTable.RIORegisterBuffer(context->clientAddrBuffer, sizeof(SOCKADDR_INET));
-        context->localAddrRIOBuffer.BufferId = rioFunctionTable.RIORegisterBuffer(context->localAddrBuffer, sizeof(SOCKADDR_INET));
+    recvBuffer.slotPool = &slotPool;
+    recvBuffer.ownerSessionId = sessionId;
+    recvBuffer.ownerSession = ownerSession;
+    recvBuffer.depthController.Reset(RECV_MIN_POSTED_SLOT_COUNT);
 
-        if (context->BufferId == RIO_INVALID_BUFFERID ||
-            context->clientAddrRIOBuffer.BufferId == RIO_INVALID_BUFFERID ||
-            context->localAddrRIOBuffer.BufferId == RIO_INVALID_BUFFERID)
+    std::array<IOContext*, RECV_MIN_POSTED_SLOT_COUNT> initialContexts{};
+    for (auto& context : initialContexts)
+    {
+        context = recvBuffer.AcquireFreeRecvContext();
+        if (context == nullptr)
         {
-            Cleanup(rioFunctionTable);
-            recvBuffer.ClearFreeRecvContexts();
+            for (IOContext* acquired : initialContexts)
+            {
+                if (acquired != nullptr)
+                {
+                    recvBuffer.ReleaseRecvContext(acquired);
+                }
+            }
+            Cleanup();
             return false;
         }
-
-		recvBuffer.ReleaseRecvContext(context.get());
     }
 
-    return true;
-}
-
-void SessionRecvContext::Cleanup(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable) const
-{
-    for (const auto& slot : recvBuffer.slots)
+    for (IOContext* context : initialContexts)
     {
-        if (slot.recvContext == nullptr)
-        {
-            continue;
-        }
-
-        const auto& context = slot.recvContext;
-        UnregisterRIOBuffer(rioFunctionTable, context->BufferId);
-        UnregisterRIOBuffer(rioFunctionTable, context->clientAddrRIOBuffer.BufferId);
-        UnregisterRIOBuffer(rioFunctionTable, context->localAddrRIOBuffer.BufferId);
+        recvBuffer.ReleaseRecvContext(context);
     }
+
+    return true;
 }
 
-void SessionRecvContext::UnregisterRIOBuffer(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable, RIO_BUFFERID& bufferId)
+void SessionRecvContext::Cleanup()
 {
-    if (bufferId != RIO_INVALID_BUFFERID)
-    {
-        rioFunctionTable.RIODeregisterBuffer(bufferId);
-        bufferId = RIO_INVALID_BUFFERID;
-    }
+    recvBuffer.ClearFreeRecvContexts();
+    recvBuffer.slotPool = nullptr;
 }
 
 void SessionRecvContext::RecvContextReset()
 {
-    recvBuffer.ClearFreeRecvContexts();
-    for (auto& slot : recvBuffer.slots)
-    {
-        if (slot.recvContext != nullptr)
-        {
-            slot.recvContext.reset();
-        }
-    }
+    Cleanup();
 }
 
 RecvBuffer& SessionRecvContext::GetRecvBuffer()
 {
 	return recvBuffer;
 }
-
-std::shared_ptr<IOContext> SessionRecvContext::GetRecvBufferContext() const
-{
-    return recvBuffer.slots[0].recvContext;
-}
@@ -4,6 +4,7 @@
 #include "RecvBuffer.h"
 
 class RUDPSession;
+class RecvSlotPool;
 
 class SessionRecvContext
 {
@@ -20,19 +21,19 @@ public:
 
 public:
     // ----------------------------------------
-    // @brief RIO 수신용 IOContext를 생성하고 데이터 및 주소 버퍼를 RIO에 등록합니다.
-    // @param rioFunctionTable RIO 확장 함수 테이블
+    // @brief 수신 버퍼를 IO worker의 수신 슬롯 풀에 연결하고 최소 게시 깊이만큼 슬롯을 미리 받아 둡니다.
+    // @details 이후 게시 깊이는 RecvDepthController가 수신 완료 빈도에 맞춰 RECV_OUTSTANDING_COUNT까지 조절합니다.
+    // @param slotPool 세션이 속한 IO worker의 수신 슬롯 풀
     // @param sessionId 세션 식별자
     // @param ownerSession 해당 컨텍스트를 소유하는 RUDPSession 포인터
     // @return 초기화 성공 여부 (true: 성공, false: 실패)
     // ----------------------------------------
     [[nodiscard]]
-    bool Initialize(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable, SessionIdType sessionId, RUDPSession* ownerSession);
+    bool Initialize(RecvSlotPool& slotPool, SessionIdType sessionId, RUDPSession* ownerSession);
     // ----------------------------------------
-    // @brief 등록된 RIO 버퍼들을 Deregister 합니다.
-    // @param rioFunctionTable RIO 확장 함수 테이블
+    // @brief 들고 있던 수신 슬롯을 모두 풀에 돌려주고 풀과의 연결을 끊습니다.
     // ----------------------------------------
-    void Cleanup(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable) const;
+    void Cleanup();
 
     // ----------------------------------------
     // @brief 내부 RecvBuffer 객체를 반환합니다.
@@ -41,24 +42,10 @@ public:
     [[nodiscard]]
 	RecvBuffer& GetRecvBuffer();
     // ----------------------------------------
-    // @brief 현재 수신 IOContext를 가리키는 shared_ptr을 반환합니다.
-    // @return 수신 IOContext를 가리키는 shared_ptr
-    // ----------------------------------------
-    [[nodiscard]]
-	std::shared_ptr<IOContext> GetRecvBufferContext() const;
-    // ----------------------------------------
     // @brief 수신 IOContext의 소유권을 해제합니다.
     // ----------------------------------------
     void RecvContextReset();
 
-private:
-    // ----------------------------------------
-    // @brief RIO 버퍼를 Deregister하고 유효하지 않은 상태로 설정합니다.
-    // @param rioFunctionTable RIO 확장 함수 테이블
-    // @param bufferId 등록 해제할 RIO 버퍼 ID
-    // ----------------------------------------
-    static void UnregisterRIOBuffer(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable, RIO_BUFFERID& bufferId);
-
 private:
     RecvBuffer recvBuffer;
 };
@@ -1,57 +1,39 @@
 #include "PreCompile.h"
 #include "SessionSendContext.h"
 #include "SendPacketInfo.h"
+#include "../Common/FlowController/RUDPAckFrame.h"
 #include <ranges>
 
-SessionSendContext::SessionSendContext()
+bool SessionSendContext::Initialize(RegisteredBufferSlab& inSendBufferSlab, unsigned short pendingQueueCapacity)
 {
-	ZeroMemory(rioSendBuffer, sizeof(rioSendBuffer));
-}
+	assert(not sendBufferChunk.IsValid());
 
-bool SessionSendContext::Initialize(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable, unsigned short pendingQueueCapacity)
-{
-	const RIO_BUFFERID bufferId = rioFunctionTable.RIORegisterBuffer(rioSendBuffer, MAX_SEND_BUFFER_SIZE);
-	if (bufferId == RIO_INVALID_BUFFERID)
-	{
-		return false;
-	}
-
-	sendBufferId = bufferId;
+	sendBufferSlab = &inSendBufferSlab;
 	pendingPacketQueue.Resize(pendingQueueCapacity);
-	cachedSequenceSet.clear();
+	sendSequenceBitmap.Clear();
 
 	return true;
 }
 
-void SessionSendContext::Cleanup(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable)
+void SessionSendContext::Cleanup()
 {
-	if (sendBufferId != RIO_INVALID_BUFFERID)
-	{
-		rioFunctionTable.RIODeregisterBuffer(sendBufferId);
-		sendBufferId = RIO_INVALID_BUFFERID;
-	}
+	ReleaseSendBuffer();
+	sendBufferSlab = nullptr;
 }
 
 void SessionSendContext::Reset()
 {
 	ioMode.store(IO_MODE::IO_NONE_SENDING, std::memory_order_seq_cst);
+	sendDatagramsInFlight.store(0, std::memory_order_seq_cst);
 	lastSendPacketSequence = 0;
-	sendBufferId = RIO_INVALID_BUFFERID;
+	lastReplyPacketSequence = 0;
+	lastFastRetransmitSequence = 0;
+	ReleaseSendBuffer();
 
+	SendPacketInfo::Free(reservedSendPacketInfo.exchange(nullptr, std::memory_order_acq_rel));
+	while (SendPacketInfo* info = sendPacketInfoQueue.Pop())
 	{
-		std::scoped_lock lock(sendPacketInfoQueueLock);
-
-		if (reservedSendPacketInfo != nullptr)
-		{
-			SendPacketInfo::Free(reservedSendPacketInfo);
-			reservedSendPacketInfo = nullptr;
-		}
-
-		while (not sendPacketInfoQueue.empty())
-		{
-			SendPacketInfo::Free(sendPacketInfoQueue.front());
-			sendPacketInfoQueue.pop();
-		}
+		SendPacketInfo::Free(info);
 	}
 
 	{
@@ -62,73 +44,86 @@ void SessionSendContext::Reset()
 
 bool SessionSendContext::IsSendPacketInfoQueueEmpty()
 {
-	std::scoped_lock lock(sendPacketInfoQueueLock);
-	return sendPacketInfoQueue.empty();
+	return sendPacketInfoQueue.IsEmpty();
 }
 
 size_t SessionSendContext::GetSendPacketInfoQueueSize()
 {
-	std::scoped_lock lock(sendPacketInfoQueueLock);
-	return sendPacketInfoQueue.size();
+	return sendPacketInfoQueue.GetSize();
 }
 
 void SessionSendContext::PushSendPacketInfo(SendPacketInfo* info)
 {
-	std::scoped_lock lock(sendPacketInfoQueueLock);
-	sendPacketInfoQueue.push(info);
+	if (not sendPacketInfoQueue.Push(info))
+	{
+		// 큐에 남아 있는 쪽이 같은 버퍼를 보내므로 이번 참조만 돌려줍니다.
+		SendPacketInfo::Free(info);
+	}
 }
 
 SendPacketInfo* SessionSendContext::TryGetFrontAndPop()
 {
-	std::scoped_lock lock(sendPacketInfoQueueLock);
-	if (sendPacketInfoQueue.empty())
-	{
-		return nullptr;
-	}
-
-	auto* front = sendPacketInfoQueue.front();
-	sendPacketInfoQueue.pop();
-
-	return front;
+	return sendPacketInfoQueue.Pop();
 }
 
 bool SessionSendContext::IsNothingToSend()
 {
-	std::scoped_lock lock(sendPacketInfoQueueLock);
-	return sendPacketInfoQueue.empty() && reservedSendPacketInfo == nullptr;
+	return sendPacketInfoQueue.IsEmpty() && reservedSendPacketInfo.load(std::memory_order_seq_cst) == nullptr;
 }
 
 SendPacketInfo* SessionSendContext::GetReservedSendPacketInfo()
 {
-	std::scoped_lock lock(sendPacketInfoQueueLock);
-	return reservedSendPacketInfo;
+	return reservedSendPacketInfo.load(std::memory_order_acquire);
 }
 SendPacketInfo* SessionSendContext::TakeReservedSendPacketInfo()
 {
-	std::scoped_lock lock(sendPacketInfoQueueLock);
-	SendPacketInfo* info = reservedSendPacketInfo;
-	reservedSendPacketInfo = nullptr;
-	return info;
+	return reservedSendPacketInfo.exchange(nullptr, std::memory_order_acq_rel);
 }
 void SessionSendContext::SetReservedSendPacketInfo(SendPacketInfo* info)
 {
-	std::scoped_lock lock(sendPacketInfoQueueLock);
-	reservedSendPacketInfo = info;
+	reservedSendPacketInfo.store(info, std::memory_order_seq_cst);
+}
+
+bool SessionSendContext::AcquireSendBuffer()
+{
+	if (sendBufferChunk.IsValid())
+	{
+		return true;
+	}
+
+	if (sendBufferSlab == nullptr)
+	{
+		return false;
+	}
+
+	sendBufferChunk = sendBufferSlab->Acquire();
+	return sendBufferChunk.IsValid();
+}
+
+void SessionSendContext::ReleaseSendBuffer()
+{
+	if (not sendBufferChunk.IsValid())
+	{
+		return;
+	}
+
+	sendBufferSlab->Release(sendBufferChunk);
+	sendBufferChunk = {};
 }
 
 char* SessionSendContext::GetRIOSendBuffer()
 {
-	return rioSendBuffer;
+	return sendBufferChunk.buffer;
 }
 
 RIO_BUFFERID SessionSendContext::GetSendBufferId() const
 {
-	return sendBufferId;
+	return sendBufferChunk.bufferId;
 }
 
-void SessionSendContext::SetSendRIOBufferId(const RIO_BUFFERID id)
+ULONG SessionSendContext::GetSendBufferOffset() const
 {
-	sendBufferId = id;
+	return sendBufferChunk.offset;
 }
 
 std::atomic<IO_MODE>& SessionSendContext::GetIOMode()
@@ -136,6 +131,16 @@ std::atomic<IO_MODE>& SessionSendContext::GetIOMode()
 	return ioMode;
 }
 
+std::atomic_uint& SessionSendContext::GetSendDatagramsInFlight()
+{
+	return sendDatagramsInFlight;
+}
+
+std::atomic_bool& SessionSendContext::GetDeferredSendCommitPending()
+{
+	return deferredSendCommitPending;
+}
+
 void SessionSendContext::InsertSendPacketInfo(const PacketSequence sequence, SendPacketInfo* info)
 {
 	std::unique_lock lock(sendPacketInfoMapLock);
@@ -179,6 +184,24 @@ SendPacketInfo* SessionSendContext::FindAndEraseSendPacketInfo(const PacketSeque
 	return info;
 }
 
+size_t SessionSendContext::EraseAckedSendPacketInfos(const RUDPAckFrame& ackFrame, const std::function<void(SendPacketInfo*)>& func)
+{
+	std::unique_lock lock(sendPacketInfoMapLock);
+	return ackFrame.EraseCovered(sendPacketInfoMap, func);
+}
+
+size_t SessionSendContext::CollectFastRetransmitTargets(const RUDPAckFrame& ackFrame, OUT std::span<SendPacketInfo*> outLostInfos)
+{
+	size_t lostCount = 0;
+	std::shared_lock lock(sendPacketInfoMapLock);
+	return ackFrame.ForEachLost(sendPacketInfoMap, lastFastRetransmitSequence, [&](SendPacketInfo* lostInfo)
+	{
+		lostInfo->AddRefCount();
+		outLostInfos[lostCount++] = lostInfo;
+		lastFastRetransmitSequence = lostInfo->sendPacketSequence;
+	}, outLostInfos.size());
+}
+
 void SessionSendContext::ForEachAndClearSendPacketInfoMap(const std::function<void(SendPacketInfo*)>& func)
 {
 	std::unique_lock lock(sendPacketInfoMapLock);
@@ -190,14 +213,9 @@ void SessionSendContext::ForEachAndClearSendPacketInfoMap(const std::function<vo
 	sendPacketInfoMap.clear();
 }
 
-std::set<MultiSocketRUDP::PacketSequenceSetKey>& SessionSendContext::GetCachedSequenceSet()
-{
-	return cachedSequenceSet;
-}
-
-std::mutex& SessionSendContext::GetCachedSequenceSetLock()
+SendSequenceBitmap& SessionSendContext::GetSendSequenceBitmap()
 {
-	return cachedSequenceSetLock;
+	return sendSequenceBitmap;
 }
 
 PacketSequence SessionSendContext::GetLastSendPacketSequence() const
@@ -210,6 +228,16 @@ PacketSequence SessionSendContext::IncrementLastSendPacketSequence()
 	return ++lastSendPacketSequence;
 }
 
+PacketSequence SessionSendContext::ReserveSendPacketSequences(const size_t count)
+{
+	return lastSendPacketSequence.fetch_add(count) + 1;
+}
+
+PacketSequence SessionSendContext::IncrementLastReplyPacketSequence()
+{
+	return ++lastReplyPacketSequence;
+}
+
 void SessionSendContext::InitializePendingQueue(const unsigned short capacity)
 {
 	pendingPacketQueue.Resize(capacity);
@@ -6,13 +6,18 @@
 #include <shared_mutex>
 #include <atomic>
 #include <functional>
+#include <vector>
+#include <span>
 #include <MSWSock.h>
 #include <NetServerSerializeBuffer.h>
 
-#include "PacketSequenceSetKey.h"
+#include "RegisteredBufferSlab.h"
+#include "SendPacketInfoQueue.h"
+#include "SendSequenceBitmap.h"
 #include "../Common/etc/RingBuffer.h"
 
 struct SendPacketInfo;
+struct RUDPAckFrame;
 
 enum class IO_MODE : unsigned int
 {
@@ -23,7 +28,7 @@ enum class IO_MODE : unsigned int
 class SessionSendContext
 {
 public:
-	SessionSendContext();
+	SessionSendContext() = default;
 	~SessionSendContext() = default;
 
 	SessionSendContext(const SessionSendContext&) = delete;
@@ -33,17 +38,17 @@ public:
 
 public:
 	// ----------------------------------------
-	// @brief RIO 송신 버퍼를 등록하고 초기화합니다.
-	// @param rioFunctionTable RIO 확장 함수 테이블
+	// @brief 송신 버퍼를 빌려 올 IO worker의 슬랩을 연결하고 초기화합니다.
+	// @details 송신 버퍼는 송신 패스마다 AcquireSendBuffer()로 빌려 오므로, 여기서는 RIO 버퍼를 등록하지 않습니다.
+	// @param sendBufferSlab 세션이 속한 IO worker의 송신 버퍼 슬랩
 	// @return 초기화 성공 여부 (true: 성공, false: 실패)
 	// ----------------------------------------
 	[[nodiscard]]
-	bool Initialize(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable, unsigned short pendingQueueCapacity);
+	bool Initialize(RegisteredBufferSlab& sendBufferSlab, unsigned short pendingQueueCapacity);
 	// ----------------------------------------
-	// @brief 등록된 RIO 송신 버퍼를 Deregister 합니다.
-	// @param rioFunctionTable RIO 확장 함수 테이블
+	// @brief 빌려 둔 송신 버퍼를 슬랩에 돌려주고 슬랩과의 연결을 끊습니다.
 	// ----------------------------------------
-	void Cleanup(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctionTable);
+	void Cleanup();
 
 	// ----------------------------------------
 	// @brief 송신 시퀀스, 예약 패킷 및 큐에 남아있는 모든 SendPacketInfo를 정리합니다.
@@ -63,12 +68,13 @@ public:
 	[[nodiscard]]
 	size_t GetSendPacketInfoQueueSize();
 	// ----------------------------------------
-	// @brief 송신 패킷 정보를 큐에 추가합니다.
+	// @brief 송신 패킷 정보를 큐에 추가합니다. 어느 스레드에서나 lock 없이 호출할 수 있습니다.
+	// @details 같은 SendPacketInfo가 아직 큐에 있으면 다시 넣지 않고, 호출자가 늘린 참조 하나를 바로 Free합니다.
 	// @param info 추가할 SendPacketInfo 포인터
 	// ----------------------------------------
 	void PushSendPacketInfo(SendPacketInfo* info);
 	// ----------------------------------------
-	// @brief 큐의 맨 앞 송신 패킷을 반환하고 제거합니다.
+	// @brief 큐의 맨 앞 송신 패킷을 반환하고 제거합니다. IO_SENDING을 가진 스레드에서만 호출해야 합니다.
 	// @return 존재하면 SendPacketInfo 포인터, 없으면 nullptr
 	// ----------------------------------------
 	[[nodiscard]]
@@ -95,22 +101,33 @@ public:
 	void SetReservedSendPacketInfo(SendPacketInfo* info);
 
 	// ----------------------------------------
-	// @brief RIO 송신 버퍼의 시작 주소를 반환합니다.
-	// @return 송신 버퍼 포인터
+	// @brief 이번 송신 패스에 쓸 송신 버퍼를 슬랩에서 빌려 옵니다. 이미 빌려 두었으면 그대로 씁니다.
+	// @details IO_SENDING을 가진 송신 경로에서만 호출합니다.
+	// @return 송신 버퍼가 있으면 true, 슬랩이 없거나 늘리지 못하면 false
+	// ----------------------------------------
+	[[nodiscard]]
+	bool AcquireSendBuffer();
+	// ----------------------------------------
+	// @brief 송신 패스가 끝나 커널이 더 이상 읽지 않는 송신 버퍼를 슬랩에 돌려줍니다.
+	// ----------------------------------------
+	void ReleaseSendBuffer();
+	// ----------------------------------------
+	// @brief 빌려 둔 RIO 송신 버퍼의 시작 주소를 반환합니다.
+	// @return 송신 버퍼 포인터, 빌려 두지 않았으면 nullptr
 	// ----------------------------------------
 	[[nodiscard]]
 	char* GetRIOSendBuffer();
 	// ----------------------------------------
-	// @brief 등록된 RIO 송신 버퍼 ID를 반환합니다.
+	// @brief 빌려 둔 송신 버퍼가 속한 RIO 버퍼 ID를 반환합니다.
 	// @return RIO_BUFFERID 값
 	// ----------------------------------------
 	[[nodiscard]]
 	RIO_BUFFERID GetSendBufferId() const;
 	// ----------------------------------------
-	// @brief RIO 송신 버퍼 ID를 설정합니다.
-	// @param id 설정할 RIO_BUFFERID
+	// @brief 빌려 둔 송신 버퍼가 RIO 버퍼 안에서 시작하는 위치를 반환합니다.
 	// ----------------------------------------
-	void SetSendRIOBufferId(RIO_BUFFERID id);
+	[[nodiscard]]
+	ULONG GetSendBufferOffset() const;
 
 	// ----------------------------------------
 	// @brief 현재 송신 IO 상태값에 대한 참조를 반환합니다.
@@ -118,6 +135,20 @@ public:
 	// ----------------------------------------
 	[[nodiscard]]
 	std::atomic<IO_MODE>& GetIOMode();
+	// ----------------------------------------
+	// @brief 현재 송신 패스에서 완료되지 않은 데이터그램 수에 대한 참조를 반환합니다.
+	// @details 마지막 데이터그램이 완료될 때 IO_MODE가 IO_NONE_SENDING으로 돌아갑니다.
+	// @return 송신 중인 데이터그램 수 참조
+	// ----------------------------------------
+	[[nodiscard]]
+	std::atomic_uint& GetSendDatagramsInFlight();
+	// ----------------------------------------
+	// @brief 지연 커밋 구간에서 이 세션이 커밋 대상에 이미 올라 있는지를 나타내는 플래그에 대한 참조를 반환합니다.
+	// @details 커밋 대상에 넣을 때 세우고 CommitDeferredSends에서 커밋한 뒤 내립니다.
+	// @return 커밋 대기 플래그 참조
+	// ----------------------------------------
+	[[nodiscard]]
+	std::atomic_bool& GetDeferredSendCommitPending();
 
 	// ----------------------------------------
 	// @brief 시퀀스를 키로 송신 패킷 정보를 맵에 등록합니다.
@@ -147,23 +178,32 @@ public:
 	[[nodiscard]]
 	SendPacketInfo* FindAndEraseSendPacketInfo(PacketSequence sequence);
 	// ----------------------------------------
+	// @brief ACK 프레임이 덮는 송신 패킷 정보를 한 번의 순회로 맵에서 제거하고, 제거된 각 항목에 대해 func를 호출합니다.
+	// @param ackFrame 수신한 ACK 프레임
+	// @param func 제거된 각 SendPacketInfo에 대해 시퀀스 오름차순으로 호출할 함수
+	// @return 제거된 항목 수
+	// ----------------------------------------
+	size_t EraseAckedSendPacketInfos(const RUDPAckFrame& ackFrame, const std::function<void(SendPacketInfo*)>& func);
+	// ----------------------------------------
+	// @brief ACK 프레임 기준으로 손실로 판단된 송신 패킷 정보를 골라 참조 수를 늘린 뒤 outLostInfos에 담습니다.
+	// @details 이미 빠른 재전송 대상으로 고른 시퀀스 이하는 다시 고르지 않습니다. 세션의 logic worker에서만 호출해야 합니다.
+	// @param ackFrame 수신한 ACK 프레임 (덮는 항목은 EraseAckedSendPacketInfos로 먼저 제거되어 있어야 합니다)
+	// @param outLostInfos 손실로 판단된 SendPacketInfo를 앞에서부터 채울 버퍼. 크기만큼만 고르고, 남은 손실은 다음 ACK에서 고릅니다. 호출자가 각각 Free해야 합니다.
+	// @return 고른 항목 수
+	// ----------------------------------------
+	size_t CollectFastRetransmitTargets(const RUDPAckFrame& ackFrame, OUT std::span<SendPacketInfo*> outLostInfos);
+	// ----------------------------------------
 	// @brief 각 SendPacketInfo에 대해 func를 호출한 뒤 맵을 비웁니다.
 	// @param func 각 SendPacketInfo에 대해 호출할 함수
 	// ----------------------------------------
 	void ForEachAndClearSendPacketInfoMap(const std::function<void(SendPacketInfo*)>& func);
 
 	// ----------------------------------------
-	// @brief 캐시된 시퀀스 집합에 대한 참조를 반환합니다.
-	// @return PacketSequenceSetKey 집합 참조
+	// @brief 송신 패스마다 이미 실은 시퀀스를 기록하는 비트맵에 대한 참조를 반환합니다.
+	// @return SendSequenceBitmap 참조
 	// ----------------------------------------
 	[[nodiscard]]
-	std::set<MultiSocketRUDP::PacketSequenceSetKey>& GetCachedSequenceSet();
-	// ----------------------------------------
-	// @brief 캐시된 시퀀스 집합 보호용 mutex를 반환합니다.
-	// @return mutex 참조
-	// ----------------------------------------
-	[[nodiscard]]
-	std::mutex& GetCachedSequenceSetLock();
+	SendSequenceBitmap& GetSendSequenceBitmap();
 
 	// ----------------------------------------
 	// @brief 마지막으로 사용된 송신 패킷 시퀀스를 반환합니다.
@@ -177,6 +217,20 @@ public:
 	// ----------------------------------------
 	[[nodiscard]]
 	PacketSequence IncrementLastSendPacketSequence();
+	// ----------------------------------------
+	// @brief 송신 패킷 시퀀스를 count개 연속으로 예약합니다.
+	// @param count 예약할 시퀀스 수
+	// @return 예약한 구간의 첫 시퀀스
+	// ----------------------------------------
+	[[nodiscard]]
+	PacketSequence ReserveSendPacketSequences(size_t count);
+
+	// ----------------------------------------
+	// @brief 응답(ACK 프레임) 패킷 시퀀스를 증가시키고 반환합니다.
+	// @return 증가된 응답 시퀀스 값
+	// ----------------------------------------
+	[[nodiscard]]
+	PacketSequence IncrementLastReplyPacketSequence();
 
 	void InitializePendingQueue(unsigned short capacity);
 	[[nodiscard]]
@@ -218,20 +272,24 @@ public:
 	void ClearPendingQueue();
 
 private:
-	SendPacketInfo* reservedSendPacketInfo = nullptr;
-	char rioSendBuffer[MAX_SEND_BUFFER_SIZE]{};
-	RIO_BUFFERID sendBufferId = RIO_INVALID_BUFFERID;
+	std::atomic<SendPacketInfo*> reservedSendPacketInfo{};
+	RegisteredBufferSlab* sendBufferSlab{};
+	RegisteredBufferChunk sendBufferChunk{};
 	std::atomic<IO_MODE> ioMode = IO_MODE::IO_NONE_SENDING;
+	std::atomic_uint sendDatagramsInFlight{};
+	std::atomic_bool deferredSendCommitPending{};
 
-	std::mutex sendPacketInfoQueueLock;
-	std::queue<SendPacketInfo*> sendPacketInfoQueue;
+	SendPacketInfoQueue sendPacketInfoQueue;
 
 	std::atomic<PacketSequence> lastSendPacketSequence{};
+	std::atomic<PacketSequence> lastReplyPacketSequence{};
 	std::map<PacketSequence, SendPacketInfo*> sendPacketInfoMap;
 	std::shared_mutex sendPacketInfoMapLock;
+	// 세션의 logic worker에서만 접근합니다.
+	PacketSequence lastFastRetransmitSequence{};
 
-	std::set<MultiSocketRUDP::PacketSequenceSetKey> cachedSequenceSet;
-	std::mutex cachedSequenceSetLock;
+	// IO_SENDING을 가진 송신 경로에서만 접근합니다.
+	SendSequenceBitmap sendSequenceBitmap;
 
 	RingBuffer<std::pair<PacketSequence, NetBuffer*>> pendingPacketQueue{ 0 };
 	std::mutex pendingPacketQueueLock;
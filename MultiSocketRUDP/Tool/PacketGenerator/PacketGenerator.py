@@ -13,6 +13,53 @@ def ToEnumName(name):
     s2 = re.sub('([a-z0-9])([A-Z])', r'\1_\2', s1)
     return s2.upper()
 
+def ToViewClassName(packetName):
+    return packetName + "View"
+
+
+def ToViewItemType(itemType):
+    if itemType == 'std::string':
+        return 'std::string_view'
+    return itemType
+
+
+def IsVariableSizeItemType(itemType):
+    return itemType == 'std::string'
+
+
+def IsFixedSizePacket(items):
+    if items is None:
+        return True
+    
+    for item in items:
+        if IsVariableSizeItemType(item['Type']):
+            return False
+    return True
+
+
+def MakeFixedSerializedSizeExpression(items):
+    if items is None:
+        return "0"
+    return " + ".join(f"sizeof({item['Type']})" for item in items)
+
+
+def MakeSerializedSizeExpression(items):
+    terms = []
+    for item in items:
+        if IsVariableSizeItemType(item['Type']):
+            terms.append(f"sizeof(PacketStringLengthType) + {item['Name']}.size()")
+        else:
+            terms.append(f"sizeof({item['Type']})")
+    return " + ".join(terms)
+
+
+def GetHandlerPacketTypeName(packet):
+    packetName = packet.get('PacketName', '')
+    if packet.get('UseView', False) == True:
+        return ToViewClassName(packetName)
+    return packetName
+
+
 def CopyPacketFiles():
     try:
         shutil.copy(PacketItemsFilePath.packetTypeFilePath, PacketItemsFilePath.packetTypeFilePath + "_new")
@@ -161,7 +208,10 @@ def MakePacketClasss(packetList):
         generatedCode += f"class {packetName} final : public IPacket\n" + "{\npublic:\n"
         generatedCode += f"\t{packetName}() = default;\n"
         generatedCode += f"\t~{packetName}() override = default;\n\npublic:\n"
+        if IsFixedSizePacket(items):
+            generatedCode += f"\tstatic constexpr size_t SERIALIZED_SIZE = {MakeFixedSerializedSizeExpression(items)};\n\npublic:\n"
         generatedCode += "\t[[nodiscard]]\n\tPacketId GetPacketId() const override;\n"
+        generatedCode += "\t[[nodiscard]]\n\tsize_t GetSerializedSize() const override;\n"
         if items is not None:
             generatedCode += "\tvoid BufferToPacket(NetBuffer& buffer) override;\n"
             generatedCode += "\tvoid PacketToBuffer(NetBuffer& buffer) override;\n"
@@ -169,6 +219,21 @@ def MakePacketClasss(packetList):
             for item in items:
                 generatedCode += f"\t{item['Type']} {item['Name']};\n"
         generatedCode += "};\n\n"
+        
+        if items is not None:
+            generatedCode += MakePacketViewClass(packetName, items)
+    
+    return generatedCode
+
+
+def MakePacketViewClass(packetName, items):
+    viewClassName = ToViewClassName(packetName)
+    generatedCode = f"class {viewClassName} final\n" + "{\npublic:\n"
+    generatedCode += "\t[[nodiscard]]\n\tbool Parse(NetBuffer& buffer);\n"
+    generatedCode += "\npublic:\n"
+    for item in items:
+        generatedCode += f"\t{ToViewItemType(item['Type'])} {item['Name']}{{}};\n"
+    generatedCode += "};\n\n"
     
     return generatedCode
 
@@ -178,6 +243,14 @@ def GenerateProtocolHeader(packetList):
     with open(PacketItemsFilePath.protocolHeaderPath, "r") as file:
         originCode = file.read()
     
+    # Protocol.h files created before packet views existed do not include the view reader yet
+    viewReaderInclude = '#include "../MultiSocketRUDPServer/PacketViewReader.h"\n'
+    packetManagerInclude = '#include "../MultiSocketRUDPServer/PacketManager.h"\n'
+    if viewReaderInclude not in originCode:
+        originCode = originCode.replace(packetManagerInclude, packetManagerInclude + viewReaderInclude, 1)
+    if '#include <string_view>\n' not in originCode:
+        originCode = originCode.replace('#include <string>\n', '#include <string>\n#include <string_view>\n', 1)
+    
     modifiedCode = re.sub(pattern, f"#pragma pack(push, 1)\n{MakePacketClasss(packetList)}#pragma pack(pop)", originCode, flags=re.DOTALL)
     
     targetFilePath = PacketItemsFilePath.protocolHeaderPath + "_new"
@@ -230,10 +303,19 @@ def GenerateProtocolCpp(packetList):
             modifiedCode += f"{candidateCode}{{\n\treturn static_cast<PacketId>(PACKET_ID::{ToEnumName(packetName)});\n}}\n"
             needWrite = True
         
+        items = packet.get('Items')
+        serializedSizeCode = f"size_t {packetName}::GetSerializedSize() const\n"
+        if serializedSizeCode not in modifiedCode:
+            if IsFixedSizePacket(items):
+                sizeExpression = "SERIALIZED_SIZE"
+            else:
+                sizeExpression = MakeSerializedSizeExpression(items)
+            modifiedCode += f"{serializedSizeCode}{{\n\treturn {sizeExpression};\n}}\n"
+            needWrite = True
+        
         bufferToPacketCode = f"void {packetName}::BufferToPacket(NetBuffer& buffer)\n"
         packetToBufferCode = f"void {packetName}::PacketToBuffer(NetBuffer& buffer)\n"
         
-        items = packet.get('Items')
         parameters = "buffer"
         if items is not None:
             for item in items:
@@ -251,6 +333,14 @@ def GenerateProtocolCpp(packetList):
                 modifiedCode += f"\tSetParametersToBuffer({parameters});\n"
                 modifiedCode += "}\n"
                 needWrite = True
+            
+            parseViewCode = f"bool {ToViewClassName(packetName)}::Parse(NetBuffer& buffer)\n"
+            if parseViewCode not in modifiedCode:
+                modifiedCode += parseViewCode
+                modifiedCode += "{\n"
+                modifiedCode += f"\treturn SetBufferToViewParameters({parameters});\n"
+                modifiedCode += "}\n"
+                needWrite = True
 
     if needWrite == True:
         modifiedCode = re.sub(pattern, "#pragma region packet function\n" + modifiedCode + "#pragma endregion packet function", originCode, flags=re.DOTALL)
@@ -339,7 +429,7 @@ def GetReplyPacketName(request_name: str, packets: List[Dict]) -> str:
 
 def GeneratePlayerHandlerCode(packet: Dict, packets: List[Dict]) -> str:
     packet_name = packet.get('PacketName', '')
-    code = f"void Player::On{packet_name}(const {packet_name}& packet)\n{{\n\n}}\n"
+    code = f"void Player::On{packet_name}(const {GetHandlerPacketTypeName(packet)}& packet)\n{{\n\n}}\n"
     
     return code
 
@@ -352,7 +442,7 @@ def GeneratePlayerPacketHandlerDeclarations(packetList):
         if packet.get('Type') == 'RequestPacket':
             packet_name = packet.get('PacketName', '')
             if packet_name and packet_name not in existing_declarations:
-                declaration = f"\tvoid On{packet_name}(const {packet_name}& packet);"
+                declaration = f"\tvoid On{packet_name}(const {GetHandlerPacketTypeName(packet)}& packet);"
                 new_declarations.append(declaration)
     
     if not new_declarations:
@@ -102,6 +102,29 @@ public sealed class BufferStoreTests
         Assert.Null(store.DequeueSendBuffer());
     }
 
+    /// <summary>
+    /// ACK 프레임의 누적 시퀀스와 SACK 구간이 덮는 항목만 제거되는지 확인합니다.
+    /// </summary>
+    [Fact]
+    public void RemoveCoveredSendBuffersRemovesCumulativeAndSackedSequencesOnly()
+    {
+        var store = new BufferStore();
+        for (ulong sequence = 0; sequence <= 8; sequence++)
+        {
+            store.EnqueueSendBuffer(MakeInfo(sequence));
+        }
+
+        var ackFrame = new AckFrame { CumulativeSequence = 2 };
+        Assert.True(ackFrame.TryAddSackRange(4, 5));
+        Assert.True(ackFrame.TryAddSackRange(7, 7));
+
+        var removed = store.RemoveCoveredSendBuffers(ackFrame);
+
+        Assert.Equal(new ulong[] { 0, 1, 2, 4, 5, 7 }, removed.Select(info => info.PacketSequence));
+        Assert.Equal(new ulong[] { 3, 6, 8 }, store.GetAllSendPacketInfos().Select(info => info.PacketSequence));
+        Assert.Empty(store.RemoveCoveredSendBuffers(ackFrame));
+    }
+
     /// <summary>
     /// 고유 시퀀스의 병렬 추가와 삭제 후 개수와 시퀀스 유일성이 유지되는지 확인합니다.
     /// </summary>
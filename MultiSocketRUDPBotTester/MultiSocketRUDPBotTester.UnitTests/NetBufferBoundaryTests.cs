@@ -117,6 +117,102 @@ public sealed class NetBufferBoundaryTests
         Assert.Equal(DecodePacketFailureReason.InvalidLayout, failure.Reason);
     }
 
+    [Fact]
+    public void DecodeRejectsUnknownPiggybackAckFlag()
+    {
+        var packet = new NetBuffer(64);
+        packet.ReserveHeader();
+        packet.WriteByte(7);
+        packet.InsertPacketType(PacketType.SendType);
+        packet.InsertPacketSequence(3);
+        packet.InsertPacketId(PacketId.TestPacketReq);
+        using var aes = new AesGcm(Key, CryptoHelper.AuthTagSize);
+        NetBuffer.EncodePacket(
+            aes,
+            packet,
+            3,
+            PacketDirection.ServerToClient,
+            Salt,
+            isCorePacket: false);
+        var bytes = packet.GetPacketBuffer();
+        bytes[14] = NetBuffer.PiggybackAckPresent + 1;
+
+        var malformed = FromBytes(bytes);
+        Assert.False(NetBuffer.DecodePacket(
+            aes,
+            malformed,
+            isCorePacket: false,
+            Salt,
+            PacketDirection.ServerToClient,
+            out var failure));
+        Assert.Equal(DecodePacketFailureReason.InvalidLayout, failure.Reason);
+    }
+
+    [Fact]
+    public void AckFrameRoundTripsAndRejectsUnorderedOrTruncatedRanges()
+    {
+        var written = new AckFrame { CumulativeSequence = 5, AdvertiseWindow = 200 };
+        Assert.True(written.TryAddSackRange(7, 8));
+        Assert.True(written.TryAddSackRange(10, 10));
+        Assert.False(written.TryAddSackRange(5 + NetBuffer.MaxSackOffset + 1, 5 + NetBuffer.MaxSackOffset + 1));
+        var buffer = new NetBuffer(64);
+        buffer.WriteAckFrame(written);
+
+        Assert.True(buffer.TryReadAckFrame(out var read));
+        Assert.Equal(5UL, read.CumulativeSequence);
+        Assert.Equal(200, read.AdvertiseWindow);
+        Assert.Equal(new[] { new SackRange(7, 8), new SackRange(10, 10) }, read.SackRanges);
+        Assert.True(read.IsCovered(5));
+        Assert.False(read.IsCovered(6));
+        Assert.True(read.IsCovered(8));
+        Assert.False(read.IsCovered(9));
+        Assert.Equal(10UL, read.GetHighestCoveredSequence());
+
+        var overlapping = new NetBuffer(64);
+        overlapping.WriteULong(5);
+        overlapping.WriteByte(0);
+        overlapping.WriteByte(2);
+        overlapping.WriteUShort(2);
+        overlapping.WriteUShort(4);
+        overlapping.WriteUShort(4);
+        overlapping.WriteUShort(6);
+        Assert.False(overlapping.TryReadAckFrame(out _));
+
+        var truncated = new NetBuffer(64);
+        truncated.WriteULong(5);
+        truncated.WriteByte(0);
+        truncated.WriteByte(1);
+        truncated.WriteUShort(2);
+        Assert.False(truncated.TryReadAckFrame(out _));
+    }
+
+    [Fact]
+    public void PiggybackAckFieldReadsAbsentAndPresentFrames()
+    {
+        var absent = new NetBuffer(64);
+        absent.WriteByte(NetBuffer.PiggybackAckAbsent);
+        absent.WriteUInt((uint)PacketId.TestPacketReq);
+        Assert.True(absent.TryReadPiggybackAckField(out var absentFrame));
+        Assert.Null(absentFrame);
+        Assert.Equal((uint)PacketId.TestPacketReq, absent.ReadUInt());
+
+        var frame = new AckFrame { CumulativeSequence = 9, AdvertiseWindow = 32 };
+        Assert.True(frame.TryAddSackRange(11, 12));
+        var present = new NetBuffer(64);
+        present.WriteByte(NetBuffer.PiggybackAckPresent);
+        present.WriteAckFrame(frame);
+        present.WriteUInt((uint)PacketId.TestPacketReq);
+        Assert.True(present.TryReadPiggybackAckField(out var presentFrame));
+        Assert.NotNull(presentFrame);
+        Assert.Equal(9UL, presentFrame.CumulativeSequence);
+        Assert.Equal(new[] { new SackRange(11, 12) }, presentFrame.SackRanges);
+        Assert.Equal((uint)PacketId.TestPacketReq, present.ReadUInt());
+
+        var unknown = new NetBuffer(64);
+        unknown.WriteByte(NetBuffer.PiggybackAckPresent + 1);
+        Assert.False(unknown.TryReadPiggybackAckField(out _));
+    }
+
     private static NetBuffer FromBytes(byte[] bytes)
     {
         var buffer = new NetBuffer(bytes.Length);
@@ -83,6 +83,7 @@ public sealed class NetBufferCryptoTests
                 0, 0, 0, 0, 0,
                 (byte)PacketType.SendType,
                 8, 7, 6, 5, 4, 3, 2, 1,
+                NetBuffer.PiggybackAckAbsent,
                 0x44, 0x33, 0x22, 0x11,
                 0xDE, 0xAD
             },
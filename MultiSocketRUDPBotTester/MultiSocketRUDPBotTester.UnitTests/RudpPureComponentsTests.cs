@@ -162,6 +162,22 @@ public sealed class ReceivePacketOrdererTests
         Assert.Equal(Enumerable.Range(1, 500).Select(value => (ulong)value), released.Order());
     }
 
+    [Fact]
+    public void AckFrameCoversDeliveredSequencesAndSacksHeldRanges()
+    {
+        var orderer = new ReceivePacketOrderer();
+        foreach (var sequence in new ulong[] { 1, 2, 4, 5, 7 })
+        {
+            orderer.Collect(sequence, PacketId.TestPacketRes, Packet(sequence), PacketType.SendType);
+        }
+
+        var ackFrame = orderer.BuildAckFrame();
+
+        Assert.Equal(2UL, ackFrame.CumulativeSequence);
+        Assert.Equal(byte.MaxValue - 3, ackFrame.AdvertiseWindow);
+        Assert.Equal(new[] { new SackRange(4, 5), new SackRange(7, 7) }, ackFrame.SackRanges);
+    }
+
     private static NetBuffer Packet(ulong sequence)
     {
         var buffer = new NetBuffer(16);
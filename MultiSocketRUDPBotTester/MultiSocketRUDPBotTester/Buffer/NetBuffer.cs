@@ -20,6 +20,53 @@ namespace MultiSocketRUDPBotTester.Buffer
         int BodySize,
         int AuthTagOffset);
 
+    public readonly record struct SackRange(ulong First, ulong Last);
+
+    // ACK frame carried by SEND_REPLY_TYPE bodies and by the SEND_TYPE piggyback field.
+    // Every sequence up to CumulativeSequence and every sequence inside a SACK range has been received.
+    // Ranges are ascending, do not overlap and all lie after CumulativeSequence.
+    public sealed class AckFrame
+    {
+        public ulong CumulativeSequence { get; set; }
+        public byte AdvertiseWindow { get; set; }
+        public List<SackRange> SackRanges { get; } = [];
+
+        public bool TryAddSackRange(ulong first, ulong last)
+        {
+            if (SackRanges.Count >= NetBuffer.MaxSackRangeCount
+                || unchecked(last - CumulativeSequence) > NetBuffer.MaxSackOffset)
+            {
+                return false;
+            }
+
+            SackRanges.Add(new SackRange(first, last));
+            return true;
+        }
+
+        public bool IsCovered(ulong sequence)
+        {
+            if (sequence <= CumulativeSequence)
+            {
+                return true;
+            }
+
+            foreach (var range in SackRanges)
+            {
+                if (range.First <= sequence && sequence <= range.Last)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        public ulong GetHighestCoveredSequence()
+        {
+            return SackRanges.Count == 0 ? CumulativeSequence : SackRanges[^1].Last;
+        }
+    }
+
     public class NetBuffer
     {
         public static byte HeaderCode { get; set; } = 0xCC;
@@ -30,9 +77,23 @@ namespace MultiSocketRUDPBotTester.Buffer
         private const int PacketIdSize = 4;
         private const int AuthTagSize = 16;
 
+        // SEND_TYPE carries a piggyback ACK field between the sequence and the packet ID.
+        // The bot client always writes the absent flag, but the server may attach an ACK frame.
+        public const byte PiggybackAckAbsent = 0;
+        public const byte PiggybackAckPresent = 1;
+        private const int PiggybackAckFlagSize = 1;
+        private const int AckFrameFixedSize = PacketSequenceSize + 1 + 1;
+        private const int SackRangeSize = 2 + 2;
+        public const int MaxSackRangeCount = 8;
+        public const ulong MaxSackOffset = ushort.MaxValue;
+
+        // Reply packets put this flag on the header sequence so that every reply gets its own nonce,
+        // even when the same cumulative sequence is acknowledged more than once.
+        public const ulong ReplySequenceFlag = 1UL << 62;
+
         private const int PacketSequenceOffset = HeaderSize + PacketTypeSize;
         private const int BodyOffsetCorePacket = HeaderSize + PacketTypeSize + PacketSequenceSize;
-        private const int BodyOffsetFullPacket = BodyOffsetCorePacket + PacketIdSize;
+        private const int BodyOffsetFullPacket = BodyOffsetCorePacket + PiggybackAckFlagSize + PacketIdSize;
 
         private readonly byte[] _buffer;
         private int _readPos;
@@ -249,21 +310,104 @@ namespace MultiSocketRUDPBotTester.Buffer
         public void InsertPacketId(PacketId packetId)
         {
             var afterSeq = HeaderSize + PacketTypeSize + PacketSequenceSize;
+            const int metadataSize = PiggybackAckFlagSize + PacketIdSize;
             EnsureMetadataLayout(afterSeq);
-            EnsureWritable(PacketIdSize);
+            EnsureWritable(metadataSize);
             var bodyLen = _writePos - afterSeq;
             if (bodyLen > 0)
             {
-                Array.Copy(_buffer, afterSeq, _buffer, afterSeq + PacketIdSize, bodyLen);
+                Array.Copy(_buffer, afterSeq, _buffer, afterSeq + metadataSize, bodyLen);
             }
 
+            _buffer[afterSeq] = PiggybackAckAbsent;
             var id = (uint)packetId;
             for (var i = 0; i < PacketIdSize; i++)
             {
-                _buffer[afterSeq + i] = (byte)((id >> (i * 8)) & 0xFF);
+                _buffer[afterSeq + PiggybackAckFlagSize + i] = (byte)((id >> (i * 8)) & 0xFF);
             }
 
-            _writePos += PacketIdSize;
+            _writePos += metadataSize;
+        }
+
+        public bool SkipPiggybackAckField()
+        {
+            var fieldSize = GetPiggybackAckFieldSize(_buffer.AsSpan(_readPos, _writePos - _readPos));
+            if (fieldSize < 0)
+            {
+                return false;
+            }
+
+            _readPos += fieldSize;
+            return true;
+        }
+
+        public bool TryReadPiggybackAckField(out AckFrame? ackFrame)
+        {
+            ackFrame = null;
+            if (GetPiggybackAckFieldSize(_buffer.AsSpan(_readPos, _writePos - _readPos)) < 0)
+            {
+                return false;
+            }
+
+            if (ReadByte() == PiggybackAckAbsent)
+            {
+                return true;
+            }
+
+            if (!TryReadAckFrame(out var frame))
+            {
+                return false;
+            }
+
+            ackFrame = frame;
+            return true;
+        }
+
+        public void WriteAckFrame(AckFrame ackFrame)
+        {
+            WriteULong(ackFrame.CumulativeSequence);
+            WriteByte(ackFrame.AdvertiseWindow);
+            WriteByte((byte)ackFrame.SackRanges.Count);
+            foreach (var range in ackFrame.SackRanges)
+            {
+                WriteUShort((ushort)unchecked(range.First - ackFrame.CumulativeSequence));
+                WriteUShort((ushort)unchecked(range.Last - ackFrame.CumulativeSequence));
+            }
+        }
+
+        public bool TryReadAckFrame(out AckFrame ackFrame)
+        {
+            ackFrame = new AckFrame();
+            if (_writePos - _readPos < AckFrameFixedSize)
+            {
+                return false;
+            }
+
+            ackFrame.CumulativeSequence = ReadULong();
+            ackFrame.AdvertiseWindow = ReadByte();
+            var sackRangeCount = ReadByte();
+            if (sackRangeCount > MaxSackRangeCount || _writePos - _readPos < sackRangeCount * SackRangeSize)
+            {
+                return false;
+            }
+
+            ushort previousLastOffset = 0;
+            for (var i = 0; i < sackRangeCount; i++)
+            {
+                var firstOffset = ReadUShort();
+                var lastOffset = ReadUShort();
+                if (firstOffset <= previousLastOffset || lastOffset < firstOffset)
+                {
+                    return false;
+                }
+
+                ackFrame.SackRanges.Add(new SackRange(
+                    unchecked(ackFrame.CumulativeSequence + firstOffset),
+                    unchecked(ackFrame.CumulativeSequence + lastOffset)));
+                previousLastOffset = lastOffset;
+            }
+
+            return true;
         }
 
         public void BuildConnectPacket(SessionIdType sessionId)
@@ -342,7 +486,7 @@ namespace MultiSocketRUDPBotTester.Buffer
 
             packet.SetHeader(AuthTagSize);
 
-            const int aadSize = HeaderSize + PacketTypeSize + PacketSequenceSize;
+            var aadSize = isCorePacket ? BodyOffsetCorePacket : BodyOffsetCorePacket + PiggybackAckFlagSize;
             var tagDest = packet._buffer.AsSpan(packet._writePos, AuthTagSize);
             aesGcm.Encrypt(
                 nonce,
@@ -378,8 +522,16 @@ namespace MultiSocketRUDPBotTester.Buffer
             PacketDirection direction,
             out DecodePacketFailureDetails outFailureDetails)
         {
-            var bodyOffset = isCorePacket ? BodyOffsetCorePacket : BodyOffsetFullPacket;
             var authTagOffset = packet._writePos - AuthTagSize;
+            var piggybackAckFieldSize = 0;
+            if (!isCorePacket && authTagOffset >= BodyOffsetCorePacket)
+            {
+                piggybackAckFieldSize = GetPiggybackAckFieldSize(packet._buffer.AsSpan(
+                    BodyOffsetCorePacket, Math.Max(0, authTagOffset - BodyOffsetCorePacket - PacketIdSize)));
+            }
+
+            var aadSize = BodyOffsetCorePacket + piggybackAckFieldSize;
+            var bodyOffset = isCorePacket ? BodyOffsetCorePacket : aadSize + PacketIdSize;
             var bodySize = authTagOffset - bodyOffset;
             var hasHeader = packet._writePos >= HeaderSize;
             var headerPayloadSize = hasHeader
@@ -387,6 +539,7 @@ namespace MultiSocketRUDPBotTester.Buffer
                 : 0;
 
             if (packet._writePos < PacketSequenceOffset + PacketSequenceSize
+                || piggybackAckFieldSize < 0
                 || bodySize < 0
                 || authTagOffset < bodyOffset
                 || headerPayloadSize != packet._writePos - HeaderSize)
@@ -414,7 +567,6 @@ namespace MultiSocketRUDPBotTester.Buffer
 
             try
             {
-                const int aadSize = HeaderSize + PacketTypeSize + PacketSequenceSize;
                 aesGcm.Decrypt(
                     nonce,
                     ciphertext: packet._buffer.AsSpan(bodyOffset, bodySize),
@@ -441,6 +593,28 @@ namespace MultiSocketRUDPBotTester.Buffer
             }
         }
 
+        private static int GetPiggybackAckFieldSize(ReadOnlySpan<byte> field)
+        {
+            if (field.Length < PiggybackAckFlagSize)
+            {
+                return -1;
+            }
+
+            if (field[0] == PiggybackAckAbsent)
+            {
+                return PiggybackAckFlagSize;
+            }
+
+            if (field[0] != PiggybackAckPresent || field.Length < PiggybackAckFlagSize + AckFrameFixedSize)
+            {
+                return -1;
+            }
+
+            var sackRangeCount = field[PiggybackAckFlagSize + AckFrameFixedSize - 1];
+            var fieldSize = PiggybackAckFlagSize + AckFrameFixedSize + sackRangeCount * SackRangeSize;
+            return sackRangeCount > MaxSackRangeCount || fieldSize > field.Length ? -1 : fieldSize;
+        }
+
         private void EnsureReadable(int count)
         {
             if (count < 0 || _readPos > _writePos - count)
@@ -107,6 +107,11 @@ public class BufferStore
         return sendBufferStore.RemoveAndGetSendBuffer(sequence);
     }
 
+    public List<SendPacketInfo> RemoveCoveredSendBuffers(AckFrame ackFrame)
+    {
+        return sendBufferStore.RemoveCoveredSendBuffers(ackFrame);
+    }
+
     public int GetSendBufferCount()
     {
         return sendBufferStore.GetSendBufferCount();
@@ -197,6 +202,34 @@ public class BufferStore
             }
         }
 
+        public List<SendPacketInfo> RemoveCoveredSendBuffers(AckFrame ackFrame)
+        {
+            var removed = new List<SendPacketInfo>();
+            var highestCoveredSequence = ackFrame.GetHighestCoveredSequence();
+            lock (sendBufferStoreLock)
+            {
+                foreach (var (sequence, sendPacketInfo) in sendBufferStore)
+                {
+                    if (sequence > highestCoveredSequence)
+                    {
+                        break;
+                    }
+
+                    if (ackFrame.IsCovered(sequence))
+                    {
+                        removed.Add(sendPacketInfo);
+                    }
+                }
+
+                foreach (var sendPacketInfo in removed)
+                {
+                    sendBufferStore.Remove(sendPacketInfo.PacketSequence);
+                }
+            }
+
+            return removed;
+        }
+
         public int GetSendBufferCount()
         {
             lock (sendBufferStoreLock)
@@ -150,13 +150,13 @@ namespace MultiSocketRUDPBotTester.ClientCore
         private const int HeaderSize = 5;
         private const int RetransmissionWakeUpMs = 16;
         private const long AckDelayRetransmissionThreshold = 1;
-        private const long AckRemovalDelayLogThresholdMs = 5;
 
         public SessionInfo SessionInfo { get; } = new() { SessionState = SessionState.Disconnected };
         public TargetServerInfo TargetServerInfo { get; } = new();
 
         private UdpClient udpClient = null!;
         private PacketSequence lastSendSequence = 0;
+        private PacketSequence lastReplyPacketSequence = 0;
 
         private readonly Lock aesGcmLock = new();
 
@@ -466,7 +466,18 @@ namespace MultiSocketRUDPBotTester.ClientCore
             var packetId = PacketId.InvalidPacketId;
             if (!isCorePacket)
             {
+                // The server may piggyback the ACK frame it would otherwise send as a separate SEND_REPLY_TYPE.
+                if (!buffer.TryReadPiggybackAckField(out var piggybackAckFrame))
+                {
+                    Log.Error("ProcessReceivedPacketAsync: malformed piggyback ACK field (sequence={Sequence})", packetSequence);
+                    return;
+                }
+
                 packetId = (PacketId)buffer.ReadUInt();
+                if (piggybackAckFrame != null)
+                {
+                    OnSendReply(piggybackAckFrame);
+                }
             }
 
             OnRttPacketReceived(packetId, Stopwatch.GetTimestamp());
@@ -475,9 +486,9 @@ namespace MultiSocketRUDPBotTester.ClientCore
             {
                 case PacketType.HeartbeatType:
                 case PacketType.SendType:
-                    await SendReplyToServerAsync(packetSequence).ConfigureAwait(false);
-
                     var packetsToProcess = CollectPacketsToProcess(packetSequence, packetId, buffer, packetType);
+                    await SendReplyToServerAsync().ConfigureAwait(false);
+
                     foreach (var (sequence, pid, buf, type) in packetsToProcess)
                     {
                         if (type == PacketType.HeartbeatType)
@@ -501,7 +512,13 @@ namespace MultiSocketRUDPBotTester.ClientCore
                     break;
 
                 case PacketType.SendReplyType:
-                    OnSendReply(packetSequence);
+                    if (!buffer.TryReadAckFrame(out var ackFrame))
+                    {
+                        Log.Error("ProcessReceivedPacketAsync: malformed ACK frame (replySequence={Sequence})", packetSequence);
+                        return;
+                    }
+
+                    OnSendReply(ackFrame);
                     break;
             }
         }
@@ -515,12 +532,18 @@ namespace MultiSocketRUDPBotTester.ClientCore
             return receivePacketOrderer.Collect(packetSequence, packetId, buffer, packetType);
         }
 
-        private async Task SendReplyToServerAsync(PacketSequence packetSequence)
+        /// <summary>
+        /// 현재 수신 상태를 ACK 프레임으로 담아 SEND_REPLY_TYPE 응답을 보냅니다.
+        /// 응답 시퀀스는 ReplySequenceFlag가 붙은 별도 카운터를 사용하므로 응답마다 nonce가 달라집니다.
+        /// </summary>
+        private async Task SendReplyToServerAsync()
         {
+            var packetSequence = NetBuffer.ReplySequenceFlag | Interlocked.Increment(ref lastReplyPacketSequence);
             try
             {
-                var replyBuffer = new NetBuffer(64);
+                var replyBuffer = new NetBuffer(128);
                 replyBuffer.BuildCorePacket(PacketType.SendReplyType, packetSequence);
+                replyBuffer.WriteAckFrame(receivePacketOrderer.BuildAckFrame());
 
                 lock (aesGcmLock)
                 {
@@ -554,11 +577,15 @@ namespace MultiSocketRUDPBotTester.ClientCore
             }
         }
 
-        private void OnSendReply(PacketSequence packetSequence)
+        /// <summary>
+        /// 서버가 보낸 ACK 프레임이 덮는 송신 버퍼를 모두 제거합니다.
+        /// 로그인 패킷이 처음 덮이면 연결 완료로 전환합니다.
+        /// </summary>
+        private void OnSendReply(AckFrame ackFrame)
         {
             var nowMs = CommonFunc.GetNowMs();
 
-            if (packetSequence == LoginPacketSequence)
+            if (SessionInfo.SessionState == SessionState.Connecting && ackFrame.IsCovered(LoginPacketSequence))
             {
                 isConnected = true;
                 SessionInfo.SessionState = SessionState.Connected;
@@ -573,42 +600,19 @@ namespace MultiSocketRUDPBotTester.ClientCore
                 Log.Information("Connected to server. SessionId={Id}", SessionInfo.SessionId);
             }
 
-            if (Interlocked.Read(ref lastSendSequence) < packetSequence)
-                return;
-
-            var ackedPacketInfo = bufferStore.GetSendBuffer(packetSequence);
-            if (ackedPacketInfo != null)
-            {
-                ackedPacketInfo.MarkAckReceived(nowMs);
-            }
-
-            if (ackedPacketInfo != null &&
-                ackedPacketInfo.GetRetransmissionCount() >= AckDelayRetransmissionThreshold)
-            {
-                Log.Information(
-                    "[ClientRetransmissionAck] seq={Sequence} retransmissions={RetransmissionCount} outstandingSendBuffers={OutstandingSendBuffers}",
-                    packetSequence,
-                    ackedPacketInfo.GetRetransmissionCount(),
-                    bufferStore.GetSendBufferCount());
-            }
-
-            var removedPacketInfo = bufferStore.RemoveAndGetSendBuffer(packetSequence);
-            if (removedPacketInfo == null)
+            foreach (var removedPacketInfo in bufferStore.RemoveCoveredSendBuffers(ackFrame))
             {
-                return;
-            }
-
-            removedPacketInfo.MarkRemoved(nowMs);
+                removedPacketInfo.MarkAckReceived(nowMs);
+                removedPacketInfo.MarkRemoved(nowMs);
 
-            var ackRemovalDelayMs = nowMs - (ulong)removedPacketInfo.GetAckReceivedTimestampMs();
-            if (ackRemovalDelayMs >= AckRemovalDelayLogThresholdMs)
-            {
-                Log.Information(
-                    "[ClientAckRemovalDelay] seq={Sequence} ackRemovalDelayMs={AckRemovalDelayMs} retransmissions={RetransmissionCount} outstandingSendBuffers={OutstandingSendBuffers}",
-                    packetSequence,
-                    ackRemovalDelayMs,
-                    removedPacketInfo.GetRetransmissionCount(),
-                    bufferStore.GetSendBufferCount());
+                if (removedPacketInfo.GetRetransmissionCount() >= AckDelayRetransmissionThreshold)
+                {
+                    Log.Information(
+                        "[ClientRetransmissionAck] seq={Sequence} retransmissions={RetransmissionCount} outstandingSendBuffers={OutstandingSendBuffers}",
+                        removedPacketInfo.PacketSequence,
+                        removedPacketInfo.GetRetransmissionCount(),
+                        bufferStore.GetSendBufferCount());
+                }
             }
         }
 
@@ -784,6 +788,7 @@ namespace MultiSocketRUDPBotTester.ClientCore
             TargetServerInfo.ServerIp = string.Empty;
             TargetServerInfo.ServerPort = 0;
             Interlocked.Exchange(ref lastSendSequence, 0);
+            Interlocked.Exchange(ref lastReplyPacketSequence, 0);
             receivePacketOrderer.Clear();
             bufferStore.Clear();
 
@@ -57,6 +57,51 @@ namespace MultiSocketRUDPBotTester.ClientCore
             }
         }
 
+        // Describes the receive state in the ACK frame layout the server expects on SEND_REPLY_TYPE.
+        // Held packets become SACK ranges; ranges that do not fit in the frame are left for later replies.
+        public AckFrame BuildAckFrame()
+        {
+            lock (orderLock)
+            {
+                var ackFrame = new AckFrame
+                {
+                    CumulativeSequence = expectedSequence,
+                    AdvertiseWindow = (byte)(byte.MaxValue - Math.Min(heldPackets.Count, byte.MaxValue))
+                };
+
+                if (heldPackets.Count == 0)
+                {
+                    return ackFrame;
+                }
+
+                var reference = expectedSequence;
+                var heldSequences = heldPackets.Keys.OrderBy(sequence => unchecked(sequence - reference));
+                PacketSequence rangeFirst = 0;
+                PacketSequence rangeLast = 0;
+                var hasRange = false;
+                foreach (var sequence in heldSequences)
+                {
+                    if (hasRange && sequence == Next(rangeLast))
+                    {
+                        rangeLast = sequence;
+                        continue;
+                    }
+
+                    if (hasRange && !ackFrame.TryAddSackRange(rangeFirst, rangeLast))
+                    {
+                        return ackFrame;
+                    }
+
+                    rangeFirst = sequence;
+                    rangeLast = sequence;
+                    hasRange = true;
+                }
+
+                ackFrame.TryAddSackRange(rangeFirst, rangeLast);
+                return ackFrame;
+            }
+        }
+
         internal int GetHeldPacketCount()
         {
             lock (orderLock)
@@ -72,6 +72,11 @@ foreach (var testVector in testVectors)
     packet.SkipBytes(5);
     var decodedPacketType = packet.ReadByte();
     var decodedSequence = packet.ReadULong();
+    if (!testVector.IsCorePacket && !packet.SkipPiggybackAckField())
+    {
+        mismatches.Add($"{testVector.Name}: piggyback ACK field is malformed.");
+        continue;
+    }
     uint? decodedPacketId = testVector.IsCorePacket ? null : packet.ReadUInt();
     var decodedPlaintext = packet.ReadBytes(plaintext.Length);
     if (decodedPacketType != testVector.PacketType
@@ -81,6 +86,25 @@ foreach (var testVector in testVectors)
     {
         mismatches.Add($"{testVector.Name}: decoded packet fields do not match the vector.");
     }
+
+    // A core SEND_REPLY_TYPE packet carries an ACK frame body; both sides must agree on its layout.
+    if (testVector.IsCorePacket && testVector.PacketType == (byte)PacketType.SendReplyType)
+    {
+        var frameBuffer = new NetBuffer(128);
+        frameBuffer.WriteBytes(plaintext);
+        if (!frameBuffer.TryReadAckFrame(out var ackFrame))
+        {
+            mismatches.Add($"{testVector.Name}: ACK frame is malformed.");
+            continue;
+        }
+
+        var rewritten = new NetBuffer(128);
+        rewritten.WriteAckFrame(ackFrame);
+        if (!rewritten.GetPacketBuffer().SequenceEqual(plaintext))
+        {
+            mismatches.Add($"{testVector.Name}: re-encoded ACK frame does not match the vector.");
+        }
+    }
 }
 
 if (mismatches.Count > 0)